@@ -0,0 +1,197 @@
+#version 330 core
+
+#define DEGREES_MAX   360.0f
+#define LATITUDE_MAX  85.051128779806604f
+#define LONGITUDE_MAX 180.0f
+#define PI            3.1415926535897932384626433f
+#define RAD2DEG       57.295779513082320876798156332941f
+
+#define RANGE_FOLDED      1u
+#define VERTICES_PER_GATE 6
+
+uniform mat4 uMVPMatrix;
+uniform vec2 uMapScreenCoord;
+uniform vec2 uRadarLatLong;
+
+// Data moments, radials x gates
+uniform usampler2D uMomentTexture;
+uniform usampler2D uCfpTexture;
+
+// Radial table, two texels per radial
+uniform isampler2D uRadialTexture;
+
+// Gate edge coordinates, radials x gates
+uniform sampler2D uCoordinateTexture;
+
+uniform bool uCfpPresent;
+uniform bool uSmoothingEnabled;
+uniform bool uShowSmoothedRangeFolding;
+uniform uint uSnrThreshold;
+uniform uint uEdgeValue;
+
+out float dataMoment;
+out float cfpMoment;
+
+// Corner of each vertex in a gate, matching the order:
+//
+// 1 +---+ 3
+//   |  /|
+//   | / |
+//   |/  |
+// 0 +---+ 2
+//
+// Bit 0 is the range offset, and bit 1 is the radial offset
+const int kGateCorners[VERTICES_PER_GATE] = int[](0, 1, 3, 0, 2, 3);
+
+vec2 latLngToScreenCoordinate(in vec2 latLng)
+{
+   vec2 p;
+   latLng.x = clamp(latLng.x, -LATITUDE_MAX, LATITUDE_MAX);
+   p.xy     = vec2(LONGITUDE_MAX + latLng.y,
+                   -(LONGITUDE_MAX - RAD2DEG * log(tan(PI / 4 + latLng.x * PI / DEGREES_MAX))));
+   return p;
+}
+
+bool isHidden(uint moment)
+{
+   return moment < uSnrThreshold && moment != RANGE_FOLDED;
+}
+
+bool isHiddenSmoothed(uint moment)
+{
+   if (uShowSmoothedRangeFolding)
+   {
+      return moment < uSnrThreshold && moment != RANGE_FOLDED;
+   }
+   return moment < uSnrThreshold || moment == RANGE_FOLDED;
+}
+
+uint remapDataMoment(uint moment)
+{
+   if (moment != 0u && (moment != RANGE_FOLDED || uShowSmoothedRangeFolding))
+   {
+      return moment;
+   }
+   return uEdgeValue;
+}
+
+void cull()
+{
+   // Place the vertex outside of the clip volume, so the triangle is discarded
+   dataMoment  = 0.0f;
+   cfpMoment   = 0.0f;
+   gl_Position = vec4(2.0f, 2.0f, 2.0f, 1.0f);
+}
+
+void main()
+{
+   ivec2 momentSize  = textureSize(uMomentTexture, 0);
+   int   gateCount   = momentSize.x;
+   int   radialCount = momentSize.y;
+
+   int cell   = gl_VertexID / VERTICES_PER_GATE;
+   int vertex = gl_VertexID % VERTICES_PER_GATE;
+   int row    = cell / gateCount;
+   int i      = cell % gateCount;
+
+   ivec3 radial0 = texelFetch(uRadialTexture, ivec2(0, row), 0).xyz;
+   ivec3 radial1 = texelFetch(uRadialTexture, ivec2(1, row), 0).xyz;
+
+   int coordinateRow     = radial0.x;
+   int nextCoordinateRow = radial0.y;
+   int startGate         = radial0.z;
+   int gateSize          = radial1.x;
+   int endGate           = radial1.y;
+   int dataGateCount     = radial1.z;
+
+   int gate = startGate + i * gateSize;
+
+   if (gate < 0 || gate + gateSize > endGate || i >= dataGateCount)
+   {
+      cull();
+      return;
+   }
+
+   int  corner       = kGateCorners[vertex];
+   int  rangeOffset  = corner & 1;
+   int  radialOffset = corner >> 1;
+   vec2 latLong;
+
+   if (!uSmoothingEnabled)
+   {
+      uint moment = texelFetch(uMomentTexture, ivec2(i, row), 0).r;
+
+      if (isHidden(moment))
+      {
+         cull();
+         return;
+      }
+
+      dataMoment = float(moment);
+      cfpMoment  = uCfpPresent ?
+                      float(texelFetch(uCfpTexture, ivec2(i, row), 0).r) :
+                      0.0f;
+   }
+   else
+   {
+      // Smoothing interpolates between the moments of this gate, the next
+      // gate, and the same gates of the next radial
+      int nextRow           = (row + 1) % radialCount;
+      int nextDataGateCount = texelFetch(uRadialTexture, ivec2(1, nextRow), 0).z;
+
+      if (gate == 0 || i + 1 >= dataGateCount || i + 1 >= nextDataGateCount)
+      {
+         cull();
+         return;
+      }
+
+      uint dm1 = texelFetch(uMomentTexture, ivec2(i, row), 0).r;
+      uint dm2 = texelFetch(uMomentTexture, ivec2(i + 1, row), 0).r;
+      uint dm3 = texelFetch(uMomentTexture, ivec2(i, nextRow), 0).r;
+      uint dm4 = texelFetch(uMomentTexture, ivec2(i + 1, nextRow), 0).r;
+
+      if (isHiddenSmoothed(dm1) && isHiddenSmoothed(dm2) &&
+          isHiddenSmoothed(dm3) && isHiddenSmoothed(dm4))
+      {
+         // Skip only if all data moments are hidden
+         cull();
+         return;
+      }
+
+      uint moment = texelFetch(uMomentTexture,
+                               ivec2(i + rangeOffset,
+                                     (radialOffset == 0) ? row : nextRow),
+                               0).r;
+
+      dataMoment = float(remapDataMoment(moment));
+      cfpMoment  = 0.0f;
+   }
+
+   int coordinateRadial = (radialOffset == 0) ? coordinateRow : nextCoordinateRow;
+
+   if (gate > 0)
+   {
+      // Coordinates are stored at the far edge of each base gate
+      int coordinateGate = gate - 1 + rangeOffset * gateSize;
+      latLong            = texelFetch(uCoordinateTexture,
+                                      ivec2(coordinateGate, coordinateRadial),
+                                      0).xy;
+   }
+   else if (vertex < 3)
+   {
+      // The origin gate is a single triangle from the radar site
+      latLong = (vertex == 0) ?
+                   uRadarLatLong :
+                   texelFetch(uCoordinateTexture, ivec2(0, coordinateRadial), 0).xy;
+   }
+   else
+   {
+      cull();
+      return;
+   }
+
+   vec2 p = latLngToScreenCoordinate(latLong) - uMapScreenCoord;
+
+   // Transform the position to screen coordinates
+   gl_Position = uMVPMatrix * vec4(p, 0.0f, 1.0f);
+}
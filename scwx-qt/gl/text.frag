@@ -0,0 +1,19 @@
+#version 330 core
+
+// Lower the default precision to medium
+precision mediump float;
+
+// Font atlas
+uniform sampler2D uTexture;
+
+// Texture coordinates are passed through the threshold geometry shader as a
+// vec3, and only the s and t components are used
+smooth in vec3 texCoord;
+smooth in vec4 color;
+
+layout (location = 0) out vec4 fragColor;
+
+void main()
+{
+   fragColor = texture(uTexture, texCoord.st) * color;
+}
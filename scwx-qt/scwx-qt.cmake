@@ -91,6 +91,7 @@ set(SRC_GL_DRAW source/scwx/qt/gl/draw/draw_item.cpp
                 source/scwx/qt/gl/draw/placefile_triangles.cpp
                 source/scwx/qt/gl/draw/rectangle.cpp)
 set(HDR_MANAGER source/scwx/qt/manager/alert_manager.hpp
+                source/scwx/qt/manager/color_table_manager.hpp
                 source/scwx/qt/manager/download_manager.hpp
                 source/scwx/qt/manager/font_manager.hpp
                 source/scwx/qt/manager/hotkey_manager.hpp
@@ -99,6 +100,7 @@ set(HDR_MANAGER source/scwx/qt/manager/alert_manager.hpp
                 source/scwx/qt/manager/placefile_manager.hpp
                 source/scwx/qt/manager/marker_manager.hpp
                 source/scwx/qt/manager/position_manager.hpp
+                source/scwx/qt/manager/radar_product_cache.hpp
                 source/scwx/qt/manager/radar_product_manager.hpp
                 source/scwx/qt/manager/radar_product_manager_notifier.hpp
                 source/scwx/qt/manager/resource_manager.hpp
@@ -108,6 +110,7 @@ set(HDR_MANAGER source/scwx/qt/manager/alert_manager.hpp
                 source/scwx/qt/manager/timeline_manager.hpp
                 source/scwx/qt/manager/update_manager.hpp)
 set(SRC_MANAGER source/scwx/qt/manager/alert_manager.cpp
+                source/scwx/qt/manager/color_table_manager.cpp
                 source/scwx/qt/manager/download_manager.cpp
                 source/scwx/qt/manager/font_manager.cpp
                 source/scwx/qt/manager/hotkey_manager.cpp
@@ -116,6 +119,7 @@ set(SRC_MANAGER source/scwx/qt/manager/alert_manager.cpp
                 source/scwx/qt/manager/placefile_manager.cpp
                 source/scwx/qt/manager/marker_manager.cpp
                 source/scwx/qt/manager/position_manager.cpp
+                source/scwx/qt/manager/radar_product_cache.cpp
                 source/scwx/qt/manager/radar_product_manager.cpp
                 source/scwx/qt/manager/radar_product_manager_notifier.cpp
                 source/scwx/qt/manager/resource_manager.cpp
@@ -227,6 +231,7 @@ set(HDR_TYPES source/scwx/qt/types/alert_types.hpp
               source/scwx/qt/types/qt_types.hpp
               source/scwx/qt/types/radar_product_record.hpp
               source/scwx/qt/types/text_event_key.hpp
+              source/scwx/qt/types/text_event_store.hpp
               source/scwx/qt/types/text_types.hpp
               source/scwx/qt/types/texture_types.hpp
               source/scwx/qt/types/time_types.hpp
@@ -243,6 +248,7 @@ set(SRC_TYPES source/scwx/qt/types/alert_types.cpp
               source/scwx/qt/types/qt_types.cpp
               source/scwx/qt/types/radar_product_record.cpp
               source/scwx/qt/types/text_event_key.cpp
+              source/scwx/qt/types/text_event_store.cpp
               source/scwx/qt/types/text_types.cpp
               source/scwx/qt/types/texture_types.cpp
               source/scwx/qt/types/time_types.cpp
@@ -270,6 +276,7 @@ set(HDR_UI source/scwx/qt/ui/about_dialog.hpp
            source/scwx/qt/ui/placefile_dialog.hpp
            source/scwx/qt/ui/placefile_settings_widget.hpp
            source/scwx/qt/ui/marker_dialog.hpp
+           source/scwx/qt/ui/metrics_dialog.hpp
            source/scwx/qt/ui/marker_settings_widget.hpp
            source/scwx/qt/ui/progress_dialog.hpp
            source/scwx/qt/ui/radar_site_dialog.hpp
@@ -300,6 +307,7 @@ set(SRC_UI source/scwx/qt/ui/about_dialog.cpp
            source/scwx/qt/ui/placefile_dialog.cpp
            source/scwx/qt/ui/placefile_settings_widget.cpp
            source/scwx/qt/ui/marker_dialog.cpp
+           source/scwx/qt/ui/metrics_dialog.cpp
            source/scwx/qt/ui/marker_settings_widget.cpp
            source/scwx/qt/ui/progress_dialog.cpp
            source/scwx/qt/ui/radar_site_dialog.cpp
@@ -321,6 +329,7 @@ set(UI_UI  source/scwx/qt/ui/about_dialog.ui
            source/scwx/qt/ui/placefile_dialog.ui
            source/scwx/qt/ui/placefile_settings_widget.ui
            source/scwx/qt/ui/marker_dialog.ui
+           source/scwx/qt/ui/metrics_dialog.ui
            source/scwx/qt/ui/marker_settings_widget.ui
            source/scwx/qt/ui/progress_dialog.ui
            source/scwx/qt/ui/radar_site_dialog.ui
@@ -348,31 +357,47 @@ set(SRC_UI_SETUP source/scwx/qt/ui/setup/audio_codec_page.cpp
                  source/scwx/qt/ui/setup/map_provider_page.cpp
                  source/scwx/qt/ui/setup/setup_wizard.cpp
                  source/scwx/qt/ui/setup/welcome_page.cpp)
-set(HDR_UTIL source/scwx/qt/util/color.hpp
+set(HDR_UTIL source/scwx/qt/util/area_index.hpp
+             source/scwx/qt/util/azimuth_index.hpp
+             source/scwx/qt/util/color.hpp
+             source/scwx/qt/util/coordinate_cache.hpp
+             source/scwx/qt/util/distance_batch.hpp
              source/scwx/qt/util/file.hpp
              source/scwx/qt/util/geographic_lib.hpp
              source/scwx/qt/util/imgui.hpp
              source/scwx/qt/util/json.hpp
              source/scwx/qt/util/maplibre.hpp
              source/scwx/qt/util/network.hpp
+             source/scwx/qt/util/polar_sweep.hpp
+             source/scwx/qt/util/prepared_area.hpp
+             source/scwx/qt/util/spatial_index.hpp
              source/scwx/qt/util/streams.hpp
              source/scwx/qt/util/texture_atlas.hpp
              source/scwx/qt/util/q_file_buffer.hpp
              source/scwx/qt/util/q_file_input_stream.hpp
              source/scwx/qt/util/time.hpp
-             source/scwx/qt/util/tooltip.hpp)
-set(SRC_UTIL source/scwx/qt/util/color.cpp
+             source/scwx/qt/util/tooltip.hpp
+             source/scwx/qt/util/triangulate.hpp)
+set(SRC_UTIL source/scwx/qt/util/area_index.cpp
+             source/scwx/qt/util/azimuth_index.cpp
+             source/scwx/qt/util/color.cpp
+             source/scwx/qt/util/coordinate_cache.cpp
+             source/scwx/qt/util/distance_batch.cpp
              source/scwx/qt/util/file.cpp
              source/scwx/qt/util/geographic_lib.cpp
              source/scwx/qt/util/imgui.cpp
              source/scwx/qt/util/json.cpp
              source/scwx/qt/util/maplibre.cpp
              source/scwx/qt/util/network.cpp
+             source/scwx/qt/util/polar_sweep.cpp
+             source/scwx/qt/util/prepared_area.cpp
+             source/scwx/qt/util/spatial_index.cpp
              source/scwx/qt/util/texture_atlas.cpp
              source/scwx/qt/util/q_file_buffer.cpp
              source/scwx/qt/util/q_file_input_stream.cpp
              source/scwx/qt/util/time.cpp
-             source/scwx/qt/util/tooltip.cpp)
+             source/scwx/qt/util/tooltip.cpp
+             source/scwx/qt/util/triangulate.cpp)
 set(HDR_VIEW source/scwx/qt/view/level2_product_view.hpp
              source/scwx/qt/view/level3_product_view.hpp
              source/scwx/qt/view/level3_radial_view.hpp
@@ -397,6 +422,8 @@ set(SHADER_FILES gl/color.frag
                  gl/map_color.vert
                  gl/radar.frag
                  gl/radar.vert
+                 gl/radar_polar.vert
+                 gl/text.frag
                  gl/texture1d.frag
                  gl/texture1d.vert
                  gl/texture2d.frag
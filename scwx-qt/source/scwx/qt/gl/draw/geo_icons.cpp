@@ -1,12 +1,11 @@
 #include <scwx/qt/gl/draw/geo_icons.hpp>
 #include <scwx/qt/types/icon_types.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
-
 #include <boost/unordered/unordered_flat_map.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
 
@@ -94,6 +93,11 @@ public:
                                   std::vector<float>&          iconBuffer,
                                   std::vector<GLint>&          integerBuffer,
                                   std::vector<IconHoverEntry>& hoverIcons);
+   static util::SpatialIndex::Box HoverBox(const IconHoverEntry& entry);
+   static float                   HoverExtent(const IconHoverEntry& entry);
+   static void BuildHoverIndex(const std::vector<IconHoverEntry>& hoverIcons,
+                               util::SpatialIndex&                hoverIndex,
+                               float&                             maxExtent);
    void        UpdateTextureBuffer();
    void        UpdateModifiedIconBuffers();
    void        Update(bool textureAtlasChanged);
@@ -127,9 +131,16 @@ public:
 
    std::vector<float> textureBuffer_ {};
 
+   // Hover icons are indexed by valid icon index, and icons which cannot be
+   // hovered have a null draw item
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   util::SpatialIndex currentHoverIndex_ {};
+   util::SpatialIndex newHoverIndex_ {};
+   float              currentMaxHoverExtent_ {};
+   float              newMaxHoverExtent_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -338,6 +349,7 @@ void GeoIcons::Deinitialize()
    p->currentIconList_.clear();
    p->currentIconSheets_.clear();
    p->currentHoverIcons_.clear();
+   p->currentHoverIndex_.Clear();
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
@@ -396,6 +408,7 @@ void GeoIcons::StartIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newHoverIndex_.Clear();
 }
 
 std::shared_ptr<GeoIconDrawItem> GeoIcons::AddIcon()
@@ -520,6 +533,8 @@ void GeoIcons::FinishIcons()
    p->currentIconBuffer_.swap(p->newIconBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverIcons_.swap(p->newHoverIcons_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->currentMaxHoverExtent_ = p->newMaxHoverExtent_;
 
    // Clear the new buffers, except the full icon list (used to update buffers
    // without re-adding icons)
@@ -527,6 +542,7 @@ void GeoIcons::FinishIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newHoverIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -574,6 +590,9 @@ void GeoIcons::Impl::UpdateBuffers()
                          newHoverIcons_);
    }
 
+   // Bulk load the hover index
+   BuildHoverIndex(newHoverIcons_, newHoverIndex_, newMaxHoverExtent_);
+
    // All icons have been updated
    dirtyIcons_.clear();
 }
@@ -687,9 +706,12 @@ void GeoIcons::Impl::UpdateSingleBuffer(
       std::copy(integerData.begin(), integerData.end(), integerBufferPosition);
    }
 
-   auto hoverIt = std::find_if(hoverIcons.begin(),
-                               hoverIcons.end(),
-                               [&di](auto& entry) { return entry.di_ == di; });
+   if (iconIndex >= hoverIcons.size())
+   {
+      hoverIcons.resize(iconIndex + 1);
+   }
+
+   IconHoverEntry& hoverEntry = hoverIcons[iconIndex];
 
    if (di->visible_ && !di->hoverText_.empty())
    {
@@ -707,24 +729,48 @@ void GeoIcons::Impl::UpdateSingleBuffer(
       const glm::vec2 obl = rotate * glm::vec2 {lx, by};
       const glm::vec2 obr = rotate * glm::vec2 {rx, by};
 
-      if (hoverIt == hoverIcons.end())
-      {
-         hoverIcons.emplace_back(IconHoverEntry {di, sc, otl, otr, obl, obr});
-      }
-      else
-      {
-         hoverIt->otl_ = otl;
-         hoverIt->otr_ = otr;
-         hoverIt->obl_ = obl;
-         hoverIt->obr_ = obr;
-      }
+      hoverEntry = IconHoverEntry {di, sc, otl, otr, obl, obr};
    }
-   else if (hoverIt != hoverIcons.end())
+   else
    {
-      hoverIcons.erase(hoverIt);
+      hoverEntry = IconHoverEntry {};
    }
 }
 
+util::SpatialIndex::Box GeoIcons::Impl::HoverBox(const IconHoverEntry& entry)
+{
+   // The icon size is accounted for by the maximum hover extent
+   return {entry.p_, entry.p_};
+}
+
+float GeoIcons::Impl::HoverExtent(const IconHoverEntry& entry)
+{
+   return std::max({glm::length(entry.otl_),
+                    glm::length(entry.otr_),
+                    glm::length(entry.obl_),
+                    glm::length(entry.obr_)});
+}
+
+void GeoIcons::Impl::BuildHoverIndex(
+   const std::vector<IconHoverEntry>& hoverIcons,
+   util::SpatialIndex&                hoverIndex,
+   float&                             maxExtent)
+{
+   std::vector<util::SpatialIndex::Item> items {};
+   maxExtent = 0.0f;
+
+   for (std::size_t i = 0; i < hoverIcons.size(); ++i)
+   {
+      if (hoverIcons[i].di_ != nullptr)
+      {
+         items.emplace_back(i, HoverBox(hoverIcons[i]));
+         maxExtent = std::max(maxExtent, HoverExtent(hoverIcons[i]));
+      }
+   }
+
+   hoverIndex.Build(items);
+}
+
 void GeoIcons::Impl::UpdateTextureBuffer()
 {
    textureBuffer_.clear();
@@ -830,11 +876,30 @@ void GeoIcons::Impl::UpdateModifiedIconBuffers()
 
       auto iconIndex = std::distance(currentIconList_.cbegin(), it);
 
+      const IconHoverEntry previousEntry =
+         (static_cast<std::size_t>(iconIndex) < currentHoverIcons_.size()) ?
+            currentHoverIcons_[iconIndex] :
+            IconHoverEntry {};
+
       UpdateSingleBuffer(di,
                          iconIndex,
                          currentIconBuffer_,
                          currentIntegerBuffer_,
                          currentHoverIcons_);
+
+      // Move the hover entry within the index
+      const IconHoverEntry& entry = currentHoverIcons_[iconIndex];
+
+      if (previousEntry.di_ != nullptr)
+      {
+         currentHoverIndex_.Remove(iconIndex, HoverBox(previousEntry));
+      }
+      if (entry.di_ != nullptr)
+      {
+         currentHoverIndex_.Insert(iconIndex, HoverBox(entry));
+         currentMaxHoverExtent_ =
+            std::max(currentMaxHoverExtent_, HoverExtent(entry));
+      }
    }
 
    // Clear list of modified icons
@@ -907,6 +972,11 @@ bool GeoIcons::RunMousePicking(
 {
    std::unique_lock lock {p->iconMutex_};
 
+   if (p->currentHoverIndex_.empty())
+   {
+      return false;
+   }
+
    bool itemPicked = false;
 
    // Calculate map scale, remove width and height from original calculation
@@ -930,13 +1000,20 @@ bool GeoIcons::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable icon
+   // Only icons within the largest icon extent of the mouse cursor can be
+   // hovered
+   const std::vector<std::size_t> candidates = p->currentHoverIndex_.Query(
+      mouseCoords, p->currentMaxHoverExtent_ * std::max(scale.x, scale.y));
+
+   // For each pickable icon, icons drawn last are on top
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverIcons_.crbegin(),
-      p->currentHoverIcons_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& icon)
+      candidates.crbegin(),
+      candidates.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t iconIndex)
       {
+         const auto& icon = p->currentHoverIcons_[iconIndex];
+
          if ((
                 // Geo icon is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -990,10 +1067,11 @@ bool GeoIcons::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverIcons_.crend())
+   if (it != candidates.crend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverIcons_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
@@ -1,11 +1,10 @@
 #include <scwx/qt/gl/draw/geo_lines.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
-
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <units/angle.h>
 
@@ -92,6 +91,12 @@ public:
                            std::vector<GLint>&          integerBuffer,
                            std::vector<LineHoverEntry>& hoverLines);
 
+   static util::SpatialIndex::Box HoverBox(const LineHoverEntry& entry);
+   static float                   HoverExtent(const LineHoverEntry& entry);
+   static void BuildHoverIndex(const std::vector<LineHoverEntry>& hoverLines,
+                               util::SpatialIndex&                hoverIndex,
+                               float&                             maxExtent);
+
    std::shared_ptr<GlContext> context_;
 
    bool visible_ {true};
@@ -112,9 +117,16 @@ public:
    std::vector<float> newLinesBuffer_ {};
    std::vector<GLint> newIntegerBuffer_ {};
 
+   // Hover lines are indexed by line index, and lines which cannot be hovered
+   // have a null draw item
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   util::SpatialIndex currentHoverIndex_ {};
+   util::SpatialIndex newHoverIndex_ {};
+   float              currentMaxHoverExtent_ {};
+   float              newMaxHoverExtent_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -305,6 +317,7 @@ void GeoLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->currentHoverIndex_.Clear();
 }
 
 void GeoLines::SetVisible(bool visible)
@@ -319,6 +332,7 @@ void GeoLines::StartLines()
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newHoverIndex_.Clear();
 }
 
 std::shared_ptr<GeoLineDrawItem> GeoLines::AddLine()
@@ -444,12 +458,15 @@ void GeoLines::FinishLines()
    p->currentLinesBuffer_.swap(p->newLinesBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverLines_.swap(p->newHoverLines_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->currentMaxHoverExtent_ = p->newMaxHoverExtent_;
 
    // Clear the new buffers, except the full line list (used to update buffers
    // without re-adding lines)
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newHoverIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -463,6 +480,7 @@ void GeoLines::Impl::UpdateBuffers()
    newIntegerBuffer_.reserve(newLineList_.size() * kVerticesPerRectangle *
                              kIntegersPerVertex_);
    newHoverLines_.clear();
+   newHoverLines_.resize(newLineList_.size());
 
    for (std::size_t i = 0; i < newLineList_.size(); ++i)
    {
@@ -473,6 +491,9 @@ void GeoLines::Impl::UpdateBuffers()
          di, i, newLinesBuffer_, newIntegerBuffer_, newHoverLines_);
    }
 
+   // Bulk load the hover index
+   BuildHoverIndex(newHoverLines_, newHoverIndex_, newMaxHoverExtent_);
+
    // All lines have been updated
    dirtyLines_.clear();
 }
@@ -485,6 +506,14 @@ void GeoLines::Impl::UpdateModifiedLineBuffers()
    currentIntegerBuffer_.resize(currentLineList_.size() *
                                 kVerticesPerRectangle * kIntegersPerVertex_);
 
+   if (currentHoverLines_.size() != currentLineList_.size())
+   {
+      // Hover lines past the end of the list are no longer valid
+      currentHoverLines_.resize(currentLineList_.size());
+      BuildHoverIndex(
+         currentHoverLines_, currentHoverIndex_, currentMaxHoverExtent_);
+   }
+
    // Update buffers for modified lines
    for (auto& di : dirtyLines_)
    {
@@ -500,11 +529,27 @@ void GeoLines::Impl::UpdateModifiedLineBuffers()
 
       auto lineIndex = std::distance(currentLineList_.cbegin(), it);
 
+      const LineHoverEntry previousEntry = currentHoverLines_[lineIndex];
+
       UpdateSingleBuffer(di,
                          lineIndex,
                          currentLinesBuffer_,
                          currentIntegerBuffer_,
                          currentHoverLines_);
+
+      // Move the hover entry within the index
+      const LineHoverEntry& entry = currentHoverLines_[lineIndex];
+
+      if (previousEntry.di_ != nullptr)
+      {
+         currentHoverIndex_.Remove(lineIndex, HoverBox(previousEntry));
+      }
+      if (entry.di_ != nullptr)
+      {
+         currentHoverIndex_.Insert(lineIndex, HoverBox(entry));
+         currentMaxHoverExtent_ =
+            std::max(currentMaxHoverExtent_, HoverExtent(entry));
+      }
    }
 
    // Clear list of modified lines
@@ -620,9 +665,7 @@ void GeoLines::Impl::UpdateSingleBuffer(
       std::copy(integerData.begin(), integerData.end(), integerBufferPosition);
    }
 
-   auto hoverIt = std::find_if(hoverLines.begin(),
-                               hoverLines.end(),
-                               [&di](auto& entry) { return entry.di_ == di; });
+   LineHoverEntry& hoverEntry = hoverLines[lineIndex];
 
    if (di->visible_ && (!di->hoverText_.empty() ||
                         di->hoverCallback_ != nullptr || di->event_ != nullptr))
@@ -642,27 +685,49 @@ void GeoLines::Impl::UpdateSingleBuffer(
       const glm::vec2 obl = rotate * glm::vec2 {-hw, -hw};
       const glm::vec2 obr = rotate * glm::vec2 {+hw, -hw};
 
-      if (hoverIt == hoverLines.end())
-      {
-         hoverLines.emplace_back(
-            LineHoverEntry {di, sc1, sc2, otl, otr, obl, obr});
-      }
-      else
-      {
-         hoverIt->p1_  = sc1;
-         hoverIt->p2_  = sc2;
-         hoverIt->otl_ = otl;
-         hoverIt->otr_ = otr;
-         hoverIt->obl_ = obl;
-         hoverIt->obr_ = obr;
-      }
+      hoverEntry = LineHoverEntry {di, sc1, sc2, otl, otr, obl, obr};
    }
-   else if (hoverIt != hoverLines.end())
+   else
    {
-      hoverLines.erase(hoverIt);
+      hoverEntry = LineHoverEntry {};
    }
 }
 
+util::SpatialIndex::Box
+GeoLines::Impl::HoverBox(const LineHoverEntry& entry)
+{
+   // The line width is accounted for by the maximum hover extent
+   return {entry.p1_, entry.p2_};
+}
+
+float GeoLines::Impl::HoverExtent(const LineHoverEntry& entry)
+{
+   return std::max({glm::length(entry.otl_),
+                    glm::length(entry.otr_),
+                    glm::length(entry.obl_),
+                    glm::length(entry.obr_)});
+}
+
+void GeoLines::Impl::BuildHoverIndex(
+   const std::vector<LineHoverEntry>& hoverLines,
+   util::SpatialIndex&                hoverIndex,
+   float&                             maxExtent)
+{
+   std::vector<util::SpatialIndex::Item> items {};
+   maxExtent = 0.0f;
+
+   for (std::size_t i = 0; i < hoverLines.size(); ++i)
+   {
+      if (hoverLines[i].di_ != nullptr)
+      {
+         items.emplace_back(i, HoverBox(hoverLines[i]));
+         maxExtent = std::max(maxExtent, HoverExtent(hoverLines[i]));
+      }
+   }
+
+   hoverIndex.Build(items);
+}
+
 void GeoLines::Impl::Update()
 {
    UpdateModifiedLineBuffers();
@@ -700,6 +765,11 @@ bool GeoLines::RunMousePicking(
 {
    std::unique_lock lock {p->lineMutex_};
 
+   if (p->currentHoverIndex_.empty())
+   {
+      return false;
+   }
+
    bool itemPicked = false;
 
    // Calculate map scale, remove width and height from original calculation
@@ -723,13 +793,20 @@ bool GeoLines::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable line
+   // Only lines within the largest line width of the mouse cursor can be
+   // hovered
+   const std::vector<std::size_t> candidates = p->currentHoverIndex_.Query(
+      mouseCoords, p->currentMaxHoverExtent_ * std::max(scale.x, scale.y));
+
+   // For each pickable line, lines drawn last are on top
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverLines_.rbegin(),
-      p->currentHoverLines_.rend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& line)
+      candidates.crbegin(),
+      candidates.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t lineIndex)
       {
+         const auto& line = p->currentHoverLines_[lineIndex];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -785,24 +862,26 @@ bool GeoLines::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverLines_.crend())
+   if (it != candidates.crend())
    {
+      const auto& di = p->currentHoverLines_[*it].di_;
+
       itemPicked = true;
 
-      if (!it->di_->hoverText_.empty())
+      if (!di->hoverText_.empty())
       {
          // Show tooltip
-         util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+         util::tooltip::Show(di->hoverText_, mouseGlobalPos);
       }
-      else if (it->di_->hoverCallback_ != nullptr)
+      else if (di->hoverCallback_ != nullptr)
       {
-         it->di_->hoverCallback_(it->di_, mouseGlobalPos);
+         di->hoverCallback_(di, mouseGlobalPos);
       }
 
-      if (it->di_->event_ != nullptr)
+      if (di->event_ != nullptr)
       {
          // Register event handler
-         eventHandler = it->di_;
+         eventHandler = di;
       }
    }
 
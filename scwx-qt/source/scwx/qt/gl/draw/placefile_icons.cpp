@@ -1,10 +1,11 @@
 #include <scwx/qt/gl/draw/placefile_icons.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
+#include <unordered_map>
 
 #include <QDir>
 #include <QUrl>
@@ -76,6 +77,19 @@ public:
       glm::vec2 obr_;
    };
 
+   struct BufferRecord
+   {
+      std::shared_ptr<const gr::Placefile::IconDrawItem> di_ {};
+      std::shared_ptr<const gr::Placefile::IconFile>     iconFile_ {};
+      std::vector<float>                                 iconBuffer_ {};
+      std::vector<GLint>                                 integerBuffer_ {};
+      std::vector<IconHoverEntry>                        hoverIcons_ {};
+   };
+
+   // Buffered data of each icon, keyed by draw item
+   typedef std::unordered_map<const gr::Placefile::IconDrawItem*, BufferRecord>
+      BufferCache;
+
    explicit Impl(const std::shared_ptr<GlContext>& context) :
        context_ {context},
        shaderProgram_ {nullptr},
@@ -92,6 +106,7 @@ public:
 
    ~Impl() {}
 
+   void AppendBuffers(const BufferRecord& record);
    void UpdateBuffers();
    void UpdateTextureBuffer();
    void Update(bool textureAtlasChanged);
@@ -126,6 +141,14 @@ public:
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   BufferCache currentBufferCache_ {};
+   BufferCache newBufferCache_ {};
+
+   util::SpatialIndex currentHoverIndex_ {};
+   util::SpatialIndex newHoverIndex_ {};
+   float              currentMaxHoverExtent_ {};
+   float              newMaxHoverExtent_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -321,6 +344,7 @@ void PlacefileIcons::Deinitialize()
    p->currentIconList_.clear();
    p->currentIconFiles_.clear();
    p->currentHoverIcons_.clear();
+   p->currentHoverIndex_.Clear();
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
@@ -366,6 +390,8 @@ void PlacefileIcons::StartIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newHoverIndex_.Clear();
+   p->newBufferCache_.clear();
 }
 
 void PlacefileIcons::SetIconFiles(
@@ -410,6 +436,11 @@ void PlacefileIcons::FinishIcons()
    p->currentIconBuffer_.swap(p->newIconBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverIcons_.swap(p->newHoverIcons_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->currentMaxHoverExtent_ = p->newMaxHoverExtent_;
+
+   // Only keep the buffered data of the current icons
+   p->currentBufferCache_.swap(p->newBufferCache_);
 
    // Clear the new buffers
    p->newIconList_.clear();
@@ -418,6 +449,8 @@ void PlacefileIcons::FinishIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newHoverIndex_.Clear();
+   p->newBufferCache_.clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -454,6 +487,22 @@ void PlacefileIcons::Impl::UpdateBuffers()
       // Icon is valid, add to valid icon list
       newValidIconList_.push_back(di);
 
+      // Reuse the buffered data of an icon carried over from the previous
+      // load, unless its icon file has changed
+      auto recordIt = currentBufferCache_.find(di.get());
+      if (recordIt != currentBufferCache_.cend() &&
+          *recordIt->second.iconFile_ == *icon.iconFile_)
+      {
+         auto result =
+            newBufferCache_.insert(currentBufferCache_.extract(recordIt));
+         AppendBuffers(result.position->second);
+         continue;
+      }
+
+      const std::size_t iconStart    = newIconBuffer_.size();
+      const std::size_t integerStart = newIntegerBuffer_.size();
+      const std::size_t hoverStart   = newHoverIcons_.size();
+
       // Threshold value
       units::length::nautical_miles<double> threshold = di->threshold_;
       GLint thresholdValue = static_cast<GLint>(std::round(threshold.value()));
@@ -549,7 +598,54 @@ void PlacefileIcons::Impl::UpdateBuffers()
          newHoverIcons_.emplace_back(
             IconHoverEntry {di, sc, otl, otr, obl, obr});
       }
+
+      newBufferCache_.insert_or_assign(
+         di.get(),
+         BufferRecord {
+            di,
+            icon.iconFile_,
+            std::vector<float>(newIconBuffer_.cbegin() +
+                                  static_cast<std::ptrdiff_t>(iconStart),
+                               newIconBuffer_.cend()),
+            std::vector<GLint>(newIntegerBuffer_.cbegin() +
+                                  static_cast<std::ptrdiff_t>(integerStart),
+                               newIntegerBuffer_.cend()),
+            std::vector<IconHoverEntry>(
+               newHoverIcons_.cbegin() +
+                  static_cast<std::ptrdiff_t>(hoverStart),
+               newHoverIcons_.cend())});
    }
+
+   // Index hover icons by location, the icon size is accounted for by the
+   // maximum hover extent
+   std::vector<util::SpatialIndex::Box> hoverBoxes {};
+   hoverBoxes.reserve(newHoverIcons_.size());
+   newMaxHoverExtent_ = 0.0f;
+
+   for (auto& icon : newHoverIcons_)
+   {
+      hoverBoxes.push_back({icon.p_, icon.p_});
+      newMaxHoverExtent_ = std::max({newMaxHoverExtent_,
+                                     glm::length(icon.otl_),
+                                     glm::length(icon.otr_),
+                                     glm::length(icon.obl_),
+                                     glm::length(icon.obr_)});
+   }
+
+   newHoverIndex_.Build(hoverBoxes);
+}
+
+void PlacefileIcons::Impl::AppendBuffers(const BufferRecord& record)
+{
+   newIconBuffer_.insert(newIconBuffer_.end(),
+                         record.iconBuffer_.cbegin(),
+                         record.iconBuffer_.cend());
+   newIntegerBuffer_.insert(newIntegerBuffer_.end(),
+                            record.integerBuffer_.cbegin(),
+                            record.integerBuffer_.cend());
+   newHoverIcons_.insert(newHoverIcons_.end(),
+                         record.hoverIcons_.cbegin(),
+                         record.hoverIcons_.cend());
 }
 
 void PlacefileIcons::Impl::UpdateTextureBuffer()
@@ -698,6 +794,11 @@ bool PlacefileIcons::RunMousePicking(
 {
    std::unique_lock lock {p->iconMutex_};
 
+   if (p->currentHoverIndex_.empty())
+   {
+      return false;
+   }
+
    bool itemPicked = false;
 
    // Calculate map scale, remove width and height from original calculation
@@ -721,13 +822,20 @@ bool PlacefileIcons::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable icon
+   // Only icons within the largest icon extent of the mouse cursor can be
+   // hovered
+   const std::vector<std::size_t> candidates = p->currentHoverIndex_.Query(
+      mouseCoords, p->currentMaxHoverExtent_ * std::max(scale.x, scale.y));
+
+   // For each pickable icon, icons drawn last are on top
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverIcons_.crbegin(),
-      p->currentHoverIcons_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& icon)
+      candidates.crbegin(),
+      candidates.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t hoverIndex)
       {
+         const auto& icon = p->currentHoverIcons_[hoverIndex];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -781,10 +889,11 @@ bool PlacefileIcons::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverIcons_.crend())
+   if (it != candidates.crend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverIcons_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
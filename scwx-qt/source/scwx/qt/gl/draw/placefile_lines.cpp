@@ -1,10 +1,11 @@
 #include <scwx/qt/gl/draw/placefile_lines.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
+#include <unordered_map>
 
 namespace scwx
 {
@@ -42,6 +43,18 @@ public:
       glm::vec2 obr_;
    };
 
+   struct BufferRecord
+   {
+      std::shared_ptr<const gr::Placefile::LineDrawItem> di_ {};
+      std::vector<float>                                 linesBuffer_ {};
+      std::vector<GLint>                                 integerBuffer_ {};
+      std::vector<LineHoverEntry>                        hoverLines_ {};
+   };
+
+   // Buffered data of each line, keyed by draw item
+   typedef std::unordered_map<const gr::Placefile::LineDrawItem*, BufferRecord>
+      BufferCache;
+
    explicit Impl(const std::shared_ptr<GlContext>& context) :
        context_ {context},
        shaderProgram_ {nullptr},
@@ -70,6 +83,8 @@ public:
                    bool                                bufferHover = false);
    void
    UpdateBuffers(const std::shared_ptr<const gr::Placefile::LineDrawItem>& di);
+   void AppendBuffers(const BufferRecord& record);
+   void UpdateHoverIndex();
    void Update();
 
    std::shared_ptr<GlContext> context_;
@@ -92,6 +107,14 @@ public:
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   BufferCache currentBufferCache_ {};
+   BufferCache newBufferCache_ {};
+
+   util::SpatialIndex currentHoverIndex_ {};
+   util::SpatialIndex newHoverIndex_ {};
+   float              currentMaxHoverExtent_ {};
+   float              newMaxHoverExtent_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -270,6 +293,7 @@ void PlacefileLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->currentHoverIndex_.Clear();
 }
 
 void PlacefileLines::StartLines()
@@ -278,6 +302,8 @@ void PlacefileLines::StartLines()
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newHoverIndex_.Clear();
+   p->newBufferCache_.clear();
 
    p->newNumLines_ = 0u;
 }
@@ -294,17 +320,27 @@ void PlacefileLines::AddLine(
 
 void PlacefileLines::FinishLines()
 {
+   // Index hover lines
+   p->UpdateHoverIndex();
+
    std::unique_lock lock {p->lineMutex_};
 
    // Swap buffers
    p->currentLinesBuffer_.swap(p->newLinesBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverLines_.swap(p->newHoverLines_);
+   std::swap(p->currentHoverIndex_, p->newHoverIndex_);
+   p->currentMaxHoverExtent_ = p->newMaxHoverExtent_;
+
+   // Only keep the buffered data of the current lines
+   p->currentBufferCache_.swap(p->newBufferCache_);
 
    // Clear the new buffers
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newHoverIndex_.Clear();
+   p->newBufferCache_.clear();
 
    // Update the number of lines
    p->currentNumLines_ = p->newNumLines_;
@@ -318,6 +354,21 @@ void PlacefileLines::FinishLines()
 void PlacefileLines::Impl::UpdateBuffers(
    const std::shared_ptr<const gr::Placefile::LineDrawItem>& di)
 {
+   // Reuse the buffered data of a line from the previous load. Unchanged draw
+   // items are carried over from the previous load, so the draw item
+   // identifies the line.
+   auto it = currentBufferCache_.find(di.get());
+   if (it != currentBufferCache_.cend())
+   {
+      auto result = newBufferCache_.insert(currentBufferCache_.extract(it));
+      AppendBuffers(result.position->second);
+      return;
+   }
+
+   const std::size_t linesStart   = newLinesBuffer_.size();
+   const std::size_t integerStart = newIntegerBuffer_.size();
+   const std::size_t hoverStart   = newHoverLines_.size();
+
    // Threshold value
    units::length::nautical_miles<double> threshold = di->threshold_;
    GLint thresholdValue = static_cast<GLint>(std::round(threshold.value()));
@@ -375,6 +426,33 @@ void PlacefileLines::Impl::UpdateBuffers(
                  startTime,
                  endTime);
    }
+
+   newBufferCache_.insert_or_assign(
+      di.get(),
+      BufferRecord {
+         di,
+         std::vector<float>(newLinesBuffer_.cbegin() +
+                               static_cast<std::ptrdiff_t>(linesStart),
+                            newLinesBuffer_.cend()),
+         std::vector<GLint>(newIntegerBuffer_.cbegin() +
+                               static_cast<std::ptrdiff_t>(integerStart),
+                            newIntegerBuffer_.cend()),
+         std::vector<LineHoverEntry>(newHoverLines_.cbegin() +
+                                        static_cast<std::ptrdiff_t>(hoverStart),
+                                     newHoverLines_.cend())});
+}
+
+void PlacefileLines::Impl::AppendBuffers(const BufferRecord& record)
+{
+   newLinesBuffer_.insert(newLinesBuffer_.end(),
+                          record.linesBuffer_.cbegin(),
+                          record.linesBuffer_.cend());
+   newIntegerBuffer_.insert(newIntegerBuffer_.end(),
+                            record.integerBuffer_.cbegin(),
+                            record.integerBuffer_.cend());
+   newHoverLines_.insert(newHoverLines_.end(),
+                         record.hoverLines_.cbegin(),
+                         record.hoverLines_.cend());
 }
 
 void PlacefileLines::Impl::BufferLine(
@@ -470,6 +548,27 @@ void PlacefileLines::Impl::BufferLine(
    }
 }
 
+void PlacefileLines::Impl::UpdateHoverIndex()
+{
+   // Index hover lines by their end points, the line width is accounted for by
+   // the maximum hover extent
+   std::vector<util::SpatialIndex::Box> hoverBoxes {};
+   hoverBoxes.reserve(newHoverLines_.size());
+   newMaxHoverExtent_ = 0.0f;
+
+   for (auto& line : newHoverLines_)
+   {
+      hoverBoxes.push_back({line.p1_, line.p2_});
+      newMaxHoverExtent_ = std::max({newMaxHoverExtent_,
+                                     glm::length(line.otl_),
+                                     glm::length(line.otr_),
+                                     glm::length(line.obl_),
+                                     glm::length(line.obr_)});
+   }
+
+   newHoverIndex_.Build(hoverBoxes);
+}
+
 void PlacefileLines::Impl::Update()
 {
    // If the placefile has been updated
@@ -505,6 +604,11 @@ bool PlacefileLines::RunMousePicking(
 {
    std::unique_lock lock {p->lineMutex_};
 
+   if (p->currentHoverIndex_.empty())
+   {
+      return false;
+   }
+
    bool itemPicked = false;
 
    // Calculate map scale, remove width and height from original calculation
@@ -528,13 +632,20 @@ bool PlacefileLines::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable line
+   // Only lines within the largest line width of the mouse cursor can be
+   // hovered
+   const std::vector<std::size_t> candidates = p->currentHoverIndex_.Query(
+      mouseCoords, p->currentMaxHoverExtent_ * std::max(scale.x, scale.y));
+
+   // For each pickable line, lines drawn last are on top
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverLines_.crbegin(),
-      p->currentHoverLines_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& line)
+      candidates.crbegin(),
+      candidates.crend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t hoverIndex)
       {
+         const auto& line = p->currentHoverLines_[hoverIndex];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -590,10 +701,11 @@ bool PlacefileLines::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverLines_.crend())
+   if (it != candidates.crend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverLines_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
@@ -1,11 +1,14 @@
 #include <scwx/qt/gl/draw/placefile_polygons.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/triangulate.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <mutex>
+#include <unordered_map>
 
 #include <GL/glu.h>
 #include <boost/container/stable_vector.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #if defined(_WIN32)
 typedef void (*_GLUfuncptr)(void);
@@ -39,6 +42,9 @@ static constexpr std::size_t kTessVertexB_       = 7;
 static constexpr std::size_t kTessVertexA_       = 8;
 static constexpr std::size_t kTessVertexSize_    = kTessVertexA_ + 1;
 
+// Larger polygons are tessellated by GLU, as ear clipping is quadratic
+static constexpr std::size_t kMaxEarClipVertices_ = 1024u;
+
 typedef std::array<GLdouble, kTessVertexSize_> TessVertexArray;
 
 class PlacefilePolygons::Impl
@@ -77,10 +83,28 @@ public:
 
    ~Impl() { gluDeleteTess(tessellator_); }
 
+   struct TessellationRecord
+   {
+      std::shared_ptr<const gr::Placefile::PolygonDrawItem> di_ {};
+      std::vector<GLfloat>                                  buffer_ {};
+   };
+
+   // Tessellated vertex data, keyed by polygon content hash
+   typedef std::unordered_multimap<std::size_t, TessellationRecord>
+      TessellationCache;
+
    void Update();
 
+   void AddPolygon(const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di);
+   void BufferVertex(const GLdouble* data);
    void Tessellate(const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di);
 
+   static const std::vector<GLfloat>*
+   FindTessellation(const TessellationCache&              cache,
+                    std::size_t                           hash,
+                    const gr::Placefile::PolygonDrawItem& di);
+   static std::size_t PolygonHash(const gr::Placefile::PolygonDrawItem& di);
+
    static void TessellateCombineCallback(GLdouble coords[3],
                                          void*    vertexData[4],
                                          GLfloat  weight[4],
@@ -104,6 +128,9 @@ public:
    std::vector<GLfloat> newBuffer_ {};
    std::vector<GLint>   newIntegerBuffer_ {};
 
+   TessellationCache currentTessellationCache_ {};
+   TessellationCache newTessellationCache_ {};
+
    GLUtesselator* tessellator_;
 
    std::shared_ptr<ShaderProgram> shaderProgram_;
@@ -282,6 +309,7 @@ void PlacefilePolygons::StartPolygons()
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newTessellationCache_.clear();
 }
 
 void PlacefilePolygons::AddPolygon(
@@ -289,7 +317,7 @@ void PlacefilePolygons::AddPolygon(
 {
    if (di != nullptr)
    {
-      p->Tessellate(di);
+      p->AddPolygon(di);
    }
 }
 
@@ -301,9 +329,13 @@ void PlacefilePolygons::FinishPolygons()
    p->currentBuffer_.swap(p->newBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
 
+   // Only keep tessellations of the current polygons
+   p->currentTessellationCache_.swap(p->newTessellationCache_);
+
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newTessellationCache_.clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -338,15 +370,9 @@ void PlacefilePolygons::Impl::Update()
    }
 }
 
-void PlacefilePolygons::Impl::Tessellate(
+void PlacefilePolygons::Impl::AddPolygon(
    const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di)
 {
-   // Vertex storage
-   boost::container::stable_vector<TessVertexArray> vertices {};
-
-   // Default color to "Color" statement
-   boost::gil::rgba8_pixel_t lastColor = di->color_;
-
    // Current threshold
    units::length::nautical_miles<double> threshold = di->threshold_;
    currentThreshold_ = static_cast<GLint>(std::round(threshold.value()));
@@ -361,12 +387,60 @@ void PlacefilePolygons::Impl::Tessellate(
                             di->endTime_.time_since_epoch())
                             .count());
 
-   gluTessBeginPolygon(tessellator_, this);
+   const std::size_t hash        = PolygonHash(*di);
+   const std::size_t bufferStart = newBuffer_.size();
 
-   for (auto& contour : di->contours_)
+   // Reuse the tessellation of an identical polygon in the current load, or
+   // from the previous load
+   const std::vector<GLfloat>* tessellation =
+      FindTessellation(newTessellationCache_, hash, *di);
+   const bool cached = (tessellation != nullptr);
+
+   if (tessellation == nullptr)
    {
-      gluTessBeginContour(tessellator_);
+      tessellation = FindTessellation(currentTessellationCache_, hash, *di);
+   }
 
+   if (tessellation != nullptr)
+   {
+      newBuffer_.insert(
+         newBuffer_.end(), tessellation->cbegin(), tessellation->cend());
+
+      for (std::size_t i = 0; i < tessellation->size() / kPointsPerVertex; ++i)
+      {
+         newIntegerBuffer_.insert(
+            newIntegerBuffer_.end(),
+            {currentThreshold_, currentStartTime_, currentEndTime_});
+      }
+   }
+   else
+   {
+      Tessellate(di);
+   }
+
+   if (!cached)
+   {
+      newTessellationCache_.emplace(
+         hash,
+         TessellationRecord {
+            di,
+            std::vector<GLfloat>(
+               newBuffer_.cbegin() + static_cast<std::ptrdiff_t>(bufferStart),
+               newBuffer_.cend())});
+   }
+}
+
+void PlacefilePolygons::Impl::Tessellate(
+   const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di)
+{
+   // Vertex storage
+   boost::container::stable_vector<TessVertexArray> vertices {};
+
+   // Default color to "Color" statement
+   boost::gil::rgba8_pixel_t lastColor = di->color_;
+
+   for (auto& contour : di->contours_)
+   {
       for (auto& element : contour)
       {
          // Calculate screen coordinate
@@ -380,19 +454,56 @@ void PlacefilePolygons::Impl::Tessellate(
          }
 
          // Add vertex to temporary storage
-         auto& vertex =
-            vertices.emplace_back(TessVertexArray {screenCoordinate.x,
-                                                   screenCoordinate.y,
-                                                   0.0, // z
-                                                   element.x_,
-                                                   element.y_,
-                                                   lastColor[0] / 255.0,
-                                                   lastColor[1] / 255.0,
-                                                   lastColor[2] / 255.0,
-                                                   lastColor[3] / 255.0});
+         vertices.emplace_back(TessVertexArray {screenCoordinate.x,
+                                                screenCoordinate.y,
+                                                0.0, // z
+                                                element.x_,
+                                                element.y_,
+                                                lastColor[0] / 255.0,
+                                                lastColor[1] / 255.0,
+                                                lastColor[2] / 255.0,
+                                                lastColor[3] / 255.0});
+      }
+   }
+
+   // Triangulate a single contour by ear clipping, if it is simple
+   if (di->contours_.size() == 1 && vertices.size() <= kMaxEarClipVertices_)
+   {
+      std::vector<glm::vec2> points {};
+      points.reserve(vertices.size());
+
+      for (auto& vertex : vertices)
+      {
+         points.emplace_back(
+            static_cast<float>(vertex[kTessVertexScreenX_]),
+            static_cast<float>(vertex[kTessVertexScreenY_]));
+      }
 
+      auto triangles = util::TriangulateSimplePolygon(points);
+      if (triangles.has_value())
+      {
+         for (auto index : *triangles)
+         {
+            BufferVertex(vertices[index].data());
+         }
+
+         return;
+      }
+   }
+
+   // Tessellate the polygon with GLU
+   auto vertexIt = vertices.begin();
+
+   gluTessBeginPolygon(tessellator_, this);
+
+   for (auto& contour : di->contours_)
+   {
+      gluTessBeginContour(tessellator_);
+
+      for (std::size_t i = 0; i < contour.size(); ++i, ++vertexIt)
+      {
          // Tessellate vertex
-         gluTessVertex(tessellator_, vertex.data(), vertex.data());
+         gluTessVertex(tessellator_, vertexIt->data(), vertexIt->data());
       }
 
       gluTessEndContour(tessellator_);
@@ -404,13 +515,72 @@ void PlacefilePolygons::Impl::Tessellate(
    tessCombineBuffer_.clear();
 
    // Remove extra vertices that don't correspond to a full triangle
-   while (newBuffer_.size() % kVerticesPerTriangle != 0)
+   while (newBuffer_.size() % (kVerticesPerTriangle * kPointsPerVertex) != 0)
    {
       newBuffer_.pop_back();
+   }
+   while (newIntegerBuffer_.size() %
+             (kVerticesPerTriangle * kIntegersPerVertex_) !=
+          0)
+   {
       newIntegerBuffer_.pop_back();
    }
 }
 
+const std::vector<GLfloat>* PlacefilePolygons::Impl::FindTessellation(
+   const TessellationCache&              cache,
+   std::size_t                           hash,
+   const gr::Placefile::PolygonDrawItem& di)
+{
+   auto range = cache.equal_range(hash);
+
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      const auto& other = *it->second.di_;
+
+      if (other.color_ == di.color_ && other.contours_ == di.contours_)
+      {
+         return &it->second.buffer_;
+      }
+   }
+
+   return nullptr;
+}
+
+std::size_t
+PlacefilePolygons::Impl::PolygonHash(const gr::Placefile::PolygonDrawItem& di)
+{
+   std::size_t seed = 0;
+
+   for (std::size_t i = 0; i < 4; ++i)
+   {
+      boost::hash_combine(seed, di.color_[i]);
+   }
+
+   for (auto& contour : di.contours_)
+   {
+      boost::hash_combine(seed, contour.size());
+
+      for (auto& element : contour)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+         boost::hash_combine(seed, element.x_);
+         boost::hash_combine(seed, element.y_);
+
+         if (element.color_.has_value())
+         {
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+               boost::hash_combine(seed, element.color_.value()[i]);
+            }
+         }
+      }
+   }
+
+   return seed;
+}
+
 void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
                                                         void*    vertexData[4],
                                                         GLfloat  w[4],
@@ -458,20 +628,23 @@ void PlacefilePolygons::Impl::TessellateVertexCallback(void* vertexData,
    Impl*     self = static_cast<Impl*>(polygonData);
    GLdouble* data = static_cast<GLdouble*>(vertexData);
 
-   // Buffer vertex
-   self->newBuffer_.insert(self->newBuffer_.end(),
-                           {static_cast<float>(data[kTessVertexScreenX_]),
-                            static_cast<float>(data[kTessVertexScreenY_]),
-                            static_cast<float>(data[kTessVertexXOffset_]),
-                            static_cast<float>(data[kTessVertexYOffset_]),
-                            static_cast<float>(data[kTessVertexR_]),
-                            static_cast<float>(data[kTessVertexG_]),
-                            static_cast<float>(data[kTessVertexB_]),
-                            static_cast<float>(data[kTessVertexA_])});
-   self->newIntegerBuffer_.insert(self->newIntegerBuffer_.end(),
-                                  {self->currentThreshold_,
-                                   self->currentStartTime_,
-                                   self->currentEndTime_});
+   self->BufferVertex(data);
+}
+
+void PlacefilePolygons::Impl::BufferVertex(const GLdouble* data)
+{
+   newBuffer_.insert(newBuffer_.end(),
+                     {static_cast<float>(data[kTessVertexScreenX_]),
+                      static_cast<float>(data[kTessVertexScreenY_]),
+                      static_cast<float>(data[kTessVertexXOffset_]),
+                      static_cast<float>(data[kTessVertexYOffset_]),
+                      static_cast<float>(data[kTessVertexR_]),
+                      static_cast<float>(data[kTessVertexG_]),
+                      static_cast<float>(data[kTessVertexB_]),
+                      static_cast<float>(data[kTessVertexA_])});
+   newIntegerBuffer_.insert(
+      newIntegerBuffer_.end(),
+      {currentThreshold_, currentStartTime_, currentEndTime_});
 }
 
 void PlacefilePolygons::Impl::TessellateErrorCallback(GLenum errorCode)
@@ -1,13 +1,15 @@
 #include <scwx/qt/gl/draw/placefile_text.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/manager/placefile_manager.hpp>
+#include <scwx/qt/model/imgui_context_model.hpp>
 #include <scwx/qt/settings/text_settings.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <fmt/format.h>
 #include <imgui.h>
+#include <imgui_internal.h>
 #include <mbgl/util/constants.hpp>
 
 namespace scwx
@@ -22,45 +24,65 @@ namespace draw
 static const std::string logPrefix_ = "scwx::qt::gl::draw::placefile_text";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static constexpr std::size_t kVerticesPerTriangle  = 3;
+static constexpr std::size_t kVerticesPerRectangle = kVerticesPerTriangle * 2;
+static constexpr std::size_t kPointsPerVertex      = 9;
+static constexpr std::size_t kPointsPerTexCoord    = 3;
+
+// Threshold, start time, end time
+static constexpr std::size_t kIntegersPerVertex_ = 3;
+
+// Valid font numbers are from 1 to 8, 0 is the default font
+static constexpr std::size_t kMaxFontNumber_ = 8;
+
 class PlacefileText::Impl
 {
 public:
+   struct TextHoverEntry
+   {
+      std::shared_ptr<const gr::Placefile::TextDrawItem> di_;
+
+      glm::vec2 p_;
+      glm::vec2 center_;
+      glm::vec2 halfSize_;
+   };
+
    explicit Impl(const std::shared_ptr<GlContext>& context,
                  const std::string&                placefileName) :
-       context_ {context}, placefileName_ {placefileName}
+       context_ {context},
+       placefileName_ {placefileName},
+       shaderProgram_ {nullptr},
+       uMVPMatrixLocation_(GL_INVALID_INDEX),
+       uMapMatrixLocation_(GL_INVALID_INDEX),
+       uMapScreenCoordLocation_(GL_INVALID_INDEX),
+       uMapDistanceLocation_(GL_INVALID_INDEX),
+       uSelectedTimeLocation_(GL_INVALID_INDEX),
+       vao_ {GL_INVALID_INDEX},
+       vbo_ {GL_INVALID_INDEX},
+       numVertices_ {0},
+       numShadowVertices_ {0}
    {
    }
 
    ~Impl() {}
 
-   void RenderTextDrawItem(
-      const QMapLibre::CustomLayerRenderParameters&             params,
-      const std::shared_ptr<const gr::Placefile::TextDrawItem>& di);
-   void RenderText(const QMapLibre::CustomLayerRenderParameters& params,
-                   const std::string&                            text,
-                   const std::string&                            hoverText,
-                   boost::gil::rgba8_pixel_t                     color,
-                   float                                         x,
-                   float                                         y);
+   void AddGlyphs(const gr::Placefile::TextDrawItem& di,
+                  ImFont*                            font,
+                  const glm::vec2&                   topLeft,
+                  bool                               shadow);
+   void UpdateBuffers();
+   void Update();
 
    std::shared_ptr<GlContext> context_;
 
    std::string placefileName_;
 
+   bool dirty_ {false};
    bool thresholded_ {false};
 
    std::chrono::system_clock::time_point selectedTime_ {};
 
-   std::uint32_t textId_ {};
-   glm::vec2     mapScreenCoordLocation_ {};
-   float         mapScale_ {1.0f};
-   float         mapBearingCos_ {1.0f};
-   float         mapBearingSin_ {0.0f};
-   float         halfWidth_ {};
-   float         halfHeight_ {};
-   std::string   hoverText_ {};
-
-   units::length::nautical_miles<double> mapDistance_ {};
+   std::uint64_t fontsBuildCount_ {};
 
    std::mutex listMutex_ {};
    std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>> textList_ {};
@@ -68,6 +90,27 @@ public:
 
    std::vector<std::shared_ptr<types::ImGuiFont>> fonts_ {};
    std::vector<std::shared_ptr<types::ImGuiFont>> newFonts_ {};
+
+   std::vector<float> textBuffer_ {};
+   std::vector<float> textureBuffer_ {};
+   std::vector<GLint> integerBuffer_ {};
+
+   std::vector<TextHoverEntry> hoverText_ {};
+   util::SpatialIndex          hoverIndex_ {};
+   float                       maxHoverExtent_ {};
+
+   std::shared_ptr<ShaderProgram> shaderProgram_;
+   GLint                          uMVPMatrixLocation_;
+   GLint                          uMapMatrixLocation_;
+   GLint                          uMapScreenCoordLocation_;
+   GLint                          uMapDistanceLocation_;
+   GLint                          uSelectedTimeLocation_;
+
+   GLuint                vao_;
+   std::array<GLuint, 3> vbo_;
+
+   GLsizei numVertices_;
+   GLsizei numShadowVertices_;
 };
 
 PlacefileText::PlacefileText(const std::shared_ptr<GlContext>& context,
@@ -96,7 +139,103 @@ void PlacefileText::set_thresholded(bool thresholded)
    p->thresholded_ = thresholded;
 }
 
-void PlacefileText::Initialize() {}
+void PlacefileText::Initialize()
+{
+   gl::OpenGLFunctions& gl = p->context_->gl();
+
+   p->shaderProgram_ = p->context_->GetShaderProgram(
+      {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
+       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
+       {GL_FRAGMENT_SHADER, ":/gl/text.frag"}});
+
+   p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
+   p->uMapMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMapMatrix");
+   p->uMapScreenCoordLocation_ =
+      p->shaderProgram_->GetUniformLocation("uMapScreenCoord");
+   p->uMapDistanceLocation_ =
+      p->shaderProgram_->GetUniformLocation("uMapDistance");
+   p->uSelectedTimeLocation_ =
+      p->shaderProgram_->GetUniformLocation("uSelectedTime");
+
+   gl.glGenVertexArrays(1, &p->vao_);
+   gl.glGenBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+
+   gl.glBindVertexArray(p->vao_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aLatLong
+   gl.glVertexAttribPointer(0,
+                            2,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
+
+   // aXYOffset
+   gl.glVertexAttribPointer(1,
+                            2,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(2 * sizeof(float)));
+   gl.glEnableVertexAttribArray(1);
+
+   // aModulate
+   gl.glVertexAttribPointer(3,
+                            4,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(4 * sizeof(float)));
+   gl.glEnableVertexAttribArray(3);
+
+   // aAngle
+   gl.glVertexAttribPointer(4,
+                            1,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(8 * sizeof(float)));
+   gl.glEnableVertexAttribArray(4);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aTexCoord
+   gl.glVertexAttribPointer(2,
+                            3,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerTexCoord * sizeof(float),
+                            static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(2);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aThreshold
+   gl.glVertexAttribIPointer(5, //
+                             1,
+                             GL_INT,
+                             kIntegersPerVertex_ * sizeof(GLint),
+                             static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(5);
+
+   // aTimeRange
+   gl.glVertexAttribIPointer(6, //
+                             2,
+                             GL_INT,
+                             kIntegersPerVertex_ * sizeof(GLint),
+                             reinterpret_cast<void*>(1 * sizeof(GLint)));
+   gl.glEnableVertexAttribArray(6);
+
+   // aDisplayed
+   p->context_->gl30().glVertexAttribI1i(7, 1);
+
+   p->dirty_ = true;
+}
 
 void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
 {
@@ -104,157 +243,419 @@ void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
 
    if (!p->textList_.empty())
    {
-      // Reset text ID per frame
-      p->textId_ = 0;
-      p->hoverText_.clear();
-
-      // Update map screen coordinate and scale information
-      p->mapScreenCoordLocation_ = util::maplibre::LatLongToScreenCoordinate(
-         {params.latitude, params.longitude});
-      p->mapScale_ = std::pow(2.0, params.zoom) * mbgl::util::tileSize_D /
-                     mbgl::util::DEGREES_MAX;
-      p->mapBearingCos_ = cosf(params.bearing * common::kDegreesToRadians);
-      p->mapBearingSin_ = sinf(params.bearing * common::kDegreesToRadians);
-      p->halfWidth_     = params.width * 0.5f;
-      p->halfHeight_    = params.height * 0.5f;
-      p->mapDistance_   = util::maplibre::GetMapDistance(params);
-
-      for (auto& di : p->textList_)
+      gl::OpenGLFunctions& gl = p->context_->gl();
+
+      gl.glBindVertexArray(p->vao_);
+
+      p->Update();
+      p->shaderProgram_->Use();
+
+      // Text is not rotated with the map
+      UseDefaultProjection(params, p->uMVPMatrixLocation_);
+      UseMapProjection(
+         params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
+
+      if (p->thresholded_)
+      {
+         // If thresholding is enabled, set the map distance
+         units::length::nautical_miles<float> mapDistance =
+            util::maplibre::GetMapDistance(params);
+         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
+      }
+      else
       {
-         p->RenderTextDrawItem(params, di);
+         // If thresholding is disabled, set the map distance to 0
+         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
       }
+
+      // Selected time
+      std::chrono::system_clock::time_point selectedTime =
+         (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
+            std::chrono::system_clock::now() :
+            p->selectedTime_;
+      gl.glUniform1i(
+         p->uSelectedTimeLocation_,
+         static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                               selectedTime.time_since_epoch())
+                               .count()));
+
+      // Glyphs are sampled from the ImGui font atlas. The atlas texture is
+      // created by the ImGui OpenGL backend, in a shared context.
+      ImFontAtlas* fontAtlas =
+         model::ImGuiContextModel::Instance().font_atlas();
+      gl.glActiveTexture(GL_TEXTURE0);
+      gl.glBindTexture(GL_TEXTURE_2D, (GLuint)(std::intptr_t)fontAtlas->TexID);
+
+      // Drop shadows are buffered before the text, and are skipped if disabled
+      const GLint first = settings::TextSettings::Instance()
+                                .placefile_text_drop_shadow_enabled()
+                                .GetValue() ?
+                             0 :
+                             p->numShadowVertices_;
+
+      // Draw text
+      gl.glDrawArrays(GL_TRIANGLES, first, p->numVertices_ - first);
    }
 }
 
-void PlacefileText::Impl::RenderTextDrawItem(
-   const QMapLibre::CustomLayerRenderParameters&             params,
-   const std::shared_ptr<const gr::Placefile::TextDrawItem>& di)
+void PlacefileText::Deinitialize()
 {
-   // If no time has been selected, use the current time
-   std::chrono::system_clock::time_point selectedTime =
-      (selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
-         selectedTime_;
+   gl::OpenGLFunctions& gl = p->context_->gl();
+
+   gl.glDeleteVertexArrays(1, &p->vao_);
+   gl.glDeleteBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
 
-   const bool thresholdMet =
-      !thresholded_ || mapDistance_ <= di->threshold_ ||
-      (di->threshold_.value() < 0.0 && mapDistance_ >= -(di->threshold_));
+   std::unique_lock lock {p->listMutex_};
 
-   if (thresholdMet &&
-       (di->startTime_ == std::chrono::system_clock::time_point {} ||
-        (di->startTime_ <= selectedTime && selectedTime < di->endTime_)))
+   // Clear the text list
+   p->textList_.clear();
+   p->fonts_.clear();
+   p->textBuffer_.clear();
+   p->textureBuffer_.clear();
+   p->integerBuffer_.clear();
+   p->hoverText_.clear();
+   p->hoverIndex_.Clear();
+}
+
+void PlacefileText::Impl::AddGlyphs(const gr::Placefile::TextDrawItem& di,
+                                    ImFont*                            font,
+                                    const glm::vec2&                   topLeft,
+                                    bool                               shadow)
+{
+   // Threshold value
+   units::length::nautical_miles<double> threshold = di.threshold_;
+   GLint thresholdValue = static_cast<GLint>(std::round(threshold.value()));
+
+   // Start and end time
+   GLint startTime =
+      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                            di.startTime_.time_since_epoch())
+                            .count());
+   GLint endTime =
+      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                            di.endTime_.time_since_epoch())
+                            .count());
+
+   // Latitude and longitude coordinates in degrees
+   const float lat = static_cast<float>(di.latitude_);
+   const float lon = static_cast<float>(di.longitude_);
+
+   // Draw a drop shadow 1 pixel to the lower right, in black, with the original
+   // transparency level
+   const glm::vec2 shadowOffset = shadow ? glm::vec2 {1.0f, -1.0f} :
+                                           glm::vec2 {0.0f, 0.0f};
+
+   // Color
+   const float c0 = shadow ? 0.0f : di.color_[0] / 255.0f;
+   const float c1 = shadow ? 0.0f : di.color_[1] / 255.0f;
+   const float c2 = shadow ? 0.0f : di.color_[2] / 255.0f;
+   const float c3 = di.color_[3] / 255.0f;
+
+   // Text is not rotated
+   const float a = 0.0f;
+
+   const char* s    = di.text_.c_str();
+   const char* end  = s + di.text_.size();
+   float       penX = 0.0f;
+   float       penY = 0.0f;
+
+   while (s < end)
    {
-      const auto screenCoordinates = (util::maplibre::LatLongToScreenCoordinate(
-                                         {di->latitude_, di->longitude_}) -
-                                      mapScreenCoordLocation_) *
-                                     mapScale_;
-
-      // Rotate text according to map rotation
-      float rotatedX = screenCoordinates.x;
-      float rotatedY = screenCoordinates.y;
-      if (params.bearing != 0.0)
+      unsigned int c = static_cast<unsigned char>(*s);
+      if (c < 0x80u)
       {
-         rotatedX = screenCoordinates.x * mapBearingCos_ -
-                    screenCoordinates.y * mapBearingSin_;
-         rotatedY = screenCoordinates.x * mapBearingSin_ +
-                    screenCoordinates.y * mapBearingCos_;
+         ++s;
+      }
+      else
+      {
+         s += ImTextCharFromUtf8(&c, s, end);
       }
 
-      // Clamp font number to 0-8
-      std::size_t fontNumber = std::clamp<std::size_t>(di->fontNumber_, 0, 8);
-
-      // Set the font for the drop shadow and text
-      ImGui::PushFont(fonts_[fontNumber]->font());
+      if (c == '\n')
+      {
+         penX = 0.0f;
+         penY += font->FontSize;
+         continue;
+      }
+      else if (c == '\r')
+      {
+         continue;
+      }
 
-      if (settings::TextSettings::Instance()
-             .placefile_text_drop_shadow_enabled()
-             .GetValue())
+      const ImFontGlyph* glyph = font->FindGlyph(static_cast<ImWchar>(c));
+      if (glyph == nullptr)
       {
-         // Draw a drop shadow 1 pixel to the lower right, in black, with the
-         // original transparency level
-         RenderText(params,
-                    di->text_,
-                    {},
-                    boost::gil::rgba8_pixel_t {0, 0, 0, di->color_[3]},
-                    rotatedX + di->x_ + halfWidth_ + 1.0f,
-                    rotatedY + di->y_ + halfHeight_ - 1.0f);
+         continue;
       }
 
-      // Draw the text
-      RenderText(params,
-                 di->text_,
-                 di->hoverText_,
-                 di->color_,
-                 rotatedX + di->x_ + halfWidth_,
-                 rotatedY + di->y_ + halfHeight_);
+      if (glyph->Visible)
+      {
+         // Glyph offsets are relative to the top left of the text, with Y
+         // pointing down. Final offsets are in pixels, with Y pointing up.
+         const float lx = topLeft.x + shadowOffset.x + penX + glyph->X0;
+         const float rx = topLeft.x + shadowOffset.x + penX + glyph->X1;
+         const float ty = topLeft.y + shadowOffset.y - (penY + glyph->Y0);
+         const float by = topLeft.y + shadowOffset.y - (penY + glyph->Y1);
+
+         const float ls = glyph->U0;
+         const float rs = glyph->U1;
+         const float tt = glyph->V0;
+         const float bt = glyph->V1;
+
+         textBuffer_.insert(textBuffer_.end(),
+                            {
+                               // Glyph
+                               lat, lon, lx, by, c0, c1, c2, c3, a, // BL
+                               lat, lon, lx, ty, c0, c1, c2, c3, a, // TL
+                               lat, lon, rx, by, c0, c1, c2, c3, a, // BR
+                               lat, lon, rx, by, c0, c1, c2, c3, a, // BR
+                               lat, lon, rx, ty, c0, c1, c2, c3, a, // TR
+                               lat, lon, lx, ty, c0, c1, c2, c3, a  // TL
+                            });
+
+         // clang-format off
+         textureBuffer_.insert(
+            textureBuffer_.end(),
+            {
+               // Glyph
+               ls, bt, 0.0f, // BL
+               ls, tt, 0.0f, // TL
+               rs, bt, 0.0f, // BR
+               rs, bt, 0.0f, // BR
+               rs, tt, 0.0f, // TR
+               ls, tt, 0.0f  // TL
+            });
+         // clang-format on
+
+         for (std::size_t i = 0; i < kVerticesPerRectangle; ++i)
+         {
+            integerBuffer_.insert(integerBuffer_.end(),
+                                  {thresholdValue, startTime, endTime});
+         }
+      }
 
-      // Reset the font
-      ImGui::PopFont();
+      penX += glyph->AdvanceX;
    }
 }
 
-void PlacefileText::Impl::RenderText(
-   const QMapLibre::CustomLayerRenderParameters& params,
-   const std::string&                            text,
-   const std::string&                            hoverText,
-   boost::gil::rgba8_pixel_t                     color,
-   float                                         x,
-   float                                         y)
+void PlacefileText::Impl::UpdateBuffers()
 {
-   const std::string windowName {
-      fmt::format("PlacefileText-{}-{}", placefileName_, ++textId_)};
-
-   // Convert screen to ImGui coordinates
-   y = params.height - y;
-
-   // Setup "window" to hold text
-   ImGui::SetNextWindowPos(
-      ImVec2 {x, y}, ImGuiCond_Always, ImVec2 {0.5f, 0.5f});
-   ImGui::Begin(windowName.c_str(),
-                nullptr,
-                ImGuiWindowFlags_AlwaysAutoResize |
-                   ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoNav |
-                   ImGuiWindowFlags_NoBackground);
-
-   // Render text
-   ImGui::PushStyleColor(ImGuiCol_Text,
-                         IM_COL32(color[0], color[1], color[2], color[3]));
-   ImGui::TextUnformatted(text.c_str());
-   ImGui::PopStyleColor();
-
-   // Store hover text for mouse picking pass
-   if (!hoverText.empty() && ImGui::IsItemHovered())
+   textBuffer_.clear();
+   textureBuffer_.clear();
+   integerBuffer_.clear();
+   hoverText_.clear();
+   maxHoverExtent_ = 0.0f;
+
+   std::vector<util::SpatialIndex::Box> hoverBoxes {};
+
+   // Text size and location of each item, calculated once for both passes
+   struct TextLayout
    {
-      hoverText_ = hoverText;
+      ImFont*   font_;
+      glm::vec2 topLeft_;
+   };
+   std::vector<TextLayout> layouts {};
+   layouts.reserve(textList_.size());
+
+   for (auto& di : textList_)
+   {
+      // Clamp font number to 0-8
+      std::size_t fontNumber =
+         std::clamp<std::size_t>(di->fontNumber_, 0, kMaxFontNumber_);
+
+      ImFont* font = (fontNumber < fonts_.size() && fonts_[fontNumber]) ?
+                        fonts_[fontNumber]->font() :
+                        nullptr;
+
+      if (font == nullptr)
+      {
+         layouts.push_back({nullptr, {}});
+         continue;
+      }
+
+      // Text is centered on the X/Y offset from its location
+      const ImVec2 textSize = font->CalcTextSizeA(
+         font->FontSize, FLT_MAX, 0.0f, di->text_.c_str());
+
+      const glm::vec2 center {static_cast<float>(di->x_),
+                              static_cast<float>(di->y_)};
+      const glm::vec2 halfSize {textSize.x * 0.5f, textSize.y * 0.5f};
+
+      // Align the text to whole pixels
+      const glm::vec2 topLeft {std::roundf(center.x - halfSize.x),
+                               std::roundf(center.y + halfSize.y)};
+
+      layouts.push_back({font, topLeft});
+
+      if (!di->hoverText_.empty())
+      {
+         const auto sc = util::maplibre::LatLongToScreenCoordinate(
+            {di->latitude_, di->longitude_});
+
+         hoverText_.emplace_back(TextHoverEntry {di, sc, center, halfSize});
+         hoverBoxes.push_back({sc, sc});
+
+         maxHoverExtent_ = std::max(
+            maxHoverExtent_, glm::length(center) + glm::length(halfSize));
+      }
    }
 
-   // End window
-   ImGui::End();
+   // Buffer the drop shadows of all text before the text itself, so the drop
+   // shadows can be skipped when disabled
+   for (bool shadow : {true, false})
+   {
+      for (std::size_t i = 0; i < textList_.size(); ++i)
+      {
+         if (layouts[i].font_ != nullptr)
+         {
+            AddGlyphs(*textList_[i],
+                      layouts[i].font_,
+                      layouts[i].topLeft_,
+                      shadow);
+         }
+      }
+
+      if (shadow)
+      {
+         numShadowVertices_ =
+            static_cast<GLsizei>(textBuffer_.size() / kPointsPerVertex);
+      }
+   }
+
+   hoverIndex_.Build(hoverBoxes);
+
+   logger_->trace(
+      "{}: {} text items buffered", placefileName_, textList_.size());
 }
 
-void PlacefileText::Deinitialize()
+void PlacefileText::Impl::Update()
 {
-   std::unique_lock lock {p->listMutex_};
+   gl::OpenGLFunctions& gl = context_->gl();
 
-   // Clear the text list
-   p->textList_.clear();
+   // Glyph texture coordinates change when the font atlas is rebuilt
+   const std::uint64_t fontsBuildCount =
+      manager::FontManager::Instance().imgui_fonts_build_count();
+
+   // If buffers need updating
+   if (dirty_ || fontsBuildCount_ != fontsBuildCount)
+   {
+      UpdateBuffers();
+
+      // Buffer vertex data
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      sizeof(float) * textBuffer_.size(),
+                      textBuffer_.data(),
+                      GL_DYNAMIC_DRAW);
+
+      // Buffer texture data
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      sizeof(float) * textureBuffer_.size(),
+                      textureBuffer_.data(),
+                      GL_DYNAMIC_DRAW);
+
+      // Buffer threshold data
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[2]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      sizeof(GLint) * integerBuffer_.size(),
+                      integerBuffer_.data(),
+                      GL_DYNAMIC_DRAW);
+
+      numVertices_ =
+         static_cast<GLsizei>(textBuffer_.size() / kPointsPerVertex);
+   }
+
+   fontsBuildCount_ = fontsBuildCount;
+   dirty_           = false;
 }
 
 bool PlacefileText::RunMousePicking(
-   const QMapLibre::CustomLayerRenderParameters& /* params */,
+   const QMapLibre::CustomLayerRenderParameters& params,
    const QPointF& /* mouseLocalPos */,
-   const QPointF& mouseGlobalPos,
-   const glm::vec2& /* mouseCoords */,
+   const QPointF&   mouseGlobalPos,
+   const glm::vec2& mouseCoords,
    const common::Coordinate& /* mouseGeoCoords */,
    std::shared_ptr<types::EventHandler>& /* eventHandler */)
 {
+   std::unique_lock lock {p->listMutex_};
+
+   if (p->hoverIndex_.empty())
+   {
+      return false;
+   }
+
    bool itemPicked = false;
 
-   // Create tooltip for hover text
-   if (!p->hoverText_.empty())
+   // Map scale, in pixels per map screen coordinate
+   const float mapScale = std::pow(2.0, params.zoom) * mbgl::util::tileSize_D /
+                          mbgl::util::DEGREES_MAX;
+   const float mapBearingCos = cosf(params.bearing * common::kDegreesToRadians);
+   const float mapBearingSin = sinf(params.bearing * common::kDegreesToRadians);
+
+   units::length::meters<double> mapDistance =
+      (p->thresholded_) ? util::maplibre::GetMapDistance(params) :
+                          units::length::meters<double> {0.0};
+
+   // If no time has been selected, use the current time
+   std::chrono::system_clock::time_point selectedTime =
+      (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
+         std::chrono::system_clock::now() :
+         p->selectedTime_;
+
+   // Only text located within the largest text extent of the mouse cursor can
+   // be hovered
+   const std::vector<std::size_t> candidates =
+      p->hoverIndex_.Query(mouseCoords, p->maxHoverExtent_ / mapScale);
+
+   // Text drawn last is on top
+   for (auto it = candidates.crbegin(); it != candidates.crend(); ++it)
    {
-      itemPicked = true;
-      util::tooltip::Show(p->hoverText_, mouseGlobalPos);
+      const auto& text = p->hoverText_[*it];
+
+      if ((
+             // Placefile is thresholded
+             mapDistance > units::length::meters<double> {0.0} &&
+
+             // Placefile threshold is < 999 nmi
+             static_cast<int>(std::round(
+                units::length::nautical_miles<double> {text.di_->threshold_}
+                   .value())) < 999 &&
+
+             // Map distance is beyond/within the threshold
+             text.di_->threshold_ < mapDistance &&
+             (text.di_->threshold_.value() >= 0.0 ||
+              -(text.di_->threshold_) > mapDistance)) ||
+
+          (
+             // Text has a start time
+             text.di_->startTime_ != std::chrono::system_clock::time_point {} &&
+
+             // The time range has not yet started
+             (selectedTime < text.di_->startTime_ ||
+
+              // The time range has ended
+              text.di_->endTime_ <= selectedTime)))
+      {
+         // Text is not pickable
+         continue;
+      }
+
+      // Mouse offset from the text location in pixels, rotated according to
+      // map rotation
+      const glm::vec2 offset = (mouseCoords - text.p_) * mapScale;
+      const glm::vec2 rotated {
+         offset.x * mapBearingCos - offset.y * mapBearingSin,
+         offset.x * mapBearingSin + offset.y * mapBearingCos};
+
+      // Test point against text bounds
+      const glm::vec2 distance = glm::abs(rotated - text.center_);
+      if (distance.x <= text.halfSize_.x && distance.y <= text.halfSize_.y)
+      {
+         itemPicked = true;
+         util::tooltip::Show(text.di_->hoverText_, mouseGlobalPos);
+         break;
+      }
    }
 
    return itemPicked;
@@ -274,7 +675,7 @@ void PlacefileText::SetFonts(
       types::FontCategory::Default);
 
    // Valid font numbers are from 1 to 8, use 0 for the default font
-   for (std::size_t i = 0; i <= 8; ++i)
+   for (std::size_t i = 0; i <= kMaxFontNumber_; ++i)
    {
       auto it = (i > 0) ? fonts.find(i) : fonts.cend();
       if (it != fonts.cend())
@@ -308,6 +709,14 @@ void PlacefileText::FinishText()
    // Clear the new list
    p->newList_.clear();
    p->newFonts_.clear();
+
+   // Hover text is indexed with the new glyph layout
+   p->hoverText_.clear();
+   p->hoverIndex_.Clear();
+
+   // Mark the draw item dirty. Glyphs are laid out when rendering, while the
+   // font atlas is locked.
+   p->dirty_ = true;
 }
 
 } // namespace draw
@@ -3,6 +3,7 @@
 #include <scwx/util/logger.hpp>
 
 #include <mutex>
+#include <unordered_map>
 
 namespace scwx
 {
@@ -25,6 +26,18 @@ static constexpr std::size_t kIntegersPerVertex_ = 3;
 class PlacefileTriangles::Impl
 {
 public:
+   struct BufferRecord
+   {
+      std::shared_ptr<const gr::Placefile::TrianglesDrawItem> di_ {};
+      std::vector<GLfloat>                                    buffer_ {};
+      std::vector<GLint>                                      integerBuffer_ {};
+   };
+
+   // Buffered vertex data of each draw item
+   typedef std::unordered_map<const gr::Placefile::TrianglesDrawItem*,
+                              BufferRecord>
+      BufferCache;
+
    explicit Impl(const std::shared_ptr<GlContext>& context) :
        context_ {context},
        shaderProgram_ {nullptr},
@@ -59,6 +72,9 @@ public:
    std::vector<GLfloat> newBuffer_ {};
    std::vector<GLint>   newIntegerBuffer_ {};
 
+   BufferCache currentBufferCache_ {};
+   BufferCache newBufferCache_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -231,6 +247,7 @@ void PlacefileTriangles::StartTriangles()
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newBufferCache_.clear();
 }
 
 void PlacefileTriangles::AddTriangles(
@@ -250,9 +267,13 @@ void PlacefileTriangles::FinishTriangles()
    p->currentBuffer_.swap(p->newBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
 
+   // Only keep the vertex data of the current draw items
+   p->currentBufferCache_.swap(p->newBufferCache_);
+
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newBufferCache_.clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -261,6 +282,24 @@ void PlacefileTriangles::FinishTriangles()
 void PlacefileTriangles::Impl::UpdateBuffers(
    const std::shared_ptr<const gr::Placefile::TrianglesDrawItem>& di)
 {
+   // Reuse the vertex data of a draw item carried over from the previous load
+   auto it = currentBufferCache_.find(di.get());
+   if (it != currentBufferCache_.cend())
+   {
+      auto  result = newBufferCache_.insert(currentBufferCache_.extract(it));
+      auto& record = result.position->second;
+
+      newBuffer_.insert(
+         newBuffer_.end(), record.buffer_.cbegin(), record.buffer_.cend());
+      newIntegerBuffer_.insert(newIntegerBuffer_.end(),
+                               record.integerBuffer_.cbegin(),
+                               record.integerBuffer_.cend());
+      return;
+   }
+
+   const std::size_t bufferStart  = newBuffer_.size();
+   const std::size_t integerStart = newIntegerBuffer_.size();
+
    // Threshold value
    units::length::nautical_miles<double> threshold = di->threshold_;
    GLint thresholdValue = static_cast<GLint>(std::round(threshold.value()));
@@ -314,6 +353,18 @@ void PlacefileTriangles::Impl::UpdateBuffers(
       newBuffer_.pop_back();
       newIntegerBuffer_.pop_back();
    }
+
+   newBufferCache_.insert_or_assign(
+      di.get(),
+      BufferRecord {di,
+                    std::vector<GLfloat>(
+                       newBuffer_.cbegin() +
+                          static_cast<std::ptrdiff_t>(bufferStart),
+                       newBuffer_.cend()),
+                    std::vector<GLint>(
+                       newIntegerBuffer_.cbegin() +
+                          static_cast<std::ptrdiff_t>(integerStart),
+                       newIntegerBuffer_.cend())});
 }
 
 void PlacefileTriangles::Impl::Update()
@@ -32,6 +32,7 @@
 #include <scwx/qt/ui/level3_products_widget.hpp>
 #include <scwx/qt/ui/placefile_dialog.hpp>
 #include <scwx/qt/ui/marker_dialog.hpp>
+#include <scwx/qt/ui/metrics_dialog.hpp>
 #include <scwx/qt/ui/radar_site_dialog.hpp>
 #include <scwx/qt/ui/settings_dialog.hpp>
 #include <scwx/qt/ui/update_dialog.hpp>
@@ -89,6 +90,7 @@ public:
        layerDialog_ {nullptr},
        placefileDialog_ {nullptr},
        markerDialog_ {nullptr},
+       metricsDialog_ {nullptr},
        radarSiteDialog_ {nullptr},
        settingsDialog_ {nullptr},
        updateDialog_ {nullptr},
@@ -208,6 +210,7 @@ public:
    ui::LayerDialog*         layerDialog_;
    ui::PlacefileDialog*     placefileDialog_;
    ui::MarkerDialog*        markerDialog_;
+   ui::MetricsDialog*       metricsDialog_;
    ui::RadarSiteDialog*     radarSiteDialog_;
    ui::SettingsDialog*      settingsDialog_;
    ui::UpdateDialog*        updateDialog_;
@@ -396,6 +399,9 @@ MainWindow::MainWindow(QWidget* parent) :
    // ImGui Debug Dialog
    p->imGuiDebugDialog_ = new ui::ImGuiDebugDialog(this);
 
+   // Metrics Dialog
+   p->metricsDialog_ = new ui::MetricsDialog(this);
+
    // About Dialog
    p->aboutDialog_ = new ui::AboutDialog(this);
 
@@ -634,6 +640,11 @@ void MainWindow::on_actionImGuiDebug_triggered()
    p->imGuiDebugDialog_->show();
 }
 
+void MainWindow::on_actionMetrics_triggered()
+{
+   p->metricsDialog_->show();
+}
+
 void MainWindow::on_actionDumpLayerList_triggered()
 {
    p->activeMap_->DumpLayerList();
@@ -47,6 +47,7 @@ private slots:
    void on_actionMarkerManager_triggered();
    void on_actionLayerManager_triggered();
    void on_actionImGuiDebug_triggered();
+   void on_actionMetrics_triggered();
    void on_actionDumpLayerList_triggered();
    void on_actionDumpRadarProductRecords_triggered();
    void on_actionRadarWireframe_triggered(bool checked);
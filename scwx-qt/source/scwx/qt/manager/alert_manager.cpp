@@ -4,11 +4,14 @@
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/settings/audio_settings.hpp>
 #include <scwx/qt/types/location_types.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/area_index.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/uuid/random_generator.hpp>
@@ -24,6 +27,8 @@ namespace manager
 static const std::string logPrefix_ = "scwx::qt::manager::alert_manager";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static constexpr std::chrono::minutes kPruneInterval_ {1};
+
 class AlertManager::Impl
 {
 public:
@@ -35,7 +40,14 @@ public:
       UpdateLocationTracking(audioSettings.alert_location_method().GetValue());
 
       audioSettings.alert_location_method().RegisterValueChangedCallback(
-         [this](const std::string& value) { UpdateLocationTracking(value); });
+         [this](const std::string& value)
+         {
+            UpdateLocationTracking(value);
+
+            // The areas in range were determined for the previous location
+            boost::asio::post(threadPool_,
+                              [this]() { trackingInitialized_ = false; });
+         });
 
       QObject::connect(
          textEventManager_.get(),
@@ -56,13 +68,53 @@ public:
                                  }
                               });
          });
+
+      QObject::connect(
+         positionManager_.get(),
+         &manager::PositionManager::PositionUpdated,
+         self_,
+         [this](const QGeoPositionInfo& info)
+         {
+            if (!info.isValid())
+            {
+               return;
+            }
+
+            const QGeoCoordinate     trackedCoordinate = info.coordinate();
+            const common::Coordinate coordinate {trackedCoordinate.latitude(),
+                                                 trackedCoordinate.longitude()};
+
+            boost::asio::post(threadPool_,
+                              [=, this]()
+                              {
+                                 try
+                                 {
+                                    HandlePositionUpdate(coordinate);
+                                 }
+                                 catch (const std::exception& ex)
+                                 {
+                                    logger_->error(ex.what());
+                                 }
+                              });
+         });
    }
 
    ~Impl() { threadPool_.join(); }
 
+   struct AlertArea
+   {
+      types::TextEventKey                       key_ {};
+      std::chrono::system_clock::time_point     eventEnd_ {};
+      std::shared_ptr<const util::PreparedArea> area_ {};
+      bool                                      inRange_ {false};
+   };
+
    common::Coordinate
         CurrentCoordinate(types::LocationMethod locationMethod) const;
-   void HandleAlert(const types::TextEventKey& key, size_t messageIndex) const;
+   void HandleAlert(const types::TextEventKey& key, size_t messageIndex);
+   void HandlePositionUpdate(const common::Coordinate& coordinate);
+   void PruneExpiredAreas();
+   void UpdateAreaIndex();
    void UpdateLocationTracking(const std::string& value) const;
 
    boost::asio::thread_pool threadPool_ {1u};
@@ -78,6 +130,19 @@ public:
       TextEventManager::Instance()};
 
    std::shared_ptr<config::RadarSite> radarSite_ {};
+
+   // Areas of active alerts, prepared once per segment. Only accessed from the
+   // thread pool.
+   std::unordered_map<types::TextEventKey,
+                      std::vector<AlertArea>,
+                      types::TextEventHash<types::TextEventKey>>
+                           alertAreas_ {};
+   std::vector<AlertArea*> indexedAreas_ {};
+   util::AreaIndex         areaIndex_ {};
+   bool                    areaIndexDirty_ {false};
+   bool                    trackingInitialized_ {false};
+
+   std::chrono::system_clock::time_point lastPruneTime_ {};
 };
 
 AlertManager::AlertManager() : p(std::make_unique<Impl>(this)) {}
@@ -136,7 +201,7 @@ common::Coordinate AlertManager::Impl::CurrentCoordinate(
 }
 
 void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
-                                     size_t messageIndex) const
+                                     size_t messageIndex)
 {
    // Skip alert if there are more messages to be processed
    if (messageIndex + 1 < textEventManager_->message_count(key))
@@ -153,7 +218,17 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
       audioSettings.alert_radius().GetValue());
    std::string alertWFO = audioSettings.alert_wfo().GetValue();
 
-   auto message = textEventManager_->message_list(key).at(messageIndex);
+   bool locationBased = (locationMethod == types::LocationMethod::Fixed ||
+                         locationMethod == types::LocationMethod::Track ||
+                         locationMethod == types::LocationMethod::RadarSite);
+
+   auto message = textEventManager_->message(key, messageIndex);
+   if (message == nullptr)
+   {
+      return;
+   }
+
+   std::vector<AlertArea> alertAreas {};
 
    for (auto& segment : message->segments())
    {
@@ -168,25 +243,39 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
       auto              eventEnd   = vtec.pVtec_.event_end();
       bool alertActive             = (action != awips::PVtec::Action::Canceled);
 
-      // If the event has ended or is inactive, or if the alert is not enabled,
-      // skip it
-      if (eventEnd < std::chrono::system_clock::now() || !alertActive ||
-          !audioSettings.alert_enabled(phenomenon).GetValue())
+      // If the event has ended or is inactive, skip it
+      if (eventEnd < std::chrono::system_clock::now() || !alertActive)
       {
          continue;
       }
 
-      bool activeAtLocation = (locationMethod == types::LocationMethod::All);
+      // Prepare the alert area once, for this check and for each position
+      // update while the alert is active
+      AlertArea& alertArea = alertAreas.emplace_back(AlertArea {
+         key,
+         eventEnd,
+         std::make_shared<const util::PreparedArea>(
+            segment->codedLocation_->coordinates()),
+         false});
+
+      if (locationBased)
+      {
+         // Determine if the alert is active at the current coordinate
+         alertArea.inRange_ =
+            alertArea.area_->InRangeOfPoint(currentCoordinate, alertRadius);
+      }
 
-      if (locationMethod == types::LocationMethod::Fixed ||
-          locationMethod == types::LocationMethod::Track ||
-          locationMethod == types::LocationMethod::RadarSite)
+      // If the alert is not enabled, skip it
+      if (!audioSettings.alert_enabled(phenomenon).GetValue())
       {
-         // Determine if the alert is active at the current coordinte
-         auto alertCoordinates = segment->codedLocation_->coordinates();
+         continue;
+      }
 
-         activeAtLocation = util::GeographicLib::AreaInRangeOfPoint(
-            alertCoordinates, currentCoordinate, alertRadius);
+      bool activeAtLocation = (locationMethod == types::LocationMethod::All);
+
+      if (locationBased)
+      {
+         activeAtLocation = alertArea.inRange_;
       }
       else if (locationMethod == types::LocationMethod::County)
       {
@@ -213,6 +302,143 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
          mediaManager_->Play(audioSettings.alert_sound_file().GetValue());
       }
    }
+
+   if (alertAreas.empty())
+   {
+      alertAreas_.erase(key);
+   }
+   else
+   {
+      alertAreas_.insert_or_assign(key, std::move(alertAreas));
+   }
+
+   // The index is rebuilt on the next position update, as alerts are often
+   // received in bursts
+   areaIndexDirty_ = true;
+
+   if (std::chrono::system_clock::now() - lastPruneTime_ >= kPruneInterval_)
+   {
+      PruneExpiredAreas();
+   }
+}
+
+void AlertManager::Impl::HandlePositionUpdate(
+   const common::Coordinate& coordinate)
+{
+   settings::AudioSettings& audioSettings = settings::AudioSettings::Instance();
+   types::LocationMethod    locationMethod = types::GetLocationMethod(
+      audioSettings.alert_location_method().GetValue());
+
+   if (locationMethod != types::LocationMethod::Track ||
+       !audioSettings.alert_on_area_entry().GetValue())
+   {
+      trackingInitialized_ = false;
+      return;
+   }
+
+   auto alertRadius = units::length::kilometers<double>(
+      audioSettings.alert_radius().GetValue());
+
+   PruneExpiredAreas();
+
+   if (areaIndexDirty_)
+   {
+      UpdateAreaIndex();
+      areaIndexDirty_ = false;
+   }
+
+   // Only areas near the current position are checked, and the result is in
+   // ascending order of the indexed areas
+   const std::vector<std::size_t> areasInRange =
+      areaIndex_.Query(coordinate, alertRadius);
+   auto inRangeIt = areasInRange.cbegin();
+
+   std::unordered_set<types::TextEventKey,
+                      types::TextEventHash<types::TextEventKey>>
+      enteredAlerts {};
+
+   for (std::size_t i = 0; i < indexedAreas_.size(); ++i)
+   {
+      AlertArea& alertArea = *indexedAreas_[i];
+      const bool inRange =
+         (inRangeIt != areasInRange.cend() && *inRangeIt == i);
+
+      if (inRange)
+      {
+         ++inRangeIt;
+
+         // Alert when entering an enabled alert area. The first position
+         // update only determines which areas are in range.
+         if (trackingInitialized_ && !alertArea.inRange_ &&
+             audioSettings.alert_enabled(alertArea.key_.phenomenon_)
+                .GetValue())
+         {
+            enteredAlerts.insert(alertArea.key_);
+         }
+      }
+
+      alertArea.inRange_ = inRange;
+   }
+
+   trackingInitialized_ = true;
+
+   for (auto& key : enteredAlerts)
+   {
+      logger_->info("Alert active at current location: {}", key.ToString());
+   }
+
+   if (!enteredAlerts.empty())
+   {
+      mediaManager_->Play(audioSettings.alert_sound_file().GetValue());
+   }
+}
+
+void AlertManager::Impl::PruneExpiredAreas()
+{
+   const auto now = std::chrono::system_clock::now();
+
+   for (auto it = alertAreas_.begin(); it != alertAreas_.end();)
+   {
+      const std::size_t erased =
+         std::erase_if(it->second,
+                       [&](const AlertArea& alertArea)
+                       { return alertArea.eventEnd_ < now; });
+
+      if (erased > 0)
+      {
+         // The index refers to the areas which were moved or removed
+         areaIndexDirty_ = true;
+      }
+
+      if (it->second.empty())
+      {
+         it = alertAreas_.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+
+   lastPruneTime_ = now;
+}
+
+void AlertManager::Impl::UpdateAreaIndex()
+{
+   std::vector<std::shared_ptr<const util::PreparedArea>> areas {};
+
+   indexedAreas_.clear();
+
+   for (auto& alertAreas : alertAreas_)
+   {
+      for (auto& alertArea : alertAreas.second)
+      {
+         indexedAreas_.push_back(&alertArea);
+         areas.push_back(alertArea.area_);
+      }
+   }
+
+   areaIndex_.Build(areas);
 }
 
 void AlertManager::Impl::UpdateLocationTracking(
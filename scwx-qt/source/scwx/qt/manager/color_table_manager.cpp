@@ -0,0 +1,182 @@
+#include <scwx/qt/manager/color_table_manager.hpp>
+#include <scwx/qt/util/file.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <execution>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/range/irange.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::color_table_manager";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::uint16_t kRangeFolded_ = 1u;
+static constexpr std::size_t   kMaxLutCount_ = 64u;
+
+class ColorTableManager::Impl
+{
+public:
+   struct ColorTableRecord
+   {
+      std::string                         contents_ {};
+      std::shared_ptr<common::ColorTable> colorTable_ {};
+   };
+
+   struct LutRecord
+   {
+      std::shared_ptr<common::ColorTable> colorTable_ {};
+      float                               scale_ {};
+      float                               offset_ {};
+      std::uint16_t                       rangeMin_ {};
+      std::uint16_t                       rangeMax_ {};
+      std::shared_ptr<const Lut>          lut_ {};
+   };
+
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static std::shared_ptr<const Lut>
+   GenerateLut(const common::ColorTable& colorTable,
+               float                     scale,
+               float                     offset,
+               std::uint16_t             rangeMin,
+               std::uint16_t             rangeMax);
+
+   std::mutex colorTableMutex_ {};
+   std::unordered_map<std::string, ColorTableRecord> colorTables_ {};
+
+   // Most recently used lookup tables are at the front of the list
+   std::mutex           lutMutex_ {};
+   std::list<LutRecord> luts_ {};
+};
+
+ColorTableManager::ColorTableManager() : p(std::make_unique<Impl>()) {}
+ColorTableManager::~ColorTableManager() = default;
+
+std::shared_ptr<common::ColorTable>
+ColorTableManager::LoadColorTable(const std::string& filename)
+{
+   std::unique_ptr<std::istream> is = util::OpenFile(filename);
+   if (is->fail())
+   {
+      logger_->error("Could not open color table: {}", filename);
+      return nullptr;
+   }
+
+   std::ostringstream ss {};
+   ss << is->rdbuf();
+   std::string contents = ss.str();
+
+   std::unique_lock lock {p->colorTableMutex_};
+
+   auto& record = p->colorTables_[filename];
+   if (record.colorTable_ == nullptr || record.contents_ != contents)
+   {
+      logger_->debug("Loading color table: {}", filename);
+
+      std::istringstream colorTableStream {contents};
+      record.colorTable_ = common::ColorTable::Load(colorTableStream);
+      record.contents_   = std::move(contents);
+   }
+
+   return record.colorTable_;
+}
+
+std::shared_ptr<const ColorTableManager::Lut>
+ColorTableManager::GetLut(const std::shared_ptr<common::ColorTable>& colorTable,
+                          float                                      scale,
+                          float                                      offset,
+                          std::uint16_t                              rangeMin,
+                          std::uint16_t                              rangeMax)
+{
+   if (colorTable == nullptr || !colorTable->IsValid() || rangeMax < rangeMin)
+   {
+      return nullptr;
+   }
+
+   std::unique_lock lock {p->lutMutex_};
+
+   auto it = std::find_if(p->luts_.begin(),
+                          p->luts_.end(),
+                          [&](const Impl::LutRecord& record)
+                          {
+                             return record.colorTable_ == colorTable &&
+                                    record.scale_ == scale &&
+                                    record.offset_ == offset &&
+                                    record.rangeMin_ == rangeMin &&
+                                    record.rangeMax_ == rangeMax;
+                          });
+
+   if (it != p->luts_.end())
+   {
+      // Move the lookup table to the front of the list
+      p->luts_.splice(p->luts_.begin(), p->luts_, it);
+      return it->lut_;
+   }
+
+   // The lock is held while generating, so views requesting the same lookup
+   // table wait for it instead of generating it again
+   auto lut =
+      Impl::GenerateLut(*colorTable, scale, offset, rangeMin, rangeMax);
+
+   p->luts_.push_front({colorTable, scale, offset, rangeMin, rangeMax, lut});
+
+   if (p->luts_.size() > kMaxLutCount_)
+   {
+      p->luts_.pop_back();
+   }
+
+   return lut;
+}
+
+std::shared_ptr<const ColorTableManager::Lut>
+ColorTableManager::Impl::GenerateLut(const common::ColorTable& colorTable,
+                                     float                     scale,
+                                     float                     offset,
+                                     std::uint16_t             rangeMin,
+                                     std::uint16_t             rangeMax)
+{
+   boost::integer_range<std::uint32_t> dataRange =
+      boost::irange<std::uint32_t>(rangeMin, rangeMax + 1u);
+
+   auto lut = std::make_shared<Lut>(dataRange.size());
+
+   std::for_each(std::execution::par_unseq,
+                 dataRange.begin(),
+                 dataRange.end(),
+                 [&](std::uint32_t i)
+                 {
+                    if (i == kRangeFolded_)
+                    {
+                       (*lut)[i - rangeMin] = colorTable.rf_color();
+                    }
+                    else
+                    {
+                       float f              = (i - offset) / scale;
+                       (*lut)[i - rangeMin] = colorTable.Color(f);
+                    }
+                 });
+
+   return lut;
+}
+
+ColorTableManager& ColorTableManager::Instance()
+{
+   static ColorTableManager instance_ {};
+   return instance_;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <scwx/common/color_table.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/gil/typedefs.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * The ColorTableManager shares color tables and their lookup tables between
+ * radar product views. A color table file is only parsed once while its
+ * contents are unchanged, so views of the same product in each pane share the
+ * same color table. Lookup tables are cached by color table, scale, offset and
+ * data range, so views with the same moment data scaling reuse them.
+ */
+class ColorTableManager
+{
+public:
+   typedef std::vector<boost::gil::rgba8_pixel_t> Lut;
+
+   explicit ColorTableManager();
+   ~ColorTableManager();
+
+   ColorTableManager(const ColorTableManager&)            = delete;
+   ColorTableManager& operator=(const ColorTableManager&) = delete;
+
+   ColorTableManager(ColorTableManager&&) noexcept            = delete;
+   ColorTableManager& operator=(ColorTableManager&&) noexcept = delete;
+
+   /**
+    * Loads a color table. If the file contents are unchanged since the color
+    * table was last loaded, the previously loaded color table is returned.
+    *
+    * @param [in] filename Color table filename or resource path
+    *
+    * @return Color table, or nullptr if the file could not be opened
+    */
+   std::shared_ptr<common::ColorTable>
+   LoadColorTable(const std::string& filename);
+
+   /**
+    * Gets the lookup table for a range of data levels, generating it if it is
+    * not already cached. Each data level is converted to a data value using
+    * (level - offset) / scale. Data level 1 is range folded.
+    *
+    * @param [in] colorTable Color table
+    * @param [in] scale Data scale
+    * @param [in] offset Data offset
+    * @param [in] rangeMin First data level
+    * @param [in] rangeMax Last data level
+    *
+    * @return Lookup table, indexed by data level minus rangeMin
+    */
+   std::shared_ptr<const Lut>
+   GetLut(const std::shared_ptr<common::ColorTable>& colorTable,
+          float                                      scale,
+          float                                      offset,
+          std::uint16_t                              rangeMin,
+          std::uint16_t                              rangeMax);
+
+   static ColorTableManager& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -5,10 +5,14 @@
 #include <scwx/qt/util/json.hpp>
 #include <scwx/qt/util/network.hpp>
 #include <scwx/gr/placefile.hpp>
+#include <scwx/network/content_validator.hpp>
 #include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <fstream>
+#include <optional>
 #include <shared_mutex>
+#include <sstream>
 #include <vector>
 
 #include <QDir>
@@ -103,6 +107,8 @@ public:
    bool                 refresh_enabled() const;
    std::chrono::seconds refresh_time() const;
 
+   bool IsCurrent(const std::string& name) const;
+
    void CancelRefresh();
    void ScheduleRefresh();
    void ScheduleRefresh(
@@ -153,6 +159,10 @@ public:
    std::string                           lastRadarSite_ {};
    std::chrono::system_clock::time_point lastUpdateTime_ {};
 
+   // Validators and digest of the loaded placefile, used to skip reloading
+   // an unchanged placefile
+   network::ContentValidator contentValidator_ {};
+
    std::size_t failureCount_ {};
 };
 
@@ -341,6 +351,15 @@ bool PlacefileManager::Impl::PlacefileRecord::refresh_enabled() const
    return false;
 }
 
+bool PlacefileManager::Impl::PlacefileRecord::IsCurrent(
+   const std::string& name) const
+{
+   // The loaded placefile is current if it was loaded from the same name, and
+   // for the same radar site
+   return placefile_ != nullptr && placefile_->name() == name &&
+          (p->radarSite_ == nullptr || lastRadarSite_ == p->radarSite_->id());
+}
+
 std::chrono::seconds
 PlacefileManager::Impl::PlacefileRecord::refresh_time() const
 {
@@ -540,14 +559,25 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
    // Make a copy of name in the event it changes.
    const std::string name {name_};
 
-   std::shared_ptr<gr::Placefile> updatedPlacefile {};
+   std::shared_ptr<gr::Placefile>        updatedPlacefile {};
+   std::optional<std::string>            content {};
+   network::ContentValidator::Validators validators {};
+   network::ContentValidator::Status     status {
+      network::ContentValidator::Status::Error};
 
    QUrl url = QUrl::fromUserInput(QString::fromStdString(name));
    if (url.isLocalFile())
    {
-      updatedPlacefile = gr::Placefile::Load(name);
+      std::ifstream f(name, std::ios_base::in);
 
-      if (updatedPlacefile == nullptr)
+      if (f.is_open())
+      {
+         std::ostringstream ss {};
+         ss << f.rdbuf();
+         content = ss.str();
+         status  = contentValidator_.CheckContent(*content, validators);
+      }
+      else
       {
          logger_->error("Local placefile not found: {}", name);
       }
@@ -602,26 +632,60 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          }
       }
 
+      // Make the request conditional on the placefile having changed since
+      // it was last loaded
+      cpr::Header header = network::cpr::GetHeader();
+      if (IsCurrent(name))
+      {
+         contentValidator_.AddConditionalHeaders(header);
+      }
+
       // Send HTTP GET request
-      auto response =
-         cpr::Get(cpr::Url {decodedUrl}, network::cpr::GetHeader(), parameters);
+      auto response = cpr::Get(cpr::Url {decodedUrl}, header, parameters);
+
+      status = contentValidator_.CheckResponse(response, validators);
 
       if (cpr::status::is_success(response.status_code))
       {
-         std::istringstream responseBody {response.text};
-         updatedPlacefile = gr::Placefile::Load(name, responseBody);
+         content = std::move(response.text);
       }
       else if (response.status_code == 0)
       {
          logger_->error("Error loading placefile: {}", response.error.message);
       }
-      else
+      else if (status == network::ContentValidator::Status::Error)
       {
          logger_->error("Error loading placefile: {}", response.status_line);
       }
    }
 
-   if (updatedPlacefile != nullptr)
+   // Skip parsing a placefile which has not changed
+   const bool notModified =
+      (status == network::ContentValidator::Status::NotModified &&
+       IsCurrent(name));
+
+   if (!notModified && content.has_value())
+   {
+      std::istringstream is {*content};
+      updatedPlacefile = gr::Placefile::Load(name, is);
+   }
+
+   if (notModified)
+   {
+      logger_->debug("Placefile not modified: {}", name);
+
+      if (name_ == name)
+      {
+         lastUpdateTime_ = std::chrono::system_clock::now();
+         failureCount_   = 0;
+
+         contentValidator_.Refresh(std::move(validators));
+      }
+
+      // Update refresh timer
+      ScheduleRefresh();
+   }
+   else if (updatedPlacefile != nullptr)
    {
       // Load placefile resources
       auto newFonts  = Impl::LoadFontResources(updatedPlacefile);
@@ -635,6 +699,7 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          title_          = placefile_->title();
          lastUpdateTime_ = std::chrono::system_clock::now();
          failureCount_   = 0;
+         contentValidator_.Accept(std::move(validators));
 
          // Update font resources
          {
@@ -0,0 +1,280 @@
+#include <scwx/qt/manager/radar_product_cache.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/uuid/uuid.hpp>
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::radar_product_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kBytesPerMegabyte_ = 1024u * 1024u;
+
+class RadarProductCache::Impl
+{
+public:
+   struct Entry
+   {
+      std::string                                radarId_;
+      std::string                                productKey_;
+      std::shared_ptr<types::RadarProductRecord> record_;
+      std::size_t                                residentBytes_;
+   };
+
+   typedef std::list<Entry> EntryList;
+
+   explicit Impl()
+   {
+      auto& generalSettings = settings::GeneralSettings::Instance();
+
+      budget_ =
+         BudgetFromSetting(generalSettings.radar_cache_budget().GetValue());
+
+      budgetCallbackUuid_ =
+         generalSettings.radar_cache_budget().RegisterValueChangedCallback(
+            [this](const std::int64_t& value)
+            { self_->SetBudget(BudgetFromSetting(value)); });
+   }
+
+   ~Impl()
+   {
+      settings::GeneralSettings::Instance()
+         .radar_cache_budget()
+         .UnregisterValueChangedCallback(budgetCallbackUuid_);
+   }
+
+   static std::size_t BudgetFromSetting(std::int64_t megabytes);
+
+   void Evict(EntryList::iterator                                      it,
+              std::vector<std::shared_ptr<types::RadarProductRecord>>& evicted);
+   void EvictOverBudget(
+      std::vector<std::shared_ptr<types::RadarProductRecord>>& evicted);
+
+   RadarProductCache* self_ {nullptr};
+
+   mutable std::mutex mutex_ {};
+
+   // Most recently used records are at the front of the list
+   EntryList recentRecords_ {};
+   std::unordered_map<const types::RadarProductRecord*, EntryList::iterator>
+                                                recordMap_ {};
+   std::unordered_map<std::string, std::size_t> productCounts_ {};
+
+   // Sum of the resident size of each record, as of when it was last touched
+   std::size_t residentBytes_ {0};
+
+   std::size_t   budget_ {};
+   std::uint64_t hits_ {0};
+   std::uint64_t misses_ {0};
+   std::uint64_t evictions_ {0};
+
+   boost::uuids::uuid budgetCallbackUuid_ {};
+};
+
+RadarProductCache::RadarProductCache() : p(std::make_unique<Impl>())
+{
+   p->self_ = this;
+}
+RadarProductCache::~RadarProductCache() = default;
+
+std::size_t RadarProductCache::Impl::BudgetFromSetting(std::int64_t megabytes)
+{
+   return static_cast<std::size_t>(std::max<std::int64_t>(megabytes, 0)) *
+          kBytesPerMegabyte_;
+}
+
+std::size_t RadarProductCache::budget() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->budget_;
+}
+
+RadarProductCache::Statistics RadarProductCache::statistics() const
+{
+   std::unique_lock lock {p->mutex_};
+
+   Statistics statistics {};
+   statistics.hits_          = p->hits_;
+   statistics.misses_        = p->misses_;
+   statistics.evictions_     = p->evictions_;
+   statistics.recordCount_   = p->recentRecords_.size();
+   statistics.residentBytes_ = p->residentBytes_;
+   statistics.budget_        = p->budget_;
+
+   return statistics;
+}
+
+void RadarProductCache::Impl::Evict(
+   EntryList::iterator                                      it,
+   std::vector<std::shared_ptr<types::RadarProductRecord>>& evicted)
+{
+   auto countIt = productCounts_.find(it->productKey_);
+   if (countIt != productCounts_.end() && --countIt->second == 0)
+   {
+      productCounts_.erase(countIt);
+   }
+
+   residentBytes_ -= it->residentBytes_;
+
+   recordMap_.erase(it->record_.get());
+   evicted.push_back(std::move(it->record_));
+   recentRecords_.erase(it);
+}
+
+void RadarProductCache::Impl::EvictOverBudget(
+   std::vector<std::shared_ptr<types::RadarProductRecord>>& evicted)
+{
+   // Never evict the most recently used record
+   while (residentBytes_ > budget_ && recentRecords_.size() > 1)
+   {
+      Evict(std::prev(recentRecords_.end()), evicted);
+      ++evictions_;
+   }
+}
+
+void RadarProductCache::Touch(
+   const std::string&                                radarId,
+   const std::string&                                product,
+   const std::shared_ptr<types::RadarProductRecord>& record,
+   std::size_t                                       productLimit)
+{
+   if (record == nullptr)
+   {
+      return;
+   }
+
+   const std::string productKey = fmt::format("{}/{}", radarId, product);
+
+   // Level 2 records continue to grow while they are loading, so the size of a
+   // record is measured again each time it is touched
+   const std::size_t residentBytes = record->resident_bytes();
+
+   // Evicted records are released after the lock, as releasing the last
+   // reference to a record frees all of its data
+   std::vector<std::shared_ptr<types::RadarProductRecord>> evicted {};
+
+   std::unique_lock lock {p->mutex_};
+
+   auto recordIt = p->recordMap_.find(record.get());
+   if (recordIt != p->recordMap_.end())
+   {
+      // Move the record to the front of the list
+      p->recentRecords_.splice(
+         p->recentRecords_.begin(), p->recentRecords_, recordIt->second);
+
+      Impl::Entry& entry = p->recentRecords_.front();
+      p->residentBytes_ =
+         p->residentBytes_ - entry.residentBytes_ + residentBytes;
+      entry.residentBytes_ = residentBytes;
+   }
+   else
+   {
+      p->recentRecords_.push_front(
+         {radarId, productKey, record, residentBytes});
+      p->recordMap_.emplace(record.get(), p->recentRecords_.begin());
+      ++p->productCounts_[productKey];
+      p->residentBytes_ += residentBytes;
+   }
+
+   // Remove the least recently used records of the product while there are
+   // too many
+   std::size_t productCount = p->productCounts_[productKey];
+   for (auto it = std::prev(p->recentRecords_.end());
+        productCount > std::max<std::size_t>(productLimit, 1u) &&
+        it != p->recentRecords_.begin();)
+   {
+      auto current = it--;
+      if (current->productKey_ == productKey)
+      {
+         p->Evict(current, evicted);
+         --productCount;
+         ++p->evictions_;
+      }
+   }
+
+   p->EvictOverBudget(evicted);
+
+   lock.unlock();
+
+   if (!evicted.empty())
+   {
+      logger_->trace("Evicted {} records", evicted.size());
+   }
+}
+
+void RadarProductCache::Erase(const std::string& radarId)
+{
+   std::vector<std::shared_ptr<types::RadarProductRecord>> evicted {};
+
+   std::unique_lock lock {p->mutex_};
+
+   for (auto it = p->recentRecords_.begin(); it != p->recentRecords_.end();)
+   {
+      auto current = it++;
+      if (current->radarId_ == radarId)
+      {
+         p->Evict(current, evicted);
+      }
+   }
+}
+
+void RadarProductCache::Erase(
+   const std::shared_ptr<types::RadarProductRecord>& record)
+{
+   std::vector<std::shared_ptr<types::RadarProductRecord>> evicted {};
+
+   std::unique_lock lock {p->mutex_};
+
+   auto recordIt = p->recordMap_.find(record.get());
+   if (recordIt != p->recordMap_.end())
+   {
+      p->Evict(recordIt->second, evicted);
+   }
+}
+
+void RadarProductCache::RecordHit()
+{
+   std::unique_lock lock {p->mutex_};
+   ++p->hits_;
+}
+
+void RadarProductCache::RecordMiss()
+{
+   std::unique_lock lock {p->mutex_};
+   ++p->misses_;
+}
+
+void RadarProductCache::SetBudget(std::size_t budget)
+{
+   std::vector<std::shared_ptr<types::RadarProductRecord>> evicted {};
+
+   std::unique_lock lock {p->mutex_};
+
+   logger_->debug("Setting budget: {} bytes", budget);
+
+   p->budget_ = budget;
+   p->EvictOverBudget(evicted);
+}
+
+RadarProductCache& RadarProductCache::Instance()
+{
+   static RadarProductCache instance_ {};
+   return instance_;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
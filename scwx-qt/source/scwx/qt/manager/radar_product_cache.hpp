@@ -0,0 +1,106 @@
+#pragma once
+
+#include <scwx/qt/types/radar_product_record.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * The RadarProductCache keeps recently used radar product records resident.
+ * Records from all radar sites and product groups share a single least
+ * recently used list, which is bounded by a memory budget, measured using the
+ * resident size of each record as of when it was last touched. The number of
+ * records of each product is additionally bounded by the product's cache
+ * limit.
+ */
+class RadarProductCache
+{
+public:
+   struct Statistics
+   {
+      std::uint64_t hits_ {};
+      std::uint64_t misses_ {};
+      std::uint64_t evictions_ {};
+      std::size_t   recordCount_ {};
+      std::size_t   residentBytes_ {};
+      std::size_t   budget_ {};
+   };
+
+   explicit RadarProductCache();
+   ~RadarProductCache();
+
+   RadarProductCache(const RadarProductCache&)            = delete;
+   RadarProductCache& operator=(const RadarProductCache&) = delete;
+
+   RadarProductCache(RadarProductCache&&) noexcept            = delete;
+   RadarProductCache& operator=(RadarProductCache&&) noexcept = delete;
+
+   std::size_t budget() const;
+   Statistics  statistics() const;
+
+   /**
+    * Marks a record as most recently used, adding it to the cache if it is not
+    * already present. Least recently used records are evicted until both the
+    * product limit and the memory budget are satisfied. The record being
+    * touched is never evicted.
+    *
+    * @param [in] radarId Radar ID
+    * @param [in] product Radar product, or an empty string for Level 2 data
+    * @param [in] record Radar product record
+    * @param [in] productLimit Maximum number of records of the radar product
+    */
+   void Touch(const std::string&                                radarId,
+              const std::string&                                product,
+              const std::shared_ptr<types::RadarProductRecord>& record,
+              std::size_t                                       productLimit);
+
+   /**
+    * Removes all records of a radar from the cache.
+    *
+    * @param [in] radarId Radar ID
+    */
+   void Erase(const std::string& radarId);
+
+   /**
+    * Removes a record from the cache.
+    *
+    * @param [in] record Radar product record
+    */
+   void Erase(const std::shared_ptr<types::RadarProductRecord>& record);
+
+   /**
+    * Counts a lookup of a record which is resident.
+    */
+   void RecordHit();
+
+   /**
+    * Counts a lookup of a record which was evicted, and must be reloaded.
+    */
+   void RecordMiss();
+
+   /**
+    * Sets the memory budget, evicting records if necessary.
+    *
+    * @param [in] budget Memory budget, in bytes
+    */
+   void SetBudget(std::size_t budget);
+
+   static RadarProductCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
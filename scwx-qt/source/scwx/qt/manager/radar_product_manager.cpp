@@ -1,10 +1,12 @@
 #include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/manager/radar_product_cache.hpp>
 #include <scwx/qt/manager/radar_product_manager_notifier.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/time_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/provider/nexrad_object_cache.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/threads.hpp>
@@ -12,6 +14,7 @@
 
 #include <execution>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <unordered_set>
 
@@ -27,6 +30,7 @@
 #include <boost/timer/timer.hpp>
 #include <fmt/chrono.h>
 #include <qmaplibre.hpp>
+#include <QStandardPaths>
 #include <units/angle.h>
 
 #if defined(_MSC_VER)
@@ -49,8 +53,6 @@ typedef std::function<std::shared_ptr<wsr88d::NexradFile>()>
 typedef std::map<std::chrono::system_clock::time_point,
                  std::weak_ptr<types::RadarProductRecord>>
    RadarProductRecordMap;
-typedef std::list<std::shared_ptr<types::RadarProductRecord>>
-   RadarProductRecordList;
 
 static constexpr uint32_t NUM_RADIAL_GATES_0_5_DEGREE =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
@@ -79,6 +81,10 @@ static std::shared_mutex fileIndexMutex_;
 
 static std::mutex fileLoadMutex_;
 
+static std::once_flag objectCacheInitialized_;
+
+static void InitializeObjectCache();
+
 class ProviderManager : public QObject
 {
    Q_OBJECT
@@ -143,6 +149,8 @@ public:
 
       level2ProviderManager_->provider_ =
          provider::NexradDataProviderFactory::CreateLevel2DataProvider(radarId);
+
+      std::call_once(objectCacheInitialized_, InitializeObjectCache);
    }
    ~RadarProductManagerImpl()
    {
@@ -163,6 +171,9 @@ public:
       std::unique_lock loadLevel3DataLock {loadLevel3DataMutex_};
 
       threadPool_.join();
+
+      // Records of this radar can no longer be retrieved
+      RadarProductCache::Instance().Erase(radarId_);
    }
 
    RadarProductManager* self_;
@@ -187,8 +198,15 @@ public:
                           std::chrono::system_clock::time_point time);
    std::shared_ptr<types::RadarProductRecord>
    StoreRadarProductRecord(std::shared_ptr<types::RadarProductRecord> record);
-   void UpdateRecentRecords(RadarProductRecordList& recentList,
-                            std::shared_ptr<types::RadarProductRecord> record);
+   void HandleElevationScanLoaded(
+      const std::shared_ptr<wsr88d::Ar2vFile>& file,
+      float                                    elevationCut,
+      std::chrono::system_clock::time_point    time);
+   void CompletePartialRecord(
+      std::chrono::system_clock::time_point      time,
+      const std::shared_ptr<wsr88d::NexradFile>& nexradFile);
+   void RemoveRadarProductRecord(
+      const std::shared_ptr<types::RadarProductRecord>& record);
 
    void LoadNexradFileAsync(
       CreateNexradFileFunction                           load,
@@ -205,6 +223,12 @@ public:
    void PopulateLevel2ProductTimes(std::chrono::system_clock::time_point time);
    void PopulateLevel3ProductTimes(const std::string& product,
                                    std::chrono::system_clock::time_point time);
+   void PrefetchProducts(
+      const std::vector<std::chrono::system_clock::time_point>& times);
+   void PrefetchProduct(std::shared_ptr<ProviderManager>      providerManager,
+                        RadarProductRecordMap&                recordMap,
+                        std::shared_mutex&                    recordMutex,
+                        std::chrono::system_clock::time_point time);
 
    void UpdateAvailableProductsSync();
 
@@ -239,15 +263,18 @@ public:
    std::vector<float> coordinates1Degree_ {};
    std::vector<float> coordinates1DegreeSmooth_ {};
 
-   RadarProductRecordMap  level2ProductRecords_ {};
-   RadarProductRecordList level2ProductRecentRecords_ {};
+   RadarProductRecordMap level2ProductRecords_ {};
    std::unordered_map<std::string, RadarProductRecordMap>
-      level3ProductRecordsMap_ {};
-   std::unordered_map<std::string, RadarProductRecordList>
-                     level3ProductRecentRecordsMap_ {};
+                     level3ProductRecordsMap_ {};
    std::shared_mutex level2ProductRecordMutex_ {};
    std::shared_mutex level3ProductRecordMutex_ {};
 
+   // Level 2 records stored while they are loading, by requested time
+   std::map<std::chrono::system_clock::time_point,
+            std::shared_ptr<types::RadarProductRecord>>
+              partialLevel2Records_ {};
+   std::mutex partialLevel2RecordMutex_ {};
+
    std::shared_ptr<ProviderManager> level2ProviderManager_;
    std::unordered_map<std::string, std::shared_ptr<ProviderManager>>
                      level3ProviderManagerMap_ {};
@@ -266,6 +293,10 @@ public:
                       boost::hash<boost::uuids::uuid>>
                      refreshMap_ {};
    std::shared_mutex refreshMapMutex_ {};
+
+   std::set<std::pair<std::string, std::chrono::system_clock::time_point>>
+              prefetchRequests_ {};
+   std::mutex prefetchMutex_ {};
 };
 
 RadarProductManager::RadarProductManager(const std::string& radarId) :
@@ -314,6 +345,34 @@ void RadarProductManager::Cleanup()
       std::unique_lock lock(instanceMutex_);
       instanceMap_.clear();
    }
+
+   provider::NexradObjectCache::Instance().Flush();
+}
+
+static void InitializeObjectCache()
+{
+   auto& generalSettings = settings::GeneralSettings::Instance();
+   auto& objectCache     = provider::NexradObjectCache::Instance();
+
+   auto setMaxSize = [](const std::int64_t& megabytes)
+   {
+      static constexpr std::size_t kBytesPerMegabyte = 1024u * 1024u;
+
+      provider::NexradObjectCache::Instance().SetMaxSize(
+         static_cast<std::size_t>(std::max<std::int64_t>(megabytes, 0)) *
+         kBytesPerMegabyte);
+   };
+
+   setMaxSize(generalSettings.nexrad_cache_size().GetValue());
+   generalSettings.nexrad_cache_size().RegisterValueChangedCallback(
+      setMaxSize);
+
+   // Downloaded NEXRAD objects are cached on disk, so they may be loaded
+   // again without downloading them
+   objectCache.SetDirectory(
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+         .toStdString() +
+      "/nexrad");
 }
 
 void RadarProductManager::DumpRecords()
@@ -913,8 +972,19 @@ void RadarProductManagerImpl::LoadProviderData(
                   providerManager->name(),
                   scwx::util::TimeString(time));
 
+   // Level 2 elevation scans are made available as they are loaded
+   wsr88d::NexradFileFactory::ElevationScanCallback elevationScanCallback {};
+   if (providerManager->group_ == common::RadarProductGroup::Level2)
+   {
+      elevationScanCallback =
+         [=, this](const std::shared_ptr<wsr88d::Ar2vFile>& file,
+                   float                                    elevationCut)
+      { HandleElevationScanLoaded(file, elevationCut, time); };
+   }
+
    LoadNexradFileAsync(
-      [=, &recordMap, &recordMutex]() -> std::shared_ptr<wsr88d::NexradFile>
+      [=, this, &recordMap, &recordMutex]()
+         -> std::shared_ptr<wsr88d::NexradFile>
       {
          std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
          std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
@@ -941,7 +1011,20 @@ void RadarProductManagerImpl::LoadProviderData(
 
             if (!key.empty())
             {
-               nexradFile = providerManager->provider_->LoadObjectByKey(key);
+               try
+               {
+                  nexradFile = providerManager->provider_->LoadObjectByKey(
+                     key, elevationScanCallback);
+               }
+               catch (const std::exception&)
+               {
+                  nexradFile = nullptr;
+                  CompletePartialRecord(time, nexradFile);
+                  throw;
+               }
+
+               // Remove the partially loaded record if loading failed
+               CompletePartialRecord(time, nexradFile);
             }
             else
             {
@@ -1168,6 +1251,150 @@ void RadarProductManagerImpl::PopulateLevel3ProductTimes(
                         time);
 }
 
+void RadarProductManager::PrefetchActiveProducts(
+   const std::vector<std::chrono::system_clock::time_point>& times)
+{
+   std::vector<std::shared_ptr<RadarProductManager>> radarProductManagers {};
+
+   {
+      std::shared_lock lock {instanceMutex_};
+      for (auto& instance : instanceMap_)
+      {
+         auto radarProductManager = instance.second.lock();
+         if (radarProductManager != nullptr)
+         {
+            radarProductManagers.push_back(radarProductManager);
+         }
+      }
+   }
+
+   for (auto& radarProductManager : radarProductManagers)
+   {
+      radarProductManager->p->PrefetchProducts(times);
+   }
+}
+
+void RadarProductManagerImpl::PrefetchProducts(
+   const std::vector<std::chrono::system_clock::time_point>& times)
+{
+   std::unordered_set<std::shared_ptr<ProviderManager>> providerManagers {};
+
+   // Prefetch products with refresh enabled
+   {
+      std::shared_lock refreshLock {refreshMapMutex_};
+      for (auto& refreshEntry : refreshMap_)
+      {
+         providerManagers.insert(refreshEntry.second);
+      }
+   }
+
+   // Product times are populated by day, so only populate them once for each
+   // day in the window, instead of once for each frame
+   std::set<std::chrono::system_clock::time_point> days {};
+   for (auto& time : times)
+   {
+      days.insert(std::chrono::floor<std::chrono::days>(time));
+   }
+
+   for (auto& providerManager : providerManagers)
+   {
+      if (providerManager->group_ == common::RadarProductGroup::Level2)
+      {
+         for (auto& day : days)
+         {
+            PopulateLevel2ProductTimes(day);
+         }
+
+         for (auto& time : times)
+         {
+            PrefetchProduct(providerManager,
+                            level2ProductRecords_,
+                            level2ProductRecordMutex_,
+                            time);
+         }
+      }
+      else
+      {
+         for (auto& day : days)
+         {
+            PopulateLevel3ProductTimes(providerManager->product_, day);
+         }
+
+         std::unique_lock lock {level3ProductRecordMutex_};
+         auto&            level3ProductRecords =
+            level3ProductRecordsMap_[providerManager->product_];
+         lock.unlock();
+
+         for (auto& time : times)
+         {
+            PrefetchProduct(providerManager,
+                            level3ProductRecords,
+                            level3ProductRecordMutex_,
+                            time);
+         }
+      }
+   }
+}
+
+void RadarProductManagerImpl::PrefetchProduct(
+   std::shared_ptr<ProviderManager>      providerManager,
+   RadarProductRecordMap&                recordMap,
+   std::shared_mutex&                    recordMutex,
+   std::chrono::system_clock::time_point time)
+{
+   std::chrono::system_clock::time_point productTime {};
+
+   {
+      // Find the product time which would be selected for the requested time
+      std::shared_lock lock {recordMutex};
+
+      auto it = scwx::util::GetBoundedElementIterator(recordMap, time);
+      if (it == recordMap.cend() || it->second.lock() != nullptr)
+      {
+         // No product is available, or the product is already loaded
+         return;
+      }
+
+      productTime = it->first;
+   }
+
+   auto prefetchKey = std::make_pair(providerManager->name(), productTime);
+
+   {
+      std::unique_lock lock {prefetchMutex_};
+      if (!prefetchRequests_.insert(prefetchKey).second)
+      {
+         // The product is already being prefetched
+         return;
+      }
+   }
+
+   logger_->debug("Prefetching: {}, {}",
+                  providerManager->name(),
+                  scwx::util::TimeString(productTime));
+
+   auto request = std::make_shared<request::NexradFileRequest>(radarId_);
+
+   QObject::connect(
+      request.get(),
+      &request::NexradFileRequest::RequestComplete,
+      self_,
+      [this, prefetchKey](std::shared_ptr<request::NexradFileRequest>)
+      {
+         std::unique_lock lock {prefetchMutex_};
+         prefetchRequests_.erase(prefetchKey);
+      });
+
+   if (providerManager->group_ == common::RadarProductGroup::Level2)
+   {
+      self_->LoadLevel2Data(productTime, request);
+   }
+   else
+   {
+      self_->LoadLevel3Data(providerManager->product_, productTime, request);
+   }
+}
+
 void RadarProductManagerImpl::PopulateProductTimes(
    std::shared_ptr<ProviderManager>      providerManager,
    RadarProductRecordMap&                productRecordMap,
@@ -1288,6 +1515,8 @@ RadarProductManagerImpl::GetLevel2ProductRecords(
           recordTime != std::chrono::system_clock::time_point {})
       {
          // Product is expired, reload it
+         RadarProductCache::Instance().RecordMiss();
+
          std::shared_ptr<request::NexradFileRequest> request =
             std::make_shared<request::NexradFileRequest>(radarId_);
 
@@ -1308,7 +1537,11 @@ RadarProductManagerImpl::GetLevel2ProductRecords(
 
       if (record != nullptr)
       {
-         // Return valid records
+         // Return valid records, and mark them as recently used
+         RadarProductCache::Instance().RecordHit();
+         RadarProductCache::Instance().Touch(
+            radarId_, {}, record, cacheLimit_);
+
          records.insert_or_assign(recordTime, record);
       }
    }
@@ -1360,6 +1593,8 @@ RadarProductManagerImpl::GetLevel3ProductRecord(
        recordTime != std::chrono::system_clock::time_point {})
    {
       // Product is expired, reload it
+      RadarProductCache::Instance().RecordMiss();
+
       std::shared_ptr<request::NexradFileRequest> request =
          std::make_shared<request::NexradFileRequest>(radarId_);
 
@@ -1377,6 +1612,13 @@ RadarProductManagerImpl::GetLevel3ProductRecord(
 
       self_->LoadLevel3Data(product, recordTime, request);
    }
+   else if (record != nullptr)
+   {
+      // Mark the record as recently used
+      RadarProductCache::Instance().RecordHit();
+      RadarProductCache::Instance().Touch(
+         radarId_, product, record, cacheLimit_);
+   }
 
    return {record, recordTime};
 }
@@ -1415,7 +1657,8 @@ RadarProductManagerImpl::StoreRadarProductRecord(
          level2ProductRecords_[timeInSeconds] = record;
       }
 
-      UpdateRecentRecords(level2ProductRecentRecords_, storedRecord);
+      RadarProductCache::Instance().Touch(
+         radarId_, {}, storedRecord, cacheLimit_);
    }
    else if (record->radar_product_group() == common::RadarProductGroup::Level3)
    {
@@ -1441,39 +1684,108 @@ RadarProductManagerImpl::StoreRadarProductRecord(
          productMap[timeInSeconds] = record;
       }
 
-      UpdateRecentRecords(
-         level3ProductRecentRecordsMap_[record->radar_product()], storedRecord);
+      RadarProductCache::Instance().Touch(
+         radarId_, record->radar_product(), storedRecord, cacheLimit_);
    }
 
    return storedRecord;
 }
 
-void RadarProductManagerImpl::UpdateRecentRecords(
-   RadarProductRecordList&                    recentList,
-   std::shared_ptr<types::RadarProductRecord> record)
+void RadarProductManagerImpl::HandleElevationScanLoaded(
+   const std::shared_ptr<wsr88d::Ar2vFile>& file,
+   float                                    elevationCut,
+   std::chrono::system_clock::time_point    time)
 {
-   const std::size_t recentListMaxSize {cacheLimit_};
-   bool              iteratorErased = false;
+   logger_->debug("Elevation scan loaded: {} degrees", elevationCut);
+
+   std::unique_lock lock {partialLevel2RecordMutex_};
 
-   auto it = std::find(recentList.cbegin(), recentList.cend(), record);
-   if (it != recentList.cbegin() && it != recentList.cend())
+   std::shared_ptr<types::RadarProductRecord>& partialRecord =
+      partialLevel2Records_[time];
+
+   if (partialRecord != nullptr && partialRecord->level2_file() != file)
    {
-      // If the record exists beyond the front of the list, remove it
-      recentList.erase(it);
-      iteratorErased = true;
+      // A previous attempt to load the record failed, and the file is being
+      // loaded again
+      RemoveRadarProductRecord(partialRecord);
+      partialRecord = nullptr;
    }
 
-   if (iteratorErased || recentList.size() == 0 || it != recentList.cbegin())
+   if (partialRecord == nullptr)
    {
-      // Add the record to the front of the list, unless it's already there
-      recentList.push_front(record);
+      std::shared_ptr<types::RadarProductRecord> record =
+         types::RadarProductRecord::Create(file);
+
+      // Use the same time override as the completed record will
+      if (time != std::chrono::system_clock::time_point {})
+      {
+         record->set_time(time);
+      }
+
+      // Store the partially loaded record, so it can be retrieved before
+      // loading completes
+      std::shared_ptr<types::RadarProductRecord> storedRecord =
+         StoreRadarProductRecord(record);
+
+      if (storedRecord != record)
+      {
+         // The record has already been loaded
+         partialLevel2Records_.erase(time);
+         return;
+      }
+
+      partialRecord = record;
    }
 
-   while (recentList.size() > recentListMaxSize)
+   std::shared_ptr<types::RadarProductRecord> record = partialRecord;
+
+   lock.unlock();
+
+   Q_EMIT self_->ElevationScanLoaded(record, elevationCut);
+}
+
+void RadarProductManagerImpl::CompletePartialRecord(
+   std::chrono::system_clock::time_point      time,
+   const std::shared_ptr<wsr88d::NexradFile>& nexradFile)
+{
+   std::unique_lock lock {partialLevel2RecordMutex_};
+
+   auto it = partialLevel2Records_.find(time);
+   if (it == partialLevel2Records_.cend())
+   {
+      return;
+   }
+
+   if (it->second->nexrad_file() != nexradFile)
    {
-      // Remove from the end of the list while it's too big
-      recentList.pop_back();
+      // Loading failed, and the partially loaded record must not be used
+      logger_->debug("Removing partially loaded record: {}",
+                     scwx::util::TimeString(time));
+      RemoveRadarProductRecord(it->second);
    }
+
+   partialLevel2Records_.erase(it);
+}
+
+void RadarProductManagerImpl::RemoveRadarProductRecord(
+   const std::shared_ptr<types::RadarProductRecord>& record)
+{
+   auto timeInSeconds =
+      std::chrono::time_point_cast<std::chrono::seconds,
+                                   std::chrono::system_clock>(record->time());
+
+   {
+      std::unique_lock lock {level2ProductRecordMutex_};
+
+      // Keep the time available, so the record can be loaded again
+      auto it = level2ProductRecords_.find(timeInSeconds);
+      if (it != level2ProductRecords_.cend() && it->second.lock() == record)
+      {
+         it->second.reset();
+      }
+   }
+
+   RadarProductCache::Instance().Erase(record);
 }
 
 std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
@@ -1505,9 +1817,9 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
             record->level2_file()->GetElevationScan(
                dataBlockType, elevation, time);
 
-         if (recordRadarData != nullptr)
+         if (recordRadarData != nullptr && !recordRadarData->empty())
          {
-            auto& radarData0 = (*recordRadarData)[0];
+            auto& radarData0 = recordRadarData->front();
             auto  collectionTime =
                scwx::util::TimePoint(radarData0->modified_julian_date(),
                                      radarData0->collection_time());
@@ -1528,6 +1840,41 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
    return {radarData, elevationCut, elevationCuts, foundTime};
 }
 
+bool RadarProductManager::IsLevel2RecordSelected(
+   std::chrono::system_clock::time_point recordTime,
+   std::chrono::system_clock::time_point time)
+{
+   auto recordTimeInSeconds =
+      std::chrono::time_point_cast<std::chrono::seconds,
+                                   std::chrono::system_clock>(recordTime);
+
+   std::shared_lock lock {p->level2ProductRecordMutex_};
+
+   if (p->level2ProductRecords_.empty())
+   {
+      return false;
+   }
+
+   if (time == std::chrono::system_clock::time_point {})
+   {
+      // The latest record is selected
+      return p->level2ProductRecords_.rbegin()->first == recordTimeInSeconds;
+   }
+
+   // The record containing the selected time is searched, along with the
+   // previous record
+   auto recordIt =
+      scwx::util::GetBoundedElementIterator(p->level2ProductRecords_, time);
+
+   if (recordIt->first == recordTimeInSeconds)
+   {
+      return true;
+   }
+
+   return recordIt != p->level2ProductRecords_.cbegin() &&
+          (--recordIt)->first == recordTimeInSeconds;
+}
+
 std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
            std::chrono::system_clock::time_point>
 RadarProductManager::GetLevel3Data(const std::string& product,
@@ -41,6 +41,16 @@ public:
     */
    static void DumpRecords();
 
+   /**
+    * @brief Prefetches the products with refresh enabled, for each radar site,
+    * so they are loaded before they are selected. Products which have already
+    * been loaded, or are being prefetched, are skipped.
+    *
+    * @param [in] times Times of the products to prefetch
+    */
+   static void PrefetchActiveProducts(
+      const std::vector<std::chrono::system_clock::time_point>& times);
+
    [[nodiscard]] const std::vector<float>&
    coordinates(common::RadialSize radialSize, bool smoothingEnabled) const;
    [[nodiscard]] const scwx::util::time_zone*       default_time_zone() const;
@@ -97,6 +107,19 @@ public:
                  float                                 elevation,
                  std::chrono::system_clock::time_point time = {});
 
+   /**
+    * @brief Determines whether a level 2 record provides data for a selected
+    * time. This is the record GetLevel2Data() would search for the time.
+    *
+    * @param [in] recordTime Level 2 record time
+    * @param [in] time Selected time, or a default-initialized time for the
+    * latest data
+    *
+    * @return true if the record provides data for the selected time
+    */
+   bool IsLevel2RecordSelected(std::chrono::system_clock::time_point recordTime,
+                               std::chrono::system_clock::time_point time);
+
    /**
     * @brief Get level 3 message data for a product and time.
     *
@@ -133,7 +156,9 @@ public:
 
    /**
     * @brief Set the maximum number of products of each type that may be cached.
-    * The cache limit cannot be set lower than 6.
+    * The cache limit cannot be set lower than 6. Cached products are
+    * additionally limited by the radar cache memory budget, which is shared by
+    * all radar sites.
     *
     * @param [in] cacheLimit The maximum number of products of each type
     */
@@ -143,6 +168,20 @@ public:
 
 signals:
    void DataReloaded(std::shared_ptr<types::RadarProductRecord> record);
+
+   /**
+    * @brief Emitted as each elevation scan of a level 2 record is loaded. The
+    * record is available through GetLevel2Data() before it has been
+    * completely loaded, and contains all elevation scans loaded so far. Each
+    * elevation scan is complete when it is loaded, and is not modified
+    * afterwards, so a sweep computed from it does not need to be updated.
+    *
+    * @param [in] record Radar product record being loaded
+    * @param [in] elevationCut Elevation cut which became available
+    */
+   void ElevationScanLoaded(std::shared_ptr<types::RadarProductRecord> record,
+                            float elevationCut);
+
    void Level3ProductsChanged();
    void NewDataAvailable(common::RadarProductGroup             group,
                          const std::string&                    product,
@@ -5,9 +5,6 @@
 #include <scwx/provider/warnings_provider.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <shared_mutex>
-#include <unordered_map>
-
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/thread_pool.hpp>
@@ -32,8 +29,7 @@ public:
        self_ {self},
        refreshTimer_ {threadPool_},
        refreshMutex_ {},
-       textEventMap_ {},
-       textEventMutex_ {}
+       textEventStore_ {}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
 
@@ -87,11 +83,7 @@ public:
    boost::asio::steady_timer refreshTimer_;
    std::mutex                refreshMutex_;
 
-   std::unordered_map<types::TextEventKey,
-                      std::vector<std::shared_ptr<awips::TextProductMessage>>,
-                      types::TextEventHash<types::TextEventKey>>
-                     textEventMap_;
-   std::shared_mutex textEventMutex_;
+   types::TextEventStore textEventStore_;
 
    std::shared_ptr<provider::WarningsProvider> warningsProvider_ {nullptr};
 
@@ -103,33 +95,56 @@ TextEventManager::~TextEventManager() = default;
 
 size_t TextEventManager::message_count(const types::TextEventKey& key) const
 {
-   size_t messageCount = 0u;
+   return p->textEventStore_.message_count(key);
+}
 
-   std::shared_lock lock(p->textEventMutex_);
+std::shared_ptr<const types::TextEventStore::MessageList>
+TextEventManager::message_list(const types::TextEventKey& key) const
+{
+   return p->textEventStore_.message_list(key);
+}
 
-   auto it = p->textEventMap_.find(key);
-   if (it != p->textEventMap_.cend())
-   {
-      messageCount = it->second.size();
-   }
+std::shared_ptr<awips::TextProductMessage>
+TextEventManager::message(const types::TextEventKey& key,
+                          size_t                     messageIndex) const
+{
+   return p->textEventStore_.message(key, messageIndex);
+}
 
-   return messageCount;
+std::shared_ptr<awips::TextProductMessage>
+TextEventManager::latest_message(const types::TextEventKey& key) const
+{
+   return p->textEventStore_.latest_message(key);
 }
 
-std::vector<std::shared_ptr<awips::TextProductMessage>>
-TextEventManager::message_list(const types::TextEventKey& key) const
+std::optional<std::chrono::system_clock::time_point>
+TextEventManager::event_end(const types::TextEventKey& key) const
 {
-   std::vector<std::shared_ptr<awips::TextProductMessage>> messageList {};
+   return p->textEventStore_.event_end(key);
+}
 
-   std::shared_lock lock(p->textEventMutex_);
+std::uint64_t TextEventManager::version() const
+{
+   return p->textEventStore_.version();
+}
 
-   auto it = p->textEventMap_.find(key);
-   if (it != p->textEventMap_.cend())
-   {
-      messageList.assign(it->second.begin(), it->second.end());
-   }
+std::vector<types::TextEventKey>
+TextEventManager::GetEvents(awips::Phenomenon phenomenon) const
+{
+   return p->textEventStore_.GetEvents(phenomenon);
+}
 
-   return messageList;
+std::vector<types::TextEventKey>
+TextEventManager::GetEvents(const std::string& officeId) const
+{
+   return p->textEventStore_.GetEvents(officeId);
+}
+
+std::vector<types::TextEventKey> TextEventManager::GetActiveEvents(
+   std::chrono::system_clock::time_point begin,
+   std::chrono::system_clock::time_point end) const
+{
+   return p->textEventStore_.GetActiveEvents(begin, end);
 }
 
 void TextEventManager::LoadFile(const std::string& filename)
@@ -187,43 +202,16 @@ void TextEventManager::Impl::HandleMessage(
       }
    }
 
-   std::unique_lock lock(textEventMutex_);
-
-   // Find a matching event in the event map
+   // Add the message to its event. The message is not added if it has already
+   // been stored (WMO header equivalence check).
    auto&               vtecString = segments[0]->header_->vtecString_;
    types::TextEventKey key {vtecString[0].pVtec_};
-   size_t              messageIndex = 0;
-   auto                it           = textEventMap_.find(key);
-   bool                updated      = false;
-
-   if (it == textEventMap_.cend())
-   {
-      // If there was no matching event, add the message to a new event
-      textEventMap_.emplace(key, std::vector {message});
-      messageIndex = 0;
-      updated      = true;
-   }
-   else if (std::find_if(it->second.cbegin(),
-                         it->second.cend(),
-                         [=](auto& storedMessage)
-                         {
-                            return *message->wmo_header().get() ==
-                                   *storedMessage->wmo_header().get();
-                         }) == it->second.cend())
-   {
-      // If there was a matching event, and this message has not been stored
-      // (WMO header equivalence check), add the updated message to the existing
-      // event
-      messageIndex = it->second.size();
-      it->second.push_back(message);
-      updated = true;
-   };
 
-   lock.unlock();
+   std::optional<size_t> messageIndex = textEventStore_.Add(key, message);
 
-   if (updated)
+   if (messageIndex.has_value())
    {
-      Q_EMIT self_->AlertUpdated(key, messageIndex);
+      Q_EMIT self_->AlertUpdated(key, *messageIndex);
    }
 }
 
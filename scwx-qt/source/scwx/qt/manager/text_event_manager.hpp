@@ -2,8 +2,12 @@
 
 #include <scwx/awips/text_product_message.hpp>
 #include <scwx/qt/types/text_event_key.hpp>
+#include <scwx/qt/types/text_event_store.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <QObject>
@@ -24,8 +28,24 @@ public:
    ~TextEventManager();
 
    size_t message_count(const types::TextEventKey& key) const;
-   std::vector<std::shared_ptr<awips::TextProductMessage>>
+   std::shared_ptr<const types::TextEventStore::MessageList>
    message_list(const types::TextEventKey& key) const;
+   std::shared_ptr<awips::TextProductMessage>
+   message(const types::TextEventKey& key, size_t messageIndex) const;
+   std::shared_ptr<awips::TextProductMessage>
+   latest_message(const types::TextEventKey& key) const;
+   std::optional<std::chrono::system_clock::time_point>
+   event_end(const types::TextEventKey& key) const;
+
+   std::uint64_t version() const;
+
+   std::vector<types::TextEventKey>
+   GetEvents(awips::Phenomenon phenomenon) const;
+   std::vector<types::TextEventKey>
+   GetEvents(const std::string& officeId) const;
+   std::vector<types::TextEventKey>
+   GetActiveEvents(std::chrono::system_clock::time_point begin,
+                   std::chrono::system_clock::time_point end) const;
 
    void LoadFile(const std::string& filename);
 
@@ -7,6 +7,8 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <optional>
+#include <vector>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -32,6 +34,10 @@ enum class Direction
 // Wait up to 5 seconds for radar sweeps to update
 static constexpr std::chrono::seconds kRadarSweepMonitorTimeout_ {5};
 
+// Number of loop frames to load ahead of the selected frame. Together with the
+// selected frame, this is within the minimum radar product cache limit.
+static constexpr std::size_t kPrefetchFrameCount_ {5u};
+
 class TimelineManager::Impl
 {
 public:
@@ -52,6 +58,10 @@ public:
       animationTimer_.cancel();
 
       std::unique_lock selectTimeLock {selectTimeMutex_};
+
+      // Abandon pending prefetches, and wait for the current prefetch
+      prefetchThreadPool_.stop();
+      prefetchThreadPool_.join();
    }
 
    TimelineManager* self_;
@@ -70,6 +80,8 @@ public:
    void Pause();
    void Play();
    void PlaySync();
+   void PrefetchAsync(std::chrono::system_clock::time_point currentTime);
+   void Prefetch();
    void
    SelectTimeAsync(std::chrono::system_clock::time_point selectedTime = {});
    std::pair<bool, bool>
@@ -79,6 +91,7 @@ public:
 
    boost::asio::thread_pool playThreadPool_ {1};
    boost::asio::thread_pool selectThreadPool_ {1};
+   boost::asio::thread_pool prefetchThreadPool_ {1};
 
    std::size_t                           mapCount_ {0};
    std::string                           radarSite_ {"?"};
@@ -102,6 +115,9 @@ public:
    std::mutex                animationTimerMutex_ {};
 
    std::mutex selectTimeMutex_ {};
+
+   std::optional<std::chrono::system_clock::time_point> prefetchTime_ {};
+   std::mutex                                           prefetchMutex_ {};
 };
 
 TimelineManager::TimelineManager() : p(std::make_unique<Impl>(this)) {}
@@ -470,6 +486,9 @@ void TimelineManager::Impl::PlaySync()
    auto selectTimeEnd = std::chrono::steady_clock::now();
    auto elapsedTime   = selectTimeEnd - selectTimeStart;
 
+   // Load the following frames while the selected frame is displayed
+   PrefetchAsync(newTime);
+
    // Wait for radar sweeps to update
    RadarSweepMonitorWait(radarSweepMonitorLock);
 
@@ -512,6 +531,80 @@ void TimelineManager::Impl::PlaySync()
       });
 }
 
+void TimelineManager::Impl::PrefetchAsync(
+   std::chrono::system_clock::time_point currentTime)
+{
+   std::unique_lock lock {prefetchMutex_};
+
+   // If a prefetch is already pending, update its time instead of queueing
+   // another, so prefetching does not fall behind the animation
+   const bool prefetchPending = prefetchTime_.has_value();
+   prefetchTime_              = currentTime;
+
+   if (prefetchPending)
+   {
+      return;
+   }
+
+   boost::asio::post(prefetchThreadPool_,
+                     [this]()
+                     {
+                        try
+                        {
+                           Prefetch();
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
+void TimelineManager::Impl::Prefetch()
+{
+   std::unique_lock lock {prefetchMutex_};
+   const std::chrono::system_clock::time_point currentTime =
+      prefetchTime_.value_or(std::chrono::system_clock::time_point {});
+   prefetchTime_.reset();
+   lock.unlock();
+
+   if (currentTime == std::chrono::system_clock::time_point {})
+   {
+      return;
+   }
+
+   auto [startTime, endTime] = GetLoopStartAndEndTimes();
+
+   auto radarProductManager =
+      manager::RadarProductManager::Instance(radarSite_);
+   auto volumeTimes = radarProductManager->GetActiveVolumeTimes(currentTime);
+
+   std::vector<std::chrono::system_clock::time_point> frameTimes {};
+
+   // Select the frames following the current frame, until the end of the loop
+   for (auto it = volumeTimes.upper_bound(currentTime);
+        it != volumeTimes.cend() && *it <= endTime &&
+        frameTimes.size() < kPrefetchFrameCount_;
+        ++it)
+   {
+      frameTimes.push_back(*it);
+   }
+
+   // The loop repeats, so continue from the first frame of the loop
+   for (auto it = util::GetBoundedElementIterator(volumeTimes, startTime);
+        it != volumeTimes.cend() && *it <= currentTime &&
+        frameTimes.size() < kPrefetchFrameCount_;
+        ++it)
+   {
+      frameTimes.push_back(*it);
+   }
+
+   if (!frameTimes.empty())
+   {
+      manager::RadarProductManager::PrefetchActiveProducts(frameTimes);
+   }
+}
+
 void TimelineManager::Impl::SelectTimeAsync(
    std::chrono::system_clock::time_point selectedTime)
 {
@@ -13,11 +13,11 @@
 #include <unordered_map>
 #include <unordered_set>
 
-#include <boost/algorithm/string/join.hpp>
 #include <boost/asio/system_timer.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/container/stable_vector.hpp>
 #include <boost/container_hash/hash.hpp>
+#include <fmt/ranges.h>
 #include <QEvent>
 
 namespace scwx
@@ -326,7 +326,11 @@ void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
                       AlertTypeHash<std::pair<awips::Phenomenon, bool>>>
       alertsUpdated {};
 
-   auto message = textEventManager_->message_list(key).at(messageIndex);
+   auto message = textEventManager_->message(key, messageIndex);
+   if (message == nullptr)
+   {
+      return;
+   }
 
    // Determine start time for first segment
    std::chrono::system_clock::time_point segmentBegin {};
@@ -721,8 +725,8 @@ void AlertLayer::Impl::HandleGeoLinesHover(
       auto it = segmentsByLine_.find(di);
       if (it != segmentsByLine_.cend())
       {
-         tooltip_ =
-            boost::algorithm::join(it->second->segment_->productContent_, "\n");
+         tooltip_ = fmt::format(
+            "{}", fmt::join(it->second->segment_->productContent_, "\n"));
       }
       else
       {
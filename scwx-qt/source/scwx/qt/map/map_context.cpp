@@ -31,6 +31,7 @@ public:
 
    MapProvider mapProvider_ {MapProvider::Unknown};
    std::string mapCopyrights_ {};
+   std::size_t mapId_ {0u};
 
    QMargins           colorTableMargins_ {};
    common::Coordinate mouseCoordinate_ {};
@@ -59,6 +60,11 @@ std::string MapContext::map_copyrights() const
    return p->mapCopyrights_;
 }
 
+std::size_t MapContext::map_id() const
+{
+   return p->mapId_;
+}
+
 MapProvider MapContext::map_provider() const
 {
    return p->mapProvider_;
@@ -125,6 +131,11 @@ void MapContext::set_map_copyrights(const std::string& copyrights)
    p->mapCopyrights_ = copyrights;
 }
 
+void MapContext::set_map_id(std::size_t id)
+{
+   p->mapId_ = id;
+}
+
 void MapContext::set_map_provider(MapProvider provider)
 {
    p->mapProvider_ = provider;
@@ -40,6 +40,7 @@ public:
 
    std::weak_ptr<QMapLibre::Map>             map() const;
    std::string                               map_copyrights() const;
+   std::size_t                               map_id() const;
    MapProvider                               map_provider() const;
    MapSettings&                              settings();
    QMargins                                  color_table_margins() const;
@@ -54,6 +55,7 @@ public:
 
    void set_map(const std::shared_ptr<QMapLibre::Map>& map);
    void set_map_copyrights(const std::string& copyrights);
+   void set_map_id(std::size_t id);
    void set_map_provider(MapProvider provider);
    void set_color_table_margins(const QMargins& margins);
    void set_mouse_coordinate(const common::Coordinate& coordinate);
@@ -1,5 +1,6 @@
 #include <scwx/qt/map/map_widget.hpp>
 #include <scwx/qt/gl/gl.hpp>
+#include <scwx/qt/manager/color_table_manager.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/manager/hotkey_manager.hpp>
 #include <scwx/qt/manager/placefile_manager.hpp>
@@ -21,12 +22,12 @@
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/map_settings.hpp>
 #include <scwx/qt/settings/palette_settings.hpp>
-#include <scwx/qt/util/file.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/view/radar_product_view_factory.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/time.hpp>
 
 #include <set>
@@ -112,6 +113,11 @@ public:
       context_->set_map_provider(
          GetMapProvider(generalSettings.map_provider().GetValue()));
       context_->set_overlay_product_view(overlayProductView);
+      context_->set_map_id(id);
+
+      // Initialize metrics
+      renderHistogram_ = &scwx::util::MetricsRegistry::Instance().GetHistogram(
+         fmt::format("map{}.render", id + 1));
 
       // Initialize map data
       SetRadarSite(generalSettings.default_radar_site().GetValue());
@@ -257,6 +263,8 @@ public:
 
    uint64_t frameDraws_;
 
+   scwx::util::Histogram* renderHistogram_ {nullptr};
+
    double prevLatitude_;
    double prevLongitude_;
    double prevZoom_;
@@ -1540,6 +1548,8 @@ void MapWidget::initializeGL()
 
 void MapWidget::paintGL()
 {
+   scwx::util::ScopedTimer renderTimer {*p->renderHistogram_};
+
    p->isPainting_ = true;
 
    auto defaultFont = manager::FontManager::Instance().GetImGuiFont(
@@ -1838,10 +1848,9 @@ void MapWidgetImpl::InitializeNewRadarProductView(
                                  .GetValue();
                            if (!colorTableFile.empty())
                            {
-                              std::unique_ptr<std::istream> colorTableStream =
-                                 util::OpenFile(colorTableFile);
                               std::shared_ptr<common::ColorTable> colorTable =
-                                 common::ColorTable::Load(*colorTableStream);
+                                 manager::ColorTableManager::Instance()
+                                    .LoadColorTable(colorTableFile);
                               radarProductView->LoadColorTable(colorTable);
                            }
 
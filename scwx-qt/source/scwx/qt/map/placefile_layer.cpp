@@ -9,8 +9,12 @@
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/container_hash/hash.hpp>
 
 namespace scwx
 {
@@ -22,9 +26,41 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::placefile_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+template<class T>
+static bool DrawItemsEqual(const std::vector<std::shared_ptr<T>>& a,
+                           const std::vector<std::shared_ptr<T>>& b);
+template<class T>
+static void
+ResolveDrawItems(std::vector<std::shared_ptr<T>>&       drawItems,
+                 const std::vector<std::shared_ptr<T>>& loadedDrawItems);
+
+template<class T>
+static std::size_t DrawItemHash(const T& di);
+static std::size_t DrawItemHash(const gr::Placefile::IconDrawItem& di);
+static std::size_t DrawItemHash(const gr::Placefile::TextDrawItem& di);
+static std::size_t DrawItemHash(const gr::Placefile::PolygonDrawItem& di);
+
 class PlacefileLayer::Impl
 {
 public:
+   template<class T>
+   using DrawItemList = std::vector<std::shared_ptr<T>>;
+
+   struct DrawItems
+   {
+      DrawItemList<const gr::Placefile::IconFile> iconFiles_ {};
+      boost::unordered_flat_map<std::size_t,
+                                std::shared_ptr<types::ImGuiFont>>
+         fonts_ {};
+
+      DrawItemList<gr::Placefile::IconDrawItem>      icons_ {};
+      DrawItemList<gr::Placefile::ImageDrawItem>     images_ {};
+      DrawItemList<gr::Placefile::LineDrawItem>      lines_ {};
+      DrawItemList<gr::Placefile::PolygonDrawItem>   polygons_ {};
+      DrawItemList<gr::Placefile::TrianglesDrawItem> triangles_ {};
+      DrawItemList<gr::Placefile::TextDrawItem>      text_ {};
+   };
+
    explicit Impl(PlacefileLayer*                    self,
                  const std::shared_ptr<MapContext>& context,
                  const std::string&                 placefileName) :
@@ -54,6 +90,11 @@ public:
    std::string placefileName_;
    std::mutex  dataMutex_ {};
 
+   // Draw items currently loaded into the draw items, used to only rebuild
+   // the buffers of draw item types which have changed
+   std::string loadedPlacefileName_ {};
+   DrawItems   loadedDrawItems_ {};
+
    std::shared_ptr<gl::draw::PlacefileIcons>     placefileIcons_;
    std::shared_ptr<gl::draw::PlacefileImages>    placefileImages_;
    std::shared_ptr<gl::draw::PlacefileLines>     placefileLines_;
@@ -164,6 +205,11 @@ void PlacefileLayer::Deinitialize()
    logger_->debug("Deinitialize()");
 
    DrawLayer::Deinitialize();
+
+   // Draw items clear their buffers when deinitialized
+   std::unique_lock lock {p->dataMutex_};
+   p->loadedPlacefileName_.clear();
+   p->loadedDrawItems_ = {};
 }
 
 void PlacefileLayer::ReloadData()
@@ -197,48 +243,42 @@ void PlacefileLayer::Impl::ReloadDataSync()
       return;
    }
 
-   // Start draw items
-   placefileIcons_->StartIcons();
-   placefileImages_->StartImages(placefile->name());
-   placefileLines_->StartLines();
-   placefilePolygons_->StartPolygons();
-   placefileTriangles_->StartTriangles();
-   placefileText_->StartText();
-
-   placefileIcons_->SetIconFiles(placefile->icon_files(), placefile->name());
-   placefileText_->SetFonts(placefileManager->placefile_fonts(placefileName_));
+   DrawItems drawItems {};
+   drawItems.iconFiles_ = placefile->icon_files();
+   drawItems.fonts_     = placefileManager->placefile_fonts(placefileName_);
 
+   // Sort draw items by type
    for (auto& drawItem : placefile->GetDrawItems())
    {
       switch (drawItem->itemType_)
       {
       case gr::Placefile::ItemType::Text:
-         placefileText_->AddText(
+         drawItems.text_.push_back(
             std::static_pointer_cast<gr::Placefile::TextDrawItem>(drawItem));
          break;
 
       case gr::Placefile::ItemType::Icon:
-         placefileIcons_->AddIcon(
+         drawItems.icons_.push_back(
             std::static_pointer_cast<gr::Placefile::IconDrawItem>(drawItem));
          break;
 
       case gr::Placefile::ItemType::Line:
-         placefileLines_->AddLine(
+         drawItems.lines_.push_back(
             std::static_pointer_cast<gr::Placefile::LineDrawItem>(drawItem));
          break;
 
       case gr::Placefile::ItemType::Polygon:
-         placefilePolygons_->AddPolygon(
+         drawItems.polygons_.push_back(
             std::static_pointer_cast<gr::Placefile::PolygonDrawItem>(drawItem));
          break;
 
       case gr::Placefile::ItemType::Image:
-         placefileImages_->AddImage(
+         drawItems.images_.push_back(
             std::static_pointer_cast<gr::Placefile::ImageDrawItem>(drawItem));
          break;
 
       case gr::Placefile::ItemType::Triangles:
-         placefileTriangles_->AddTriangles(
+         drawItems.triangles_.push_back(
             std::static_pointer_cast<gr::Placefile::TrianglesDrawItem>(
                drawItem));
          break;
@@ -248,17 +288,189 @@ void PlacefileLayer::Impl::ReloadDataSync()
       }
    }
 
-   // Finish draw items
-   placefileIcons_->FinishIcons();
-   placefileImages_->FinishImages();
-   placefileLines_->FinishLines();
-   placefilePolygons_->FinishPolygons();
-   placefileTriangles_->FinishTriangles();
-   placefileText_->FinishText();
+   // Carry over the loaded draw items which are unchanged, so the draw items
+   // can reuse their buffered data by identity
+   ResolveDrawItems(drawItems.icons_, loadedDrawItems_.icons_);
+   ResolveDrawItems(drawItems.images_, loadedDrawItems_.images_);
+   ResolveDrawItems(drawItems.lines_, loadedDrawItems_.lines_);
+   ResolveDrawItems(drawItems.polygons_, loadedDrawItems_.polygons_);
+   ResolveDrawItems(drawItems.triangles_, loadedDrawItems_.triangles_);
+   ResolveDrawItems(drawItems.text_, loadedDrawItems_.text_);
+
+   // Only rebuild the buffers of draw item types which have changed. An
+   // unchanged type is skipped entirely, and a changed type only buffers the
+   // draw items which were not carried over.
+   const bool reloadAll = (placefile->name() != loadedPlacefileName_);
+
+   if (reloadAll ||
+       !DrawItemsEqual(drawItems.iconFiles_, loadedDrawItems_.iconFiles_) ||
+       !DrawItemsEqual(drawItems.icons_, loadedDrawItems_.icons_))
+   {
+      placefileIcons_->StartIcons();
+      placefileIcons_->SetIconFiles(drawItems.iconFiles_, placefile->name());
+      for (auto& drawItem : drawItems.icons_)
+      {
+         placefileIcons_->AddIcon(drawItem);
+      }
+      placefileIcons_->FinishIcons();
+   }
+
+   if (reloadAll ||
+       !DrawItemsEqual(drawItems.images_, loadedDrawItems_.images_))
+   {
+      placefileImages_->StartImages(placefile->name());
+      for (auto& drawItem : drawItems.images_)
+      {
+         placefileImages_->AddImage(drawItem);
+      }
+      placefileImages_->FinishImages();
+   }
+
+   if (reloadAll || !DrawItemsEqual(drawItems.lines_, loadedDrawItems_.lines_))
+   {
+      placefileLines_->StartLines();
+      for (auto& drawItem : drawItems.lines_)
+      {
+         placefileLines_->AddLine(drawItem);
+      }
+      placefileLines_->FinishLines();
+   }
+
+   if (reloadAll ||
+       !DrawItemsEqual(drawItems.polygons_, loadedDrawItems_.polygons_))
+   {
+      placefilePolygons_->StartPolygons();
+      for (auto& drawItem : drawItems.polygons_)
+      {
+         placefilePolygons_->AddPolygon(drawItem);
+      }
+      placefilePolygons_->FinishPolygons();
+   }
+
+   if (reloadAll ||
+       !DrawItemsEqual(drawItems.triangles_, loadedDrawItems_.triangles_))
+   {
+      placefileTriangles_->StartTriangles();
+      for (auto& drawItem : drawItems.triangles_)
+      {
+         placefileTriangles_->AddTriangles(drawItem);
+      }
+      placefileTriangles_->FinishTriangles();
+   }
+
+   if (reloadAll || drawItems.fonts_ != loadedDrawItems_.fonts_ ||
+       !DrawItemsEqual(drawItems.text_, loadedDrawItems_.text_))
+   {
+      placefileText_->StartText();
+      placefileText_->SetFonts(drawItems.fonts_);
+      for (auto& drawItem : drawItems.text_)
+      {
+         placefileText_->AddText(drawItem);
+      }
+      placefileText_->FinishText();
+   }
+
+   loadedPlacefileName_ = placefile->name();
+   loadedDrawItems_     = std::move(drawItems);
 
    Q_EMIT self_->DataReloaded();
 }
 
+template<class T>
+static bool DrawItemsEqual(const std::vector<std::shared_ptr<T>>& a,
+                           const std::vector<std::shared_ptr<T>>& b)
+{
+   return std::equal(a.cbegin(),
+                     a.cend(),
+                     b.cbegin(),
+                     b.cend(),
+                     [](const std::shared_ptr<T>& lhs,
+                        const std::shared_ptr<T>& rhs)
+                     { return lhs == rhs || *lhs == *rhs; });
+}
+
+template<class T>
+static void
+ResolveDrawItems(std::vector<std::shared_ptr<T>>&       drawItems,
+                 const std::vector<std::shared_ptr<T>>& loadedDrawItems)
+{
+   // Index the loaded draw items by content
+   std::unordered_multimap<std::size_t, const std::shared_ptr<T>*> loaded {};
+   loaded.reserve(loadedDrawItems.size());
+
+   for (auto& di : loadedDrawItems)
+   {
+      loaded.emplace(DrawItemHash(*di), &di);
+   }
+
+   // Replace each draw item with an equal loaded draw item, each loaded draw
+   // item replacing at most one draw item
+   for (auto& di : drawItems)
+   {
+      auto range = loaded.equal_range(DrawItemHash(*di));
+      auto it    = std::find_if(range.first,
+                             range.second,
+                             [&di](const auto& entry)
+                             { return **entry.second == *di; });
+
+      if (it != range.second)
+      {
+         di = *it->second;
+         loaded.erase(it);
+      }
+   }
+}
+
+template<class T>
+static std::size_t DrawItemHash(const T& di)
+{
+   std::size_t seed = 0;
+
+   for (auto& element : di.elements_)
+   {
+      boost::hash_combine(seed, element.latitude_);
+      boost::hash_combine(seed, element.longitude_);
+   }
+
+   return seed;
+}
+
+static std::size_t DrawItemHash(const gr::Placefile::IconDrawItem& di)
+{
+   std::size_t seed = 0;
+   boost::hash_combine(seed, di.latitude_);
+   boost::hash_combine(seed, di.longitude_);
+   boost::hash_combine(seed, di.iconNumber_);
+   return seed;
+}
+
+static std::size_t DrawItemHash(const gr::Placefile::TextDrawItem& di)
+{
+   std::size_t seed = 0;
+   boost::hash_combine(seed, di.latitude_);
+   boost::hash_combine(seed, di.longitude_);
+   boost::hash_combine(seed, di.text_);
+   return seed;
+}
+
+static std::size_t DrawItemHash(const gr::Placefile::PolygonDrawItem& di)
+{
+   std::size_t seed = 0;
+
+   for (auto& contour : di.contours_)
+   {
+      boost::hash_combine(seed, contour.size());
+
+      for (auto& element : contour)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+      }
+   }
+
+   return seed;
+}
+
 } // namespace map
 } // namespace qt
 } // namespace scwx
@@ -5,6 +5,7 @@
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -46,6 +47,7 @@ public:
        vbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
+       sweepTextures_ {GL_INVALID_INDEX},
        numVertices_ {0},
        cfpEnabled_ {false},
        colorTableNeedsUpdate_ {false},
@@ -54,6 +56,9 @@ public:
    }
    ~RadarProductLayerImpl() = default;
 
+   void UpdatePolarSweep(gl::OpenGLFunctions&    gl,
+                         const util::PolarSweep& polarSweep);
+
    std::shared_ptr<gl::ShaderProgram> shaderProgram_;
 
    GLint                 uMVPMatrixLocation_;
@@ -65,12 +70,30 @@ public:
    GLuint                vao_;
    GLuint                texture_;
 
+   // Polar sweep uniforms and textures (moments, CFP moments, radials and
+   // coordinates)
+   bool                  polarSweepEnabled_ {false};
+   GLint                 uRadarLatLongLocation_ {-1};
+   GLint                 uSmoothingEnabledLocation_ {-1};
+   GLint                 uShowSmoothedRangeFoldingLocation_ {-1};
+   GLint                 uSnrThresholdLocation_ {-1};
+   GLint                 uEdgeValueLocation_ {-1};
+   GLint                 uCfpPresentLocation_ {-1};
+   std::array<GLuint, 4> sweepTextures_;
+   std::uint64_t         coordinateVersion_ {0};
+   bool                  coordinatesBuffered_ {false};
+
+   util::PolarSweep::Parameters sweepParameters_ {};
+   bool                         cfpPresent_ {false};
+
    GLsizeiptr numVertices_;
 
    bool cfpEnabled_;
 
    bool colorTableNeedsUpdate_;
    bool sweepNeedsUpdate_;
+
+   scwx::util::Histogram* gpuUploadHistogram_ {nullptr};
 };
 
 RadarProductLayer::RadarProductLayer(std::shared_ptr<MapContext> context) :
@@ -94,9 +117,19 @@ void RadarProductLayer::Initialize()
 
    gl::OpenGLFunctions& gl = context()->gl();
 
+   p->gpuUploadHistogram_ =
+      &scwx::util::MetricsRegistry::Instance().GetHistogram(
+         fmt::format("map{}.gpu_upload", context()->map_id() + 1));
+
+   // Level 2 sweeps are rendered from packed data moments, and expanded into
+   // gates by the vertex shader
+   p->polarSweepEnabled_ =
+      context()->radar_product_view()->polar_sweep() != nullptr;
+
    // Load and configure radar shader
-   p->shaderProgram_ =
-      context()->GetShaderProgram(":/gl/radar.vert", ":/gl/radar.frag");
+   p->shaderProgram_ = context()->GetShaderProgram(
+      p->polarSweepEnabled_ ? ":/gl/radar_polar.vert" : ":/gl/radar.vert",
+      ":/gl/radar.frag");
 
    p->uMVPMatrixLocation_ =
       gl.glGetUniformLocation(p->shaderProgram_->id(), "uMVPMatrix");
@@ -135,6 +168,43 @@ void RadarProductLayer::Initialize()
 
    p->shaderProgram_->Use();
 
+   if (p->polarSweepEnabled_)
+   {
+      p->uRadarLatLongLocation_ =
+         p->shaderProgram_->GetUniformLocation("uRadarLatLong");
+      p->uSmoothingEnabledLocation_ =
+         p->shaderProgram_->GetUniformLocation("uSmoothingEnabled");
+      p->uShowSmoothedRangeFoldingLocation_ =
+         p->shaderProgram_->GetUniformLocation("uShowSmoothedRangeFolding");
+      p->uSnrThresholdLocation_ =
+         p->shaderProgram_->GetUniformLocation("uSnrThreshold");
+      p->uEdgeValueLocation_ =
+         p->shaderProgram_->GetUniformLocation("uEdgeValue");
+      p->uCfpPresentLocation_ =
+         p->shaderProgram_->GetUniformLocation("uCfpPresent");
+
+      // Texture unit 0 is used by the color table
+      gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uMomentTexture"),
+                     1);
+      gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uCfpTexture"), 2);
+      gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uRadialTexture"),
+                     3);
+      gl.glUniform1i(
+         p->shaderProgram_->GetUniformLocation("uCoordinateTexture"), 4);
+
+      // Generate sweep textures
+      gl.glGenTextures(static_cast<GLsizei>(p->sweepTextures_.size()),
+                       p->sweepTextures_.data());
+      for (GLuint texture : p->sweepTextures_)
+      {
+         gl.glBindTexture(GL_TEXTURE_2D, texture);
+         gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+         gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+         gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+         gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+      }
+   }
+
    // Generate a vertex array object
    gl.glGenVertexArrays(1, &p->vao_);
 
@@ -175,6 +245,20 @@ void RadarProductLayer::UpdateSweep()
 
    p->sweepNeedsUpdate_ = false;
 
+   scwx::util::ScopedTimer uploadTimer {*p->gpuUploadHistogram_};
+
+   std::shared_ptr<const util::PolarSweep> polarSweep =
+      radarProductView->polar_sweep();
+
+   if (p->polarSweepEnabled_ && polarSweep != nullptr)
+   {
+      timer.start();
+      p->UpdatePolarSweep(gl, *polarSweep);
+      timer.stop();
+      logger_->debug("Polar sweep buffered in {}", timer.format(6, "%ws"));
+      return;
+   }
+
    const std::vector<float>& vertices = radarProductView->vertices();
 
    // Bind a vertex array object
@@ -256,6 +340,84 @@ void RadarProductLayer::UpdateSweep()
    p->numVertices_ = vertices.size() / 2;
 }
 
+void RadarProductLayerImpl::UpdatePolarSweep(
+   gl::OpenGLFunctions& gl, const util::PolarSweep& polarSweep)
+{
+   const GLsizei gateCount   = polarSweep.gate_count();
+   const GLsizei radialCount = static_cast<GLsizei>(polarSweep.radial_count());
+
+   // Rows of 8-bit moments are not aligned to 4 bytes
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+   // Buffer data moments
+   const bool is8Bit = polarSweep.component_size() == 1;
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_2D, sweepTextures_[0]);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   is8Bit ? GL_R8UI : GL_R16UI,
+                   gateCount,
+                   radialCount,
+                   0,
+                   GL_RED_INTEGER,
+                   is8Bit ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT,
+                   polarSweep.moments().data());
+
+   // Buffer CFP moments
+   cfpPresent_ = polarSweep.has_cfp_moments();
+
+   gl.glActiveTexture(GL_TEXTURE2);
+   gl.glBindTexture(GL_TEXTURE_2D, sweepTextures_[1]);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_R8UI,
+                   cfpPresent_ ? gateCount : 0,
+                   cfpPresent_ ? radialCount : 0,
+                   0,
+                   GL_RED_INTEGER,
+                   GL_UNSIGNED_BYTE,
+                   cfpPresent_ ? polarSweep.cfp_moments().data() : nullptr);
+
+   // Buffer radial table
+   gl.glActiveTexture(GL_TEXTURE3);
+   gl.glBindTexture(GL_TEXTURE_2D, sweepTextures_[2]);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_RGB32I,
+                   util::PolarSweep::kTexelsPerRadial_,
+                   radialCount,
+                   0,
+                   GL_RGB_INTEGER,
+                   GL_INT,
+                   polarSweep.radials().data());
+
+   // Buffer coordinates, only when they have changed
+   if (!coordinatesBuffered_ ||
+       coordinateVersion_ != polarSweep.coordinate_version())
+   {
+      gl.glActiveTexture(GL_TEXTURE4);
+      gl.glBindTexture(GL_TEXTURE_2D, sweepTextures_[3]);
+      gl.glTexImage2D(GL_TEXTURE_2D,
+                      0,
+                      GL_RG32F,
+                      polarSweep.coordinate_gate_count(),
+                      polarSweep.coordinate_radial_count(),
+                      0,
+                      GL_RG,
+                      GL_FLOAT,
+                      polarSweep.coordinates().data());
+
+      coordinateVersion_   = polarSweep.coordinate_version();
+      coordinatesBuffered_ = true;
+   }
+
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+   sweepParameters_ = polarSweep.parameters();
+   numVertices_     = static_cast<GLsizeiptr>(polarSweep.vertex_count());
+}
+
 void RadarProductLayer::Render(
    const QMapLibre::CustomLayerRenderParameters& params)
 {
@@ -304,6 +466,28 @@ void RadarProductLayer::Render(
 
    gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
 
+   if (p->polarSweepEnabled_)
+   {
+      const util::PolarSweep::Parameters& parameters = p->sweepParameters_;
+
+      gl.glUniform2f(p->uRadarLatLongLocation_,
+                     parameters.latitude_,
+                     parameters.longitude_);
+      gl.glUniform1i(p->uSmoothingEnabledLocation_,
+                     parameters.smoothingEnabled_ ? 1 : 0);
+      gl.glUniform1i(p->uShowSmoothedRangeFoldingLocation_,
+                     parameters.showSmoothedRangeFolding_ ? 1 : 0);
+      gl.glUniform1ui(p->uSnrThresholdLocation_, parameters.snrThreshold_);
+      gl.glUniform1ui(p->uEdgeValueLocation_, parameters.edgeValue_);
+      gl.glUniform1i(p->uCfpPresentLocation_, p->cfpPresent_ ? 1 : 0);
+
+      for (std::size_t i = 0; i < p->sweepTextures_.size(); ++i)
+      {
+         gl.glActiveTexture(static_cast<GLenum>(GL_TEXTURE1 + i));
+         gl.glBindTexture(GL_TEXTURE_2D, p->sweepTextures_[i]);
+      }
+   }
+
    gl.glActiveTexture(GL_TEXTURE0);
    gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
    gl.glBindVertexArray(p->vao_);
@@ -327,6 +511,12 @@ void RadarProductLayer::Deinitialize()
    gl.glDeleteVertexArrays(1, &p->vao_);
    gl.glDeleteBuffers(3, p->vbo_.data());
 
+   if (p->polarSweepEnabled_)
+   {
+      gl.glDeleteTextures(static_cast<GLsizei>(p->sweepTextures_.size()),
+                          p->sweepTextures_.data());
+   }
+
    p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
    p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
    p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
@@ -335,6 +525,8 @@ void RadarProductLayer::Deinitialize()
    p->vao_                       = GL_INVALID_INDEX;
    p->vbo_                       = {GL_INVALID_INDEX};
    p->texture_                   = GL_INVALID_INDEX;
+   p->sweepTextures_             = {GL_INVALID_INDEX};
+   p->coordinatesBuffered_       = false;
 }
 
 bool RadarProductLayer::RunMousePicking(
@@ -1,9 +1,11 @@
 #include <scwx/qt/model/alert_model.hpp>
 #include <scwx/qt/config/county_database.hpp>
 #include <scwx/qt/manager/text_event_manager.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/types/unit_types.hpp>
+#include <scwx/qt/util/distance_batch.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/geographic.hpp>
 #include <scwx/util/logger.hpp>
@@ -30,6 +32,14 @@ static constexpr int kLastColumn =
    static_cast<int>(AlertModel::Column::Distance);
 static constexpr int kNumColumns = kLastColumn - kFirstColumn + 1;
 
+// Distances to the alert centroids are displayed truncated to whole kilometers
+// or miles, so small movements of the map do not need to be recalculated. A
+// displayed distance is at most 250 m stale, a quarter of the smallest display
+// unit. The staleness does not grow with the distance to the alert, unlike the
+// error of spherical distances (0.6%, or 250 m at 40 km), so it is not scaled.
+static constexpr units::length::meters<double> kDistanceUpdateThreshold_ {
+   250.0};
+
 class AlertModelImpl
 {
 public:
@@ -49,12 +59,17 @@ public:
                       GetEndTime(const types::TextEventKey& key);
    static std::string GetEndTimeString(const types::TextEventKey& key);
 
+   static util::DistanceAccuracy GetDistanceAccuracy();
+   static double                 GetDistanceScale();
+   static std::uint32_t GetDisplayDistance(double distance,
+                                           double distanceScale);
+
+   double GetDistance(std::size_t row) const;
+
    std::shared_ptr<manager::TextEventManager> textEventManager_;
 
    QList<types::TextEventKey> textEventKeys_;
 
-   const GeographicLib::Geodesic& geodesic_;
-
    std::unordered_map<types::TextEventKey,
                       bool,
                       types::TextEventHash<types::TextEventKey>>
@@ -71,11 +86,12 @@ public:
                       common::Coordinate,
                       types::TextEventHash<types::TextEventKey>>
       centroidMap_;
-   std::unordered_map<types::TextEventKey,
-                      double,
-                      types::TextEventHash<types::TextEventKey>>
-                            distanceMap_;
+
+   // Centroid and distance of each row
+   util::DistanceBatch      centroids_;
+   std::vector<double>      distances_;
    scwx::common::Coordinate previousPosition_;
+   util::DistanceAccuracy   distanceAccuracy_;
 };
 
 AlertModel::AlertModel(QObject* parent) :
@@ -192,14 +208,13 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
                types::GetDistanceUnitsAbbreviation(distanceUnits);
 
             return QString("%1 %2")
-               .arg(static_cast<uint32_t>(p->distanceMap_.at(textEventKey) *
-                                          scwx::common::kKilometersPerMeter *
-                                          distanceScale))
+               .arg(AlertModelImpl::GetDisplayDistance(
+                  p->distances_.at(index.row()), distanceScale))
                .arg(QString::fromStdString(abbreviation));
          }
          else
          {
-            return p->distanceMap_.at(textEventKey);
+            return p->distances_.at(index.row());
          }
 
       default:
@@ -333,12 +348,17 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
 {
    logger_->trace("Handle alert: {}", alertKey.ToString());
 
-   double distanceInMeters;
-
    // Get the most recent segment for the event
-   auto alertMessages = p->textEventManager_->message_list(alertKey);
+   auto alertMessage = p->textEventManager_->message(alertKey, messageIndex);
+   if (alertMessage == nullptr)
+   {
+      logger_->warn("Handle alert: No message associated with key: {}",
+                    alertKey.ToString());
+      return;
+   }
+
    std::shared_ptr<const awips::Segment> alertSegment =
-      alertMessages[messageIndex]->segments().back();
+      alertMessage->segments().back();
 
    p->observedMap_.insert_or_assign(alertKey, alertSegment->observed_);
    p->threatCategoryMap_.insert_or_assign(alertKey,
@@ -348,37 +368,35 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
 
    if (alertSegment->codedLocation_.has_value())
    {
-      // Update centroid and distance
-      common::Coordinate centroid =
-         common::GetCentroid(alertSegment->codedLocation_->coordinates());
-
-      p->geodesic_.Inverse(p->previousPosition_.latitude_,
-                           p->previousPosition_.longitude_,
-                           centroid.latitude_,
-                           centroid.longitude_,
-                           distanceInMeters);
-
-      p->centroidMap_.insert_or_assign(alertKey, centroid);
-      p->distanceMap_.insert_or_assign(alertKey, distanceInMeters);
+      // Update centroid
+      p->centroidMap_.insert_or_assign(
+         alertKey,
+         common::GetCentroid(alertSegment->codedLocation_->coordinates()));
    }
    else if (!p->centroidMap_.contains(alertKey))
    {
       // The alert has no location, so provide a default
       p->centroidMap_.insert_or_assign(alertKey, common::Coordinate {0.0, 0.0});
-      p->distanceMap_.insert_or_assign(alertKey, 0.0);
    }
 
+   const common::Coordinate& centroid = p->centroidMap_.at(alertKey);
+
    // Update row
    if (!p->textEventKeys_.contains(alertKey))
    {
       int newIndex = p->textEventKeys_.size();
       beginInsertRows(QModelIndex(), newIndex, newIndex);
       p->textEventKeys_.push_back(alertKey);
+      p->centroids_.Add(centroid);
+      p->distances_.push_back(p->GetDistance(newIndex));
       endInsertRows();
    }
    else
    {
-      const int   row         = p->textEventKeys_.indexOf(alertKey);
+      const int row = p->textEventKeys_.indexOf(alertKey);
+      p->centroids_.Set(row, centroid);
+      p->distances_[row] = p->GetDistance(row);
+
       QModelIndex topLeft     = createIndex(row, kFirstColumn);
       QModelIndex bottomRight = createIndex(row, kLastColumn);
 
@@ -388,41 +406,132 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
 
 void AlertModel::HandleMapUpdate(double latitude, double longitude)
 {
+   // A change in accuracy recalculates each distance, even if the map has not
+   // moved
+   const util::DistanceAccuracy distanceAccuracy =
+      AlertModelImpl::GetDistanceAccuracy();
+
+   if (distanceAccuracy == p->distanceAccuracy_ &&
+       util::GeographicLib::GetDistance(p->previousPosition_.latitude_,
+                                        p->previousPosition_.longitude_,
+                                        latitude,
+                                        longitude) < kDistanceUpdateThreshold_)
+   {
+      return;
+   }
+
    logger_->trace("Handle map update: {}, {}", latitude, longitude);
 
-   double distanceInMeters;
+   p->previousPosition_ = {latitude, longitude};
+   p->distanceAccuracy_ = distanceAccuracy;
+
+   std::vector<double> distances(p->distances_.size());
+   p->centroids_.GetDistances(
+      p->previousPosition_, distances, p->distanceAccuracy_);
 
-   for (const auto& textEvent : p->textEventKeys_)
+   enum class Change
    {
-      auto& centroid = p->centroidMap_.at(textEvent);
+      None,
+      Sort,
+      Display
+   };
+
+   const double distanceScale = AlertModelImpl::GetDistanceScale();
+   const int    column        = static_cast<int>(Column::Distance);
+   const int    rowCount      = static_cast<int>(distances.size());
 
-      if (centroid != common::Coordinate {0.0, 0.0})
+   std::vector<Change> changes(distances.size(), Change::None);
+
+   for (int row = 0; row < rowCount; ++row)
+   {
+      if (p->centroids_.coordinate(row) == common::Coordinate {0.0, 0.0} ||
+          p->distances_[row] == distances[row])
       {
-         p->geodesic_.Inverse(latitude,
-                              longitude,
-                              centroid.latitude_,
-                              centroid.longitude_,
-                              distanceInMeters);
-         p->distanceMap_.insert_or_assign(textEvent, distanceInMeters);
+         continue;
       }
+
+      // Rows where only the sort value has changed are signaled separately,
+      // so the view is only redrawn where the displayed distance has changed
+      changes[row] =
+         (AlertModelImpl::GetDisplayDistance(p->distances_[row],
+                                             distanceScale) !=
+          AlertModelImpl::GetDisplayDistance(distances[row], distanceScale)) ?
+            Change::Display :
+            Change::Sort;
+      p->distances_[row] = distances[row];
    }
 
-   p->previousPosition_ = {latitude, longitude};
+   // Invalidate changed rows, grouped into contiguous ranges of the same
+   // change
+   for (int row = 0; row < rowCount;)
+   {
+      const Change change = changes[row];
+      int          last   = row;
 
-   QModelIndex topLeft = createIndex(0, static_cast<int>(Column::Distance));
-   QModelIndex bottomRight =
-      createIndex(rowCount() - 1, static_cast<int>(Column::Distance));
+      while (last + 1 < rowCount && changes[last + 1] == change)
+      {
+         ++last;
+      }
+
+      if (change == Change::Display)
+      {
+         Q_EMIT dataChanged(createIndex(row, column),
+                            createIndex(last, column),
+                            {Qt::ItemDataRole::DisplayRole,
+                             types::ItemDataRole::SortRole});
+      }
+      else if (change == Change::Sort)
+      {
+         Q_EMIT dataChanged(createIndex(row, column),
+                            createIndex(last, column),
+                            {types::ItemDataRole::SortRole});
+      }
 
-   Q_EMIT dataChanged(topLeft, bottomRight);
+      row = last + 1;
+   }
 }
 
 AlertModelImpl::AlertModelImpl() :
     textEventManager_ {manager::TextEventManager::Instance()},
     textEventKeys_ {},
-    geodesic_(util::GeographicLib::DefaultGeodesic()),
-    distanceMap_ {},
-    previousPosition_ {}
+    centroids_ {},
+    distances_ {},
+    previousPosition_ {},
+    distanceAccuracy_ {GetDistanceAccuracy()}
+{
+}
+
+double AlertModelImpl::GetDistance(std::size_t row) const
+{
+   // Alerts without a location have no distance
+   if (centroids_.coordinate(row) == common::Coordinate {0.0, 0.0})
+   {
+      return 0.0;
+   }
+
+   return centroids_.GetDistance(row, previousPosition_, distanceAccuracy_);
+}
+
+util::DistanceAccuracy AlertModelImpl::GetDistanceAccuracy()
+{
+   auto& distanceAccuracy =
+      settings::GeneralSettings::Instance().alert_distance_accuracy();
+   return util::GetDistanceAccuracy(distanceAccuracy.GetValue());
+}
+
+double AlertModelImpl::GetDistanceScale()
+{
+   const std::string distanceUnitName =
+      settings::UnitSettings::Instance().distance_units().GetValue();
+   return types::GetDistanceUnitsScale(
+      types::GetDistanceUnitsFromName(distanceUnitName));
+}
+
+std::uint32_t AlertModelImpl::GetDisplayDistance(double distance,
+                                                 double distanceScale)
 {
+   return static_cast<std::uint32_t>(
+      distance * scwx::common::kKilometersPerMeter * distanceScale);
 }
 
 bool AlertModelImpl::GetObserved(const types::TextEventKey& key)
@@ -467,11 +576,11 @@ bool AlertModelImpl::GetTornadoPossible(const types::TextEventKey& key)
 
 std::string AlertModelImpl::GetCounties(const types::TextEventKey& key)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
+   auto lastMessage =
+      manager::TextEventManager::Instance()->latest_message(key);
 
-   if (messageList.size() > 0)
+   if (lastMessage != nullptr)
    {
-      auto&  lastMessage  = messageList.back();
       size_t segmentCount = lastMessage->segment_count();
       auto   lastSegment  = lastMessage->segment(segmentCount - 1);
       auto   fipsIds      = lastSegment->header_->ugc_.fips_ids();
@@ -496,11 +605,11 @@ std::string AlertModelImpl::GetCounties(const types::TextEventKey& key)
 
 std::string AlertModelImpl::GetState(const types::TextEventKey& key)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
+   auto lastMessage =
+      manager::TextEventManager::Instance()->latest_message(key);
 
-   if (messageList.size() > 0)
+   if (lastMessage != nullptr)
    {
-      auto&  lastMessage  = messageList.back();
       size_t segmentCount = lastMessage->segment_count();
       auto   lastSegment  = lastMessage->segment(segmentCount - 1);
       return scwx::util::ToString(lastSegment->header_->ugc_.states());
@@ -516,11 +625,10 @@ std::string AlertModelImpl::GetState(const types::TextEventKey& key)
 std::chrono::system_clock::time_point
 AlertModelImpl::GetStartTime(const types::TextEventKey& key)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
+   auto firstMessage = manager::TextEventManager::Instance()->message(key, 0);
 
-   if (messageList.size() > 0)
+   if (firstMessage != nullptr)
    {
-      auto& firstMessage = messageList.front();
       return firstMessage->segment_event_begin(0);
    }
    else
@@ -539,14 +647,13 @@ std::string AlertModelImpl::GetStartTimeString(const types::TextEventKey& key)
 std::chrono::system_clock::time_point
 AlertModelImpl::GetEndTime(const types::TextEventKey& key)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
+   // The store ends a cancelled or upgraded event when it is issued, matching
+   // the active alert filter
+   auto endTime = manager::TextEventManager::Instance()->event_end(key);
 
-   if (messageList.size() > 0)
+   if (endTime.has_value())
    {
-      auto&  lastMessage  = messageList.back();
-      size_t segmentCount = lastMessage->segment_count();
-      auto   lastSegment  = lastMessage->segment(segmentCount - 1);
-      return lastSegment->header_->vtecString_[0].pVtec_.event_end();
+      return *endTime;
    }
    else
    {
@@ -1,11 +1,13 @@
 #include <scwx/qt/model/alert_proxy_model.hpp>
 #include <scwx/qt/model/alert_model.hpp>
-#include <scwx/qt/types/qt_types.hpp>
+#include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
+#include <unordered_set>
 
 #include <boost/asio/steady_timer.hpp>
 
@@ -25,6 +27,7 @@ public:
    explicit AlertProxyModelImpl(AlertProxyModel* self);
    ~AlertProxyModelImpl();
 
+   void UpdateActiveAlerts();
    void UpdateAlerts();
 
    AlertProxyModel* self_;
@@ -33,6 +36,17 @@ public:
 
    boost::asio::steady_timer alertUpdateTimer_;
    std::mutex                alertMutex_ {};
+
+   std::shared_ptr<manager::TextEventManager> textEventManager_ {
+      manager::TextEventManager::Instance()};
+
+   // Alerts which have not ended, as of the last update, and the text event
+   // version they were determined from
+   std::unordered_set<types::TextEventKey,
+                      types::TextEventHash<types::TextEventKey>>
+                              activeAlerts_ {};
+   std::atomic<std::uint64_t> activeAlertsVersion_ {0u};
+   std::mutex                 activeAlertsMutex_ {};
 };
 
 AlertProxyModel::AlertProxyModel(QObject* parent) :
@@ -45,6 +59,7 @@ AlertProxyModel::~AlertProxyModel() = default;
 void AlertProxyModel::SetAlertActiveFilter(bool enabled)
 {
    p->alertActiveFilterEnabled_ = enabled;
+   p->UpdateActiveAlerts();
    invalidateRowsFilter();
 }
 
@@ -53,24 +68,21 @@ bool AlertProxyModel::filterAcceptsRow(int                sourceRow,
 {
    bool acceptAlertActiveFilter = true;
 
-   if (p->alertActiveFilterEnabled_)
+   const AlertModel* alertModel = dynamic_cast<AlertModel*>(sourceModel());
+
+   if (p->alertActiveFilterEnabled_ && alertModel != nullptr)
    {
-      // Get source model index
-      QModelIndex endTimeIndex =
-         sourceModel()->index(sourceRow,
-                              static_cast<int>(AlertModel::Column::EndTime),
-                              sourceParent);
-
-      // Get source end time
-      auto endTime = sourceModel()
-                        ->data(endTimeIndex, types::TimePointRole)
-                        .value<std::chrono::system_clock::time_point>();
-
-      // Compare end time to current
-      if (endTime < std::chrono::system_clock::now())
+      // Alerts added since the last update are not yet in the active set
+      if (p->textEventManager_->version() != p->activeAlertsVersion_)
       {
-         acceptAlertActiveFilter = false;
+         p->UpdateActiveAlerts();
       }
+
+      const types::TextEventKey key =
+         alertModel->key(alertModel->index(sourceRow, 0, sourceParent));
+
+      std::unique_lock lock(p->activeAlertsMutex_);
+      acceptAlertActiveFilter = p->activeAlerts_.contains(key);
    }
 
    return acceptAlertActiveFilter &&
@@ -92,6 +104,23 @@ AlertProxyModelImpl::~AlertProxyModelImpl()
    alertUpdateTimer_.cancel();
 }
 
+void AlertProxyModelImpl::UpdateActiveAlerts()
+{
+   // Read the version first, so alerts added during the query are picked up
+   // by the next update
+   const std::uint64_t version = textEventManager_->version();
+   const auto          now     = std::chrono::system_clock::now();
+
+   const std::vector<types::TextEventKey> activeAlerts =
+      textEventManager_->GetActiveEvents(
+         now, std::chrono::system_clock::time_point::max());
+
+   std::unique_lock lock(activeAlertsMutex_);
+   activeAlerts_.clear();
+   activeAlerts_.insert(activeAlerts.cbegin(), activeAlerts.cend());
+   activeAlertsVersion_ = version;
+}
+
 void AlertProxyModelImpl::UpdateAlerts()
 {
    logger_->trace("UpdateAlerts");
@@ -102,6 +131,7 @@ void AlertProxyModelImpl::UpdateAlerts()
    // Re-evaluate for expired alerts
    if (alertActiveFilterEnabled_)
    {
+      UpdateActiveAlerts();
       self_->invalidateRowsFilter();
    }
 
@@ -40,6 +40,7 @@ public:
       alertRadius_.SetDefault(0.0);
       alertRadarSite_.SetDefault("default");
       alertWFO_.SetDefault("");
+      alertOnAreaEntry_.SetDefault(false);
       ignoreMissingCodecs_.SetDefault(false);
 
       alertLatitude_.SetMinimum(-90.0);
@@ -104,6 +105,7 @@ public:
    SettingsVariable<double>      alertRadius_ {"alert_radius"};
    SettingsVariable<std::string> alertCounty_ {"alert_county"};
    SettingsVariable<std::string> alertWFO_ {"alert_wfo"};
+   SettingsVariable<bool>        alertOnAreaEntry_ {"alert_on_area_entry"};
    SettingsVariable<bool>        ignoreMissingCodecs_ {"ignore_missing_codecs"};
 
    std::unordered_map<awips::Phenomenon, SettingsVariable<bool>>
@@ -122,6 +124,7 @@ AudioSettings::AudioSettings() :
                       &p->alertRadius_,
                       &p->alertCounty_,
                       &p->alertWFO_,
+                      &p->alertOnAreaEntry_,
                       &p->ignoreMissingCodecs_});
    RegisterVariables(p->variables_);
    SetDefaults();
@@ -184,6 +187,11 @@ AudioSettings::alert_enabled(awips::Phenomenon phenomenon) const
    return alert->second;
 }
 
+SettingsVariable<bool>& AudioSettings::alert_on_area_entry() const
+{
+   return p->alertOnAreaEntry_;
+}
+
 SettingsVariable<bool>& AudioSettings::ignore_missing_codecs() const
 {
    return p->ignoreMissingCodecs_;
@@ -205,6 +213,7 @@ bool operator==(const AudioSettings& lhs, const AudioSettings& rhs)
            lhs.p->alertRadius_ == rhs.p->alertRadius_ &&
            lhs.p->alertCounty_ == rhs.p->alertCounty_ &&
            lhs.p->alertWFO_ == rhs.p->alertWFO_ &&
+           lhs.p->alertOnAreaEntry_ == rhs.p->alertOnAreaEntry_ &&
            lhs.p->alertEnabled_ == rhs.p->alertEnabled_);
 }
 
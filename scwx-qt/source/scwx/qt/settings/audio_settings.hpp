@@ -35,6 +35,7 @@ public:
    SettingsVariable<std::string>& alert_county() const;
    SettingsVariable<std::string>& alert_wfo() const;
    SettingsVariable<bool>& alert_enabled(awips::Phenomenon phenomenon) const;
+   SettingsVariable<bool>& alert_on_area_entry() const;
    SettingsVariable<bool>& ignore_missing_codecs() const;
 
    static AudioSettings& Instance();
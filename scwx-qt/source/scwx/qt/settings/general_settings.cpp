@@ -6,6 +6,7 @@
 #include <scwx/qt/types/location_types.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/types/time_types.hpp>
+#include <scwx/qt/util/distance_batch.hpp>
 #include <scwx/util/time.hpp>
 
 #include <array>
@@ -30,6 +31,8 @@ public:
       const std::string defaultWarningsProviderValue =
          "https://warnings.cod.edu";
 
+      std::string defaultAlertDistanceAccuracyValue =
+         util::GetDistanceAccuracyName(util::DistanceAccuracy::Geodesic);
       std::string defaultClockFormatValue =
          scwx::util::GetClockFormatName(scwx::util::ClockFormat::_24Hour);
       std::string defaultDefaultAlertActionValue =
@@ -43,6 +46,7 @@ public:
       std::string defaultThemeValue =
          types::GetUiStyleName(types::UiStyle::Default);
 
+      boost::to_lower(defaultAlertDistanceAccuracyValue);
       boost::to_lower(defaultClockFormatValue);
       boost::to_lower(defaultDefaultAlertActionValue);
       boost::to_lower(defaultDefaultTimeZoneValue);
@@ -50,6 +54,7 @@ public:
       boost::to_lower(defaultPositioningPlugin);
       boost::to_lower(defaultThemeValue);
 
+      alertDistanceAccuracy_.SetDefault(defaultAlertDistanceAccuracyValue);
       antiAliasingEnabled_.SetDefault(true);
       clockFormat_.SetDefault(defaultClockFormatValue);
       customStyleDrawLayer_.SetDefault(".*\\.annotations\\.points");
@@ -66,9 +71,11 @@ public:
       mapProvider_.SetDefault(defaultMapProviderValue);
       mapboxApiKey_.SetDefault("?");
       maptilerApiKey_.SetDefault("?");
+      nexradCacheSize_.SetDefault(4096);
       nmeaBaudRate_.SetDefault(9600);
       nmeaSource_.SetDefault("");
       positioningPlugin_.SetDefault(defaultPositioningPlugin);
+      radarCacheBudget_.SetDefault(2048);
       showMapAttribution_.SetDefault(true);
       showMapCenter_.SetDefault(false);
       showMapLogo_.SetDefault(true);
@@ -94,8 +101,12 @@ public:
       loopSpeed_.SetMaximum(99.99);
       loopTime_.SetMinimum(1);
       loopTime_.SetMaximum(1440);
+      nexradCacheSize_.SetMinimum(0);
+      nexradCacheSize_.SetMaximum(1048576);
       nmeaBaudRate_.SetMinimum(1);
       nmeaBaudRate_.SetMaximum(999999999);
+      radarCacheBudget_.SetMinimum(256);
+      radarCacheBudget_.SetMaximum(65536);
       radarSiteThreshold_.SetMinimum(-10000);
       radarSiteThreshold_.SetMaximum(10000);
 
@@ -104,6 +115,10 @@ public:
       customStyleUrl_.SetTransform([](const std::string& value)
                                    { return boost::trim_copy(value); });
 
+      alertDistanceAccuracy_.SetValidator(
+         SCWX_SETTINGS_ENUM_VALIDATOR(util::DistanceAccuracy,
+                                      util::DistanceAccuracyIterator(),
+                                      util::GetDistanceAccuracyName));
       clockFormat_.SetValidator(
          SCWX_SETTINGS_ENUM_VALIDATOR(scwx::util::ClockFormat,
                                       scwx::util::ClockFormatIterator(),
@@ -141,6 +156,8 @@ public:
 
    ~Impl() {}
 
+   SettingsVariable<std::string> alertDistanceAccuracy_ {
+      "alert_distance_accuracy"};
    SettingsVariable<bool>        antiAliasingEnabled_ {"anti_aliasing_enabled"};
    SettingsVariable<std::string> clockFormat_ {"clock_format"};
    SettingsVariable<std::string> customStyleDrawLayer_ {
@@ -159,9 +176,11 @@ public:
    SettingsVariable<std::string>                mapProvider_ {"map_provider"};
    SettingsVariable<std::string>  mapboxApiKey_ {"mapbox_api_key"};
    SettingsVariable<std::string>  maptilerApiKey_ {"maptiler_api_key"};
+   SettingsVariable<std::int64_t> nexradCacheSize_ {"nexrad_cache_size"};
    SettingsVariable<std::int64_t> nmeaBaudRate_ {"nmea_baud_rate"};
    SettingsVariable<std::string>  nmeaSource_ {"nmea_source"};
    SettingsVariable<std::string>  positioningPlugin_ {"positioning_plugin"};
+   SettingsVariable<std::int64_t> radarCacheBudget_ {"radar_cache_budget"};
    SettingsVariable<bool>         showMapAttribution_ {"show_map_attribution"};
    SettingsVariable<bool>         showMapCenter_ {"show_map_center"};
    SettingsVariable<bool>         showMapLogo_ {"show_map_logo"};
@@ -177,7 +196,8 @@ public:
 GeneralSettings::GeneralSettings() :
     SettingsCategory("general"), p(std::make_unique<Impl>())
 {
-   RegisterVariables({&p->antiAliasingEnabled_,
+   RegisterVariables({&p->alertDistanceAccuracy_,
+                      &p->antiAliasingEnabled_,
                       &p->clockFormat_,
                       &p->customStyleDrawLayer_,
                       &p->customStyleUrl_,
@@ -194,9 +214,11 @@ GeneralSettings::GeneralSettings() :
                       &p->mapProvider_,
                       &p->mapboxApiKey_,
                       &p->maptilerApiKey_,
+                      &p->nexradCacheSize_,
                       &p->nmeaBaudRate_,
                       &p->nmeaSource_,
                       &p->positioningPlugin_,
+                      &p->radarCacheBudget_,
                       &p->showMapAttribution_,
                       &p->showMapCenter_,
                       &p->showMapLogo_,
@@ -215,6 +237,11 @@ GeneralSettings::GeneralSettings(GeneralSettings&&) noexcept = default;
 GeneralSettings&
 GeneralSettings::operator=(GeneralSettings&&) noexcept = default;
 
+SettingsVariable<std::string>& GeneralSettings::alert_distance_accuracy() const
+{
+   return p->alertDistanceAccuracy_;
+}
+
 SettingsVariable<bool>& GeneralSettings::anti_aliasing_enabled() const
 {
    return p->antiAliasingEnabled_;
@@ -301,6 +328,11 @@ SettingsVariable<std::string>& GeneralSettings::maptiler_api_key() const
    return p->maptilerApiKey_;
 }
 
+SettingsVariable<std::int64_t>& GeneralSettings::nexrad_cache_size() const
+{
+   return p->nexradCacheSize_;
+}
+
 SettingsVariable<std::int64_t>& GeneralSettings::nmea_baud_rate() const
 {
    return p->nmeaBaudRate_;
@@ -316,6 +348,11 @@ SettingsVariable<std::string>& GeneralSettings::positioning_plugin() const
    return p->positioningPlugin_;
 }
 
+SettingsVariable<std::int64_t>& GeneralSettings::radar_cache_budget() const
+{
+   return p->radarCacheBudget_;
+}
+
 SettingsVariable<bool>& GeneralSettings::show_map_attribution() const
 {
    return p->showMapAttribution_;
@@ -387,7 +424,8 @@ GeneralSettings& GeneralSettings::Instance()
 
 bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
 {
-   return (lhs.p->antiAliasingEnabled_ == rhs.p->antiAliasingEnabled_ &&
+   return (lhs.p->alertDistanceAccuracy_ == rhs.p->alertDistanceAccuracy_ &&
+           lhs.p->antiAliasingEnabled_ == rhs.p->antiAliasingEnabled_ &&
            lhs.p->clockFormat_ == rhs.p->clockFormat_ &&
            lhs.p->customStyleDrawLayer_ == rhs.p->customStyleDrawLayer_ &&
            lhs.p->customStyleUrl_ == rhs.p->customStyleUrl_ &&
@@ -404,9 +442,11 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->mapProvider_ == rhs.p->mapProvider_ &&
            lhs.p->mapboxApiKey_ == rhs.p->mapboxApiKey_ &&
            lhs.p->maptilerApiKey_ == rhs.p->maptilerApiKey_ &&
+           lhs.p->nexradCacheSize_ == rhs.p->nexradCacheSize_ &&
            lhs.p->nmeaBaudRate_ == rhs.p->nmeaBaudRate_ &&
            lhs.p->nmeaSource_ == rhs.p->nmeaSource_ &&
            lhs.p->positioningPlugin_ == rhs.p->positioningPlugin_ &&
+           lhs.p->radarCacheBudget_ == rhs.p->radarCacheBudget_ &&
            lhs.p->showMapAttribution_ == rhs.p->showMapAttribution_ &&
            lhs.p->showMapCenter_ == rhs.p->showMapCenter_ &&
            lhs.p->showMapLogo_ == rhs.p->showMapLogo_ &&
@@ -25,6 +25,7 @@ public:
    GeneralSettings(GeneralSettings&&) noexcept;
    GeneralSettings& operator=(GeneralSettings&&) noexcept;
 
+   SettingsVariable<std::string>& alert_distance_accuracy() const;
    SettingsVariable<bool>&        anti_aliasing_enabled() const;
    SettingsVariable<std::string>& clock_format() const;
    SettingsVariable<std::string>& custom_style_draw_layer() const;
@@ -42,9 +43,11 @@ public:
    SettingsVariable<std::string>&                map_provider() const;
    SettingsVariable<std::string>&                mapbox_api_key() const;
    SettingsVariable<std::string>&                maptiler_api_key() const;
+   SettingsVariable<std::int64_t>&               nexrad_cache_size() const;
    SettingsVariable<std::int64_t>&               nmea_baud_rate() const;
    SettingsVariable<std::string>&                nmea_source() const;
    SettingsVariable<std::string>&                positioning_plugin() const;
+   SettingsVariable<std::int64_t>&               radar_cache_budget() const;
    SettingsVariable<bool>&                       show_map_attribution() const;
    SettingsVariable<bool>&                       show_map_center() const;
    SettingsVariable<bool>&                       show_map_logo() const;
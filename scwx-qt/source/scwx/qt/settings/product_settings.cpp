@@ -15,6 +15,7 @@ class ProductSettings::Impl
 public:
    explicit Impl()
    {
+      exactSweepCoordinates_.SetDefault(false);
       showSmoothedRangeFolding_.SetDefault(false);
       stiForecastEnabled_.SetDefault(true);
       stiPastEnabled_.SetDefault(true);
@@ -22,6 +23,7 @@ public:
 
    ~Impl() {}
 
+   SettingsVariable<bool> exactSweepCoordinates_ {"exact_sweep_coordinates"};
    SettingsVariable<bool> showSmoothedRangeFolding_ {
       "show_smoothed_range_folding"};
    SettingsVariable<bool> stiForecastEnabled_ {"sti_forecast_enabled"};
@@ -31,7 +33,8 @@ public:
 ProductSettings::ProductSettings() :
     SettingsCategory("product"), p(std::make_unique<Impl>())
 {
-   RegisterVariables({&p->showSmoothedRangeFolding_,
+   RegisterVariables({&p->exactSweepCoordinates_,
+                      &p->showSmoothedRangeFolding_,
                       &p->stiForecastEnabled_,
                       &p->stiPastEnabled_});
    SetDefaults();
@@ -42,6 +45,11 @@ ProductSettings::ProductSettings(ProductSettings&&) noexcept = default;
 ProductSettings&
 ProductSettings::operator=(ProductSettings&&) noexcept = default;
 
+SettingsVariable<bool>& ProductSettings::exact_sweep_coordinates()
+{
+   return p->exactSweepCoordinates_;
+}
+
 SettingsVariable<bool>& ProductSettings::show_smoothed_range_folding()
 {
    return p->showSmoothedRangeFolding_;
@@ -76,7 +84,8 @@ ProductSettings& ProductSettings::Instance()
 
 bool operator==(const ProductSettings& lhs, const ProductSettings& rhs)
 {
-   return (lhs.p->showSmoothedRangeFolding_ ==
+   return (lhs.p->exactSweepCoordinates_ == rhs.p->exactSweepCoordinates_ &&
+           lhs.p->showSmoothedRangeFolding_ ==
               rhs.p->showSmoothedRangeFolding_ &&
            lhs.p->stiForecastEnabled_ == rhs.p->stiForecastEnabled_ &&
            lhs.p->stiPastEnabled_ == rhs.p->stiPastEnabled_);
@@ -25,6 +25,7 @@ public:
    ProductSettings(ProductSettings&&) noexcept;
    ProductSettings& operator=(ProductSettings&&) noexcept;
 
+   SettingsVariable<bool>& exact_sweep_coordinates();
    SettingsVariable<bool>& show_smoothed_range_folding();
    SettingsVariable<bool>& sti_forecast_enabled();
    SettingsVariable<bool>& sti_past_enabled();
@@ -123,6 +123,11 @@ common::RadarProductGroup RadarProductRecord::radar_product_group() const
    return p->radarProductGroup_;
 }
 
+std::size_t RadarProductRecord::resident_bytes() const
+{
+   return p->nexradFile_->resident_bytes();
+}
+
 std::string RadarProductRecord::site_id() const
 {
    return p->siteId_;
@@ -35,6 +35,7 @@ public:
    std::string                           radar_id() const;
    std::string                           radar_product() const;
    common::RadarProductGroup             radar_product_group() const;
+   std::size_t                           resident_bytes() const;
    std::string                           site_id() const;
    std::chrono::system_clock::time_point time() const;
 
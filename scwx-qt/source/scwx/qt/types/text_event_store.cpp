@@ -0,0 +1,303 @@
+#include <scwx/qt/types/text_event_store.hpp>
+
+#include <algorithm>
+#include <map>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+typedef std::chrono::system_clock::time_point TimePoint;
+
+class TextEventStore::Impl
+{
+public:
+   struct Event
+   {
+      std::shared_ptr<const MessageList> messages_ {};
+      TimePoint                          begin_ {};
+      TimePoint                          end_ {};
+   };
+
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static TimePoint GetEventBegin(const awips::TextProductMessage& message);
+   static TimePoint GetEventEnd(const TextEventKey&               key,
+                                const awips::TextProductMessage& message);
+
+   void UpdateTimeIndex(const TextEventKey& key, Event& event);
+
+   std::unordered_map<TextEventKey, Event, TextEventHash<TextEventKey>>
+      events_ {};
+
+   // Events in the order they were added, by phenomenon and by office
+   std::unordered_map<awips::Phenomenon, std::vector<TextEventKey>>
+      phenomenonIndex_ {};
+   std::unordered_map<std::string, std::vector<TextEventKey>>
+      officeIndex_ {};
+
+   // Events ordered by end time, to find events which have not yet ended
+   std::multimap<TimePoint, TextEventKey> endTimeIndex_ {};
+
+   std::uint64_t version_ {0u};
+
+   mutable std::shared_mutex mutex_ {};
+};
+
+static const std::shared_ptr<const TextEventStore::MessageList>
+   kEmptyMessageList_ = std::make_shared<TextEventStore::MessageList>();
+
+TextEventStore::TextEventStore() : p(std::make_unique<Impl>()) {}
+TextEventStore::~TextEventStore() = default;
+
+std::uint64_t TextEventStore::version() const
+{
+   std::shared_lock lock(p->mutex_);
+   return p->version_;
+}
+
+std::size_t TextEventStore::event_count() const
+{
+   std::shared_lock lock(p->mutex_);
+   return p->events_.size();
+}
+
+std::size_t TextEventStore::message_count(const TextEventKey& key) const
+{
+   return message_list(key)->size();
+}
+
+std::shared_ptr<const TextEventStore::MessageList>
+TextEventStore::message_list(const TextEventKey& key) const
+{
+   std::shared_lock lock(p->mutex_);
+
+   auto it = p->events_.find(key);
+   if (it != p->events_.cend())
+   {
+      return it->second.messages_;
+   }
+
+   return kEmptyMessageList_;
+}
+
+std::shared_ptr<awips::TextProductMessage>
+TextEventStore::message(const TextEventKey& key, std::size_t i) const
+{
+   auto messages = message_list(key);
+
+   if (i < messages->size())
+   {
+      return messages->at(i);
+   }
+
+   return nullptr;
+}
+
+std::shared_ptr<awips::TextProductMessage>
+TextEventStore::latest_message(const TextEventKey& key) const
+{
+   auto messages = message_list(key);
+
+   if (!messages->empty())
+   {
+      return messages->back();
+   }
+
+   return nullptr;
+}
+
+std::optional<std::chrono::system_clock::time_point>
+TextEventStore::event_end(const TextEventKey& key) const
+{
+   std::shared_lock lock(p->mutex_);
+
+   auto it = p->events_.find(key);
+   if (it != p->events_.cend())
+   {
+      return it->second.end_;
+   }
+
+   return std::nullopt;
+}
+
+std::optional<std::size_t>
+TextEventStore::Add(const TextEventKey&                        key,
+                    std::shared_ptr<awips::TextProductMessage> message)
+{
+   std::unique_lock lock(p->mutex_);
+
+   auto [it, inserted] = p->events_.try_emplace(key);
+   Impl::Event& event  = it->second;
+
+   if (inserted)
+   {
+      p->phenomenonIndex_[key.phenomenon_].push_back(key);
+      p->officeIndex_[key.officeId_].push_back(key);
+   }
+   else if (std::find_if(event.messages_->cbegin(),
+                         event.messages_->cend(),
+                         [&](auto& storedMessage)
+                         {
+                            return *message->wmo_header().get() ==
+                                   *storedMessage->wmo_header().get();
+                         }) != event.messages_->cend())
+   {
+      // This message has already been stored (WMO header equivalence check)
+      return std::nullopt;
+   }
+
+   // Publish a new message list. Readers holding the previous list are not
+   // affected. Events have few messages, so the copy is inexpensive.
+   auto messages = inserted ? std::make_shared<MessageList>() :
+                              std::make_shared<MessageList>(*event.messages_);
+   messages->push_back(message);
+
+   const std::size_t messageIndex = messages->size() - 1u;
+
+   event.messages_ = std::move(messages);
+   p->UpdateTimeIndex(key, event);
+
+   ++p->version_;
+
+   return messageIndex;
+}
+
+void TextEventStore::Impl::UpdateTimeIndex(const TextEventKey& key,
+                                           Event&              event)
+{
+   // Remove the previous entry for the event
+   if (event.messages_->size() > 1u)
+   {
+      auto range = endTimeIndex_.equal_range(event.end_);
+      for (auto it = range.first; it != range.second; ++it)
+      {
+         if (it->second == key)
+         {
+            endTimeIndex_.erase(it);
+            break;
+         }
+      }
+   }
+
+   // The event begins with the first message, and ends with the latest
+   event.begin_ = GetEventBegin(*event.messages_->front());
+   event.end_   = GetEventEnd(key, *event.messages_->back());
+
+   endTimeIndex_.emplace(event.end_, key);
+}
+
+TimePoint
+TextEventStore::Impl::GetEventBegin(const awips::TextProductMessage& message)
+{
+   return (message.segment_count() > 0) ? message.segment_event_begin(0) :
+                                          TimePoint {};
+}
+
+TimePoint
+TextEventStore::Impl::GetEventEnd(const TextEventKey&               key,
+                                  const awips::TextProductMessage& message)
+{
+   std::optional<TimePoint> eventEnd {};
+
+   // A message may contain segments of other events, and may cancel the
+   // event in some segments while continuing it in others
+   for (auto& segment : message.segments())
+   {
+      if (!segment->header_.has_value() ||
+          segment->header_->vtecString_.empty())
+      {
+         continue;
+      }
+
+      const awips::PVtec& pVtec = segment->header_->vtecString_.front().pVtec_;
+      if (TextEventKey {pVtec} != key)
+      {
+         continue;
+      }
+
+      TimePoint segmentEnd = segment->event_end();
+
+      const awips::PVtec::Action action = pVtec.action();
+      if (action == awips::PVtec::Action::Canceled ||
+          action == awips::PVtec::Action::Upgraded)
+      {
+         // A cancelled or upgraded event ends when the message is issued. The
+         // event begin time of the segment is the issuance time, unless the
+         // event had not yet begun.
+         segmentEnd = std::min(segmentEnd, segment->event_begin());
+      }
+
+      eventEnd = std::max(eventEnd.value_or(segmentEnd), segmentEnd);
+   }
+
+   if (!eventEnd.has_value())
+   {
+      const std::size_t segmentCount = message.segment_count();
+      return (segmentCount > 0) ?
+                message.segment(segmentCount - 1)->event_end() :
+                TimePoint {};
+   }
+
+   return *eventEnd;
+}
+
+std::vector<TextEventKey>
+TextEventStore::GetEvents(awips::Phenomenon phenomenon) const
+{
+   std::shared_lock lock(p->mutex_);
+
+   auto it = p->phenomenonIndex_.find(phenomenon);
+   if (it != p->phenomenonIndex_.cend())
+   {
+      return it->second;
+   }
+
+   return {};
+}
+
+std::vector<TextEventKey>
+TextEventStore::GetEvents(const std::string& officeId) const
+{
+   std::shared_lock lock(p->mutex_);
+
+   auto it = p->officeIndex_.find(officeId);
+   if (it != p->officeIndex_.cend())
+   {
+      return it->second;
+   }
+
+   return {};
+}
+
+std::vector<TextEventKey>
+TextEventStore::GetActiveEvents(std::chrono::system_clock::time_point begin,
+                                std::chrono::system_clock::time_point end) const
+{
+   std::vector<TextEventKey> activeEvents {};
+
+   std::shared_lock lock(p->mutex_);
+
+   // Only events which end after the beginning of the range are checked
+   for (auto it = p->endTimeIndex_.lower_bound(begin);
+        it != p->endTimeIndex_.cend();
+        ++it)
+   {
+      if (p->events_.at(it->second).begin_ <= end)
+      {
+         activeEvents.push_back(it->second);
+      }
+   }
+
+   return activeEvents;
+}
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
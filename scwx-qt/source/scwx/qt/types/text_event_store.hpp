@@ -0,0 +1,125 @@
+#pragma once
+
+#include <scwx/awips/text_product_message.hpp>
+#include <scwx/qt/types/text_event_key.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+/**
+ * The TextEventStore class holds the messages of each text event. Messages
+ * are only appended, and the message list of an event is immutable once
+ * published, so a reader receives a snapshot of the list without copying it.
+ * Appending a message publishes a new list, and leaves existing snapshots
+ * unchanged.
+ *
+ * Events are indexed by phenomenon, office, and by the time they end, so
+ * queries do not scan every event.
+ */
+class TextEventStore
+{
+public:
+   typedef std::vector<std::shared_ptr<awips::TextProductMessage>> MessageList;
+
+   explicit TextEventStore();
+   ~TextEventStore();
+
+   TextEventStore(const TextEventStore&)            = delete;
+   TextEventStore& operator=(const TextEventStore&) = delete;
+
+   /**
+    * Number of messages added to the store. Incremented each time a message
+    * is added.
+    */
+   std::uint64_t version() const;
+
+   std::size_t event_count() const;
+
+   std::size_t message_count(const TextEventKey& key) const;
+
+   /**
+    * Snapshot of the messages of an event, in the order they were added.
+    *
+    * @return Message list, which is empty if the event is not in the store
+    */
+   std::shared_ptr<const MessageList>
+   message_list(const TextEventKey& key) const;
+
+   /**
+    * @return Message of an event, or nullptr if the index is out of range
+    */
+   std::shared_ptr<awips::TextProductMessage>
+   message(const TextEventKey& key, std::size_t i) const;
+
+   /**
+    * @return Most recently added message of an event, or nullptr if the event
+    * is not in the store
+    */
+   std::shared_ptr<awips::TextProductMessage>
+   latest_message(const TextEventKey& key) const;
+
+   /**
+    * End time of an event, as of its most recent message. A cancelled or
+    * upgraded event ends when the cancellation or upgrade is issued.
+    *
+    * @return End time, or std::nullopt if the event is not in the store
+    */
+   std::optional<std::chrono::system_clock::time_point>
+   event_end(const TextEventKey& key) const;
+
+   /**
+    * Adds a message to an event. The message is not added if the event
+    * already has a message with an equivalent WMO header.
+    *
+    * @param [in] key Text event
+    * @param [in] message Message to add
+    *
+    * @return Index of the message in the event, or std::nullopt if the
+    * message was not added
+    */
+   std::optional<std::size_t>
+   Add(const TextEventKey&                        key,
+       std::shared_ptr<awips::TextProductMessage> message);
+
+   /**
+    * Finds the events with a phenomenon, in the order they were added.
+    */
+   std::vector<TextEventKey> GetEvents(awips::Phenomenon phenomenon) const;
+
+   /**
+    * Finds the events issued by an office, in the order they were added.
+    */
+   std::vector<TextEventKey> GetEvents(const std::string& officeId) const;
+
+   /**
+    * Finds the events active at any time in a range. An event is active from
+    * the beginning of its first message until its end time (see event_end).
+    *
+    * @param [in] begin Beginning of the time range
+    * @param [in] end End of the time range
+    *
+    * @return Events active in the range, in order of end time
+    */
+   std::vector<TextEventKey>
+   GetActiveEvents(std::chrono::system_clock::time_point begin,
+                   std::chrono::system_clock::time_point end) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
@@ -98,32 +98,30 @@ bool AlertDialog::SelectAlert(const types::TextEventKey& key)
 
    setWindowTitle(QString::fromStdString(key.ToFullString()));
 
-   auto messages = p->textEventManager_->message_list(key);
-   if (messages.empty())
+   size_t messageCount = p->textEventManager_->message_count(key);
+   if (messageCount == 0u)
    {
       return false;
    }
 
-   p->SelectIndex(messages.size() - 1u);
+   p->SelectIndex(messageCount - 1u);
 
    return true;
 }
 
 void AlertDialogImpl::SelectIndex(size_t newIndex)
 {
-   size_t messageCount = textEventManager_->message_count(key_);
+   auto message = textEventManager_->message(key_, newIndex);
 
-   if (newIndex >= messageCount)
+   if (message == nullptr)
    {
       return;
    }
 
-   auto messages = textEventManager_->message_list(key_);
-
    currentIndex_ = newIndex;
 
    self_->ui->alertText->setText(
-      QString::fromStdString(messages[currentIndex_]->message_content()));
+      QString::fromStdString(message->message_content()));
 
    UpdateAlertInfo();
 }
@@ -131,7 +129,7 @@ void AlertDialogImpl::SelectIndex(size_t newIndex)
 void AlertDialogImpl::UpdateAlertInfo()
 {
    auto   messages     = textEventManager_->message_list(key_);
-   size_t messageCount = messages.size();
+   size_t messageCount = messages->size();
 
    bool firstSelected = (currentIndex_ == 0u);
    bool lastSelected  = (currentIndex_ == messageCount - 1u);
@@ -146,7 +144,7 @@ void AlertDialogImpl::UpdateAlertInfo()
       QObject::tr("%1 of %2").arg(currentIndex_ + 1u).arg(messageCount));
 
    // Update centroid
-   auto alertSegment = messages[currentIndex_]->segments().back();
+   auto alertSegment = messages->at(currentIndex_)->segments().back();
    if (alertSegment->codedLocation_.has_value())
    {
       centroid_ =
@@ -0,0 +1,228 @@
+#include "metrics_dialog.hpp"
+#include "ui_metrics_dialog.h"
+
+#include <scwx/qt/util/json.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <unordered_map>
+
+#include <boost/json.hpp>
+#include <QFileDialog>
+#include <QPushButton>
+#include <QTimer>
+#include <QTreeWidgetItem>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+static const std::string logPrefix_ = "scwx::qt::ui::metrics_dialog";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::chrono::milliseconds kUpdateInterval_ {1000};
+
+enum class Column : int
+{
+   Name  = 0,
+   Count = 1,
+   Mean  = 2,
+   P50   = 3,
+   P90   = 4,
+   P99   = 5,
+   Max   = 6
+};
+
+class MetricsDialog::Impl
+{
+public:
+   explicit Impl(MetricsDialog* self) : self_ {self} {};
+   ~Impl() = default;
+
+   void ExportJson(const std::string& path);
+   void SelectExportFile();
+   void Update();
+
+   static double Milliseconds(std::chrono::nanoseconds duration);
+
+   MetricsDialog*   self_;
+   QTimer*          updateTimer_ {nullptr};
+   QTreeWidgetItem* timersItem_ {nullptr};
+   QTreeWidgetItem* countersItem_ {nullptr};
+
+   std::unordered_map<std::string, QTreeWidgetItem*> counterItems_ {};
+   std::unordered_map<std::string, QTreeWidgetItem*> histogramItems_ {};
+};
+
+MetricsDialog::MetricsDialog(QWidget* parent) :
+    QDialog(parent), p {std::make_unique<Impl>(this)}, ui(new Ui::MetricsDialog)
+{
+   ui->setupUi(this);
+
+   p->timersItem_ =
+      new QTreeWidgetItem(ui->metricsTreeWidget, {tr("Timers (ms)")});
+   p->countersItem_ =
+      new QTreeWidgetItem(ui->metricsTreeWidget, {tr("Counters")});
+   p->timersItem_->setExpanded(true);
+   p->countersItem_->setExpanded(true);
+
+   QPushButton* resetButton =
+      ui->buttonBox->addButton(QDialogButtonBox::StandardButton::Reset);
+   QPushButton* exportButton = ui->buttonBox->addButton(
+      tr("Export..."), QDialogButtonBox::ButtonRole::ActionRole);
+
+   connect(resetButton,
+           &QAbstractButton::clicked,
+           this,
+           [this]()
+           {
+              scwx::util::MetricsRegistry::Instance().Reset();
+              p->Update();
+           });
+   connect(exportButton,
+           &QAbstractButton::clicked,
+           this,
+           [this]() { p->SelectExportFile(); });
+
+   // Metrics are updated periodically while the dialog is visible
+   p->updateTimer_ = new QTimer(this);
+   p->updateTimer_->setInterval(kUpdateInterval_);
+   connect(p->updateTimer_,
+           &QTimer::timeout,
+           this,
+           [this]()
+           {
+              if (isVisible())
+              {
+                 p->Update();
+              }
+              else
+              {
+                 p->updateTimer_->stop();
+              }
+           });
+}
+
+MetricsDialog::~MetricsDialog()
+{
+   delete ui;
+}
+
+void MetricsDialog::showEvent(QShowEvent* event)
+{
+   QDialog::showEvent(event);
+
+   p->Update();
+   p->updateTimer_->start();
+}
+
+void MetricsDialog::Impl::Update()
+{
+   auto& registry = scwx::util::MetricsRegistry::Instance();
+
+   for (auto& histogram : registry.GetHistogramSnapshots())
+   {
+      auto& item = histogramItems_[histogram.name_];
+      if (item == nullptr)
+      {
+         item = new QTreeWidgetItem(timersItem_);
+         item->setText(static_cast<int>(Column::Name),
+                       QString::fromStdString(histogram.name_));
+      }
+
+      auto setDuration = [&](Column column, std::chrono::nanoseconds duration)
+      {
+         item->setText(static_cast<int>(column),
+                       QString::number(Milliseconds(duration), 'f', 3));
+      };
+
+      item->setText(static_cast<int>(Column::Count),
+                    QString::number(histogram.count_));
+      setDuration(Column::Mean, histogram.mean_);
+      setDuration(Column::P50, histogram.p50_);
+      setDuration(Column::P90, histogram.p90_);
+      setDuration(Column::P99, histogram.p99_);
+      setDuration(Column::Max, histogram.max_);
+   }
+
+   for (auto& counter : registry.GetCounterSnapshots())
+   {
+      auto& item = counterItems_[counter.name_];
+      if (item == nullptr)
+      {
+         item = new QTreeWidgetItem(countersItem_);
+         item->setText(static_cast<int>(Column::Name),
+                       QString::fromStdString(counter.name_));
+      }
+
+      item->setText(static_cast<int>(Column::Count),
+                    QString::number(counter.value_));
+   }
+}
+
+void MetricsDialog::Impl::SelectExportFile()
+{
+   static const std::string jsonFilter = "JSON Files (*.json)";
+
+   QFileDialog* dialog = new QFileDialog(self_);
+
+   dialog->setAcceptMode(QFileDialog::AcceptMode::AcceptSave);
+   dialog->setFileMode(QFileDialog::AnyFile);
+   dialog->setDefaultSuffix("json");
+   dialog->setNameFilter(QObject::tr(jsonFilter.c_str()));
+   dialog->setAttribute(Qt::WA_DeleteOnClose);
+
+   QObject::connect(dialog,
+                    &QFileDialog::fileSelected,
+                    self_,
+                    [this](const QString& file)
+                    {
+                       logger_->debug("Selected: {}", file.toStdString());
+                       ExportJson(file.toStdString());
+                    });
+
+   dialog->open();
+}
+
+void MetricsDialog::Impl::ExportJson(const std::string& path)
+{
+   auto& registry = scwx::util::MetricsRegistry::Instance();
+
+   boost::json::object counters {};
+   for (auto& counter : registry.GetCounterSnapshots())
+   {
+      counters[counter.name_] = counter.value_;
+   }
+
+   boost::json::object histograms {};
+   for (auto& histogram : registry.GetHistogramSnapshots())
+   {
+      histograms[histogram.name_] = {
+         {"count", histogram.count_},
+         {"total_ms", Milliseconds(histogram.total_)},
+         {"min_ms", Milliseconds(histogram.min_)},
+         {"mean_ms", Milliseconds(histogram.mean_)},
+         {"p50_ms", Milliseconds(histogram.p50_)},
+         {"p90_ms", Milliseconds(histogram.p90_)},
+         {"p99_ms", Milliseconds(histogram.p99_)},
+         {"max_ms", Milliseconds(histogram.max_)}};
+   }
+
+   const boost::json::value json {{"counters", std::move(counters)},
+                                  {"histograms", std::move(histograms)}};
+
+   logger_->info("Exporting metrics to: {}", path);
+   util::json::WriteJsonFile(path, json);
+}
+
+double MetricsDialog::Impl::Milliseconds(std::chrono::nanoseconds duration)
+{
+   return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QDialog>
+
+namespace Ui
+{
+class MetricsDialog;
+}
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+class MetricsDialog : public QDialog
+{
+   Q_OBJECT
+
+private:
+   Q_DISABLE_COPY(MetricsDialog)
+
+public:
+   explicit MetricsDialog(QWidget* parent = nullptr);
+   ~MetricsDialog();
+
+protected:
+   void showEvent(QShowEvent* event) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+   Ui::MetricsDialog*    ui;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -139,6 +139,7 @@ public:
           &showMapCenter_,
           &showMapLogo_,
           &showSmoothedRangeFolding_,
+          &exactSweepCoordinates_,
           &updateNotificationsEnabled_,
           &cursorIconAlwaysOn_,
           &debugEnabled_,
@@ -150,6 +151,7 @@ public:
           &alertAudioRadius_,
           &alertAudioCounty_,
           &alertAudioWFO_,
+          &alertAudioAreaEntry_,
           &hoverTextWrap_,
           &tooltipMethod_,
           &placefileTextDropShadowEnabled_,
@@ -256,6 +258,7 @@ public:
    settings::SettingsInterface<bool>         showMapCenter_ {};
    settings::SettingsInterface<bool>         showMapLogo_ {};
    settings::SettingsInterface<bool>         showSmoothedRangeFolding_ {};
+   settings::SettingsInterface<bool>         exactSweepCoordinates_ {};
    settings::SettingsInterface<bool>         updateNotificationsEnabled_ {};
    settings::SettingsInterface<bool>         cursorIconAlwaysOn_ {};
    settings::SettingsInterface<bool>         debugEnabled_ {};
@@ -271,6 +274,7 @@ public:
    settings::SettingsInterface<double>      alertAudioRadius_ {};
    settings::SettingsInterface<std::string> alertAudioCounty_ {};
    settings::SettingsInterface<std::string> alertAudioWFO_ {};
+   settings::SettingsInterface<bool>        alertAudioAreaEntry_ {};
 
    std::unordered_map<awips::Phenomenon, settings::SettingsInterface<bool>>
       alertAudioEnabled_ {};
@@ -791,6 +795,11 @@ void SettingsDialogImpl::SetupGeneralTab()
    showSmoothedRangeFolding_.SetEditWidget(
       self_->ui->showSmoothedRangeFoldingCheckBox);
 
+   exactSweepCoordinates_.SetSettingsVariable(
+      productSettings.exact_sweep_coordinates());
+   exactSweepCoordinates_.SetEditWidget(
+      self_->ui->exactSweepCoordinatesCheckBox);
+
    updateNotificationsEnabled_.SetSettingsVariable(
       generalSettings.update_notifications_enabled());
    updateNotificationsEnabled_.SetEditWidget(
@@ -943,6 +952,8 @@ void SettingsDialogImpl::SetupAudioTab()
          bool countyEntryEnabled =
             locationMethod == types::LocationMethod::County;
          bool wfoEntryEnabled = locationMethod == types::LocationMethod::WFO;
+         bool areaEntryEnabled =
+            locationMethod == types::LocationMethod::Track;
 
          self_->ui->alertAudioLatitudeSpinBox->setEnabled(
             coordinateEntryEnabled);
@@ -971,6 +982,9 @@ void SettingsDialogImpl::SetupAudioTab()
          self_->ui->alertAudioWFOLineEdit->setEnabled(wfoEntryEnabled);
          self_->ui->alertAudioWFOSelectButton->setEnabled(wfoEntryEnabled);
          self_->ui->resetAlertAudioWFOButton->setEnabled(wfoEntryEnabled);
+
+         self_->ui->alertAudioAreaEntryCheckBox->setEnabled(
+            areaEntryEnabled);
       });
 
    settings::AudioSettings& audioSettings = settings::AudioSettings::Instance();
@@ -1096,6 +1110,11 @@ void SettingsDialogImpl::SetupAudioTab()
    alertAudioRadiusUpdateUnits(
       settings::UnitSettings::Instance().distance_units().GetValue());
 
+   alertAudioAreaEntry_.SetSettingsVariable(
+      audioSettings.alert_on_area_entry());
+   alertAudioAreaEntry_.SetEditWidget(
+      self_->ui->alertAudioAreaEntryCheckBox);
+
    auto& alertAudioPhenomena = types::GetAlertAudioPhenomena();
    auto  alertAudioLayout =
       static_cast<QGridLayout*>(self_->ui->alertAudioGroupBox->layout());
@@ -0,0 +1,162 @@
+#include <scwx/qt/util/area_index.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> RTreePoint;
+typedef bg::model::box<RTreePoint>                     RTreeBox;
+typedef std::pair<RTreeBox, std::size_t>               RTreeValue;
+
+static constexpr std::size_t kMaxNodeElements_ = 16u;
+
+class AreaIndex::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static std::vector<RTreeBox>
+   ToRTreeBoxes(const PreparedArea::BoundingBox& box);
+
+   std::vector<std::shared_ptr<const PreparedArea>> areas_ {};
+   bgi::rtree<RTreeValue, bgi::rstar<kMaxNodeElements_>> rtree_ {};
+};
+
+AreaIndex::AreaIndex() : p(std::make_unique<Impl>()) {}
+AreaIndex::~AreaIndex() = default;
+
+AreaIndex::AreaIndex(AreaIndex&&) noexcept            = default;
+AreaIndex& AreaIndex::operator=(AreaIndex&&) noexcept = default;
+
+bool AreaIndex::empty() const
+{
+   return p->areas_.empty();
+}
+
+std::size_t AreaIndex::size() const
+{
+   return p->areas_.size();
+}
+
+std::vector<RTreeBox>
+AreaIndex::Impl::ToRTreeBoxes(const PreparedArea::BoundingBox& box)
+{
+   const double minLatitude = box.minLatitude_;
+   const double maxLatitude = box.maxLatitude_;
+   double       minLongitude = box.minLongitude_;
+   double       maxLongitude = box.maxLongitude_;
+
+   if (maxLongitude - minLongitude >= 360.0)
+   {
+      return {{{-180.0, minLatitude}, {180.0, maxLatitude}}};
+   }
+
+   // Normalize the minimum longitude to [-180, 180)
+   while (minLongitude < -180.0)
+   {
+      minLongitude += 360.0;
+      maxLongitude += 360.0;
+   }
+   while (minLongitude >= 180.0)
+   {
+      minLongitude -= 360.0;
+      maxLongitude -= 360.0;
+   }
+
+   // Split a box crossing the antimeridian
+   if (maxLongitude > 180.0)
+   {
+      return {{{minLongitude, minLatitude}, {180.0, maxLatitude}},
+              {{-180.0, minLatitude}, {maxLongitude - 360.0, maxLatitude}}};
+   }
+
+   return {{{minLongitude, minLatitude}, {maxLongitude, maxLatitude}}};
+}
+
+void AreaIndex::Build(
+   const std::vector<std::shared_ptr<const PreparedArea>>& areas)
+{
+   std::vector<RTreeValue> values {};
+   values.reserve(areas.size());
+
+   for (std::size_t i = 0; i < areas.size(); ++i)
+   {
+      if (areas[i] == nullptr || areas[i]->area().empty())
+      {
+         continue;
+      }
+
+      for (auto& box : Impl::ToRTreeBoxes(areas[i]->bounding_box()))
+      {
+         values.emplace_back(box, i);
+      }
+   }
+
+   // Constructing the tree from a range uses the packing algorithm, which is
+   // faster to build and to query than inserting each value
+   p->areas_ = areas;
+   p->rtree_ = decltype(p->rtree_) {values};
+}
+
+void AreaIndex::Clear()
+{
+   p->areas_.clear();
+   p->rtree_.clear();
+}
+
+std::vector<std::size_t>
+AreaIndex::Query(const common::Coordinate&     point,
+                 units::length::meters<double> distance) const
+{
+   std::vector<RTreeValue> values {};
+
+   for (auto& box :
+        Impl::ToRTreeBoxes(PreparedArea::GetBoundingBox(point, distance)))
+   {
+      p->rtree_.query(bgi::intersects(box), std::back_inserter(values));
+   }
+
+   std::vector<std::size_t> candidates {};
+   candidates.reserve(values.size());
+
+   for (auto& value : values)
+   {
+      candidates.push_back(value.second);
+   }
+
+   // An area split across the antimeridian may be found more than once
+   std::sort(candidates.begin(), candidates.end());
+   candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                    candidates.end());
+
+   std::vector<std::size_t> items {};
+   items.reserve(candidates.size());
+
+   for (std::size_t id : candidates)
+   {
+      if (p->areas_[id]->InRangeOfPoint(point, distance))
+      {
+         items.push_back(id);
+      }
+   }
+
+   return items;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <scwx/qt/util/prepared_area.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * The AreaIndex class indexes prepared areas by their latitude/longitude
+ * bounding box, so a location check only tests the areas near the location.
+ * Areas are identified by their position in the list used to build the index.
+ *
+ * Bounding boxes crossing the antimeridian are split, so each area may have
+ * more than one entry in the index.
+ */
+class AreaIndex
+{
+public:
+   explicit AreaIndex();
+   ~AreaIndex();
+
+   AreaIndex(const AreaIndex&)            = delete;
+   AreaIndex& operator=(const AreaIndex&) = delete;
+
+   AreaIndex(AreaIndex&&) noexcept;
+   AreaIndex& operator=(AreaIndex&&) noexcept;
+
+   bool        empty() const;
+   std::size_t size() const;
+
+   /**
+    * Replaces the contents of the index. Each area is identified by its
+    * position in the list.
+    *
+    * @param [in] areas Areas to index
+    */
+   void Build(const std::vector<std::shared_ptr<const PreparedArea>>& areas);
+
+   /**
+    * Removes all areas from the index.
+    */
+   void Clear();
+
+   /**
+    * Finds the areas within a distance of a point. Candidates are found using
+    * the index, and then checked using PreparedArea::InRangeOfPoint.
+    *
+    * @param [in] point Query point
+    * @param [in] distance Maximum distance from the point
+    *
+    * @return Areas in range of the point, in ascending order
+    */
+   std::vector<std::size_t>
+   Query(const common::Coordinate&     point,
+         units::length::meters<double> distance) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,142 @@
+#include <scwx/qt/util/azimuth_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Lookup table resolution. This is smaller than the narrowest radial, so at
+// most one radial starts within each cell.
+static constexpr double      kResolution_ = 0.1;
+static constexpr std::size_t kTableSize_  = 3600u;
+
+static constexpr std::int16_t kNoRadial_ = -1;
+
+class AzimuthIndex::Impl
+{
+public:
+   struct Interval
+   {
+      float         startAngle_;
+      float         endAngle_;
+      std::uint16_t radial_;
+   };
+
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static float NormalizeAngle(float angle);
+
+   bool Contains(const Interval& interval, double azimuth) const;
+
+   std::vector<Interval> intervals_ {};
+
+   // Index of the last interval starting at or before the start of each cell
+   std::vector<std::int16_t> table_ {};
+};
+
+AzimuthIndex::AzimuthIndex() : p(std::make_unique<Impl>()) {}
+AzimuthIndex::~AzimuthIndex() = default;
+
+AzimuthIndex::AzimuthIndex(AzimuthIndex&&) noexcept            = default;
+AzimuthIndex& AzimuthIndex::operator=(AzimuthIndex&&) noexcept = default;
+
+float AzimuthIndex::Impl::NormalizeAngle(float angle)
+{
+   angle = std::fmod(angle, 360.0f);
+   if (angle < 0.0f)
+   {
+      angle += 360.0f;
+   }
+   return angle;
+}
+
+bool AzimuthIndex::Impl::Contains(const Interval& interval,
+                                  double          azimuth) const
+{
+   if (interval.startAngle_ < interval.endAngle_)
+   {
+      return interval.startAngle_ <= azimuth && azimuth < interval.endAngle_;
+   }
+
+   // If the bin crosses 0/360 degrees, special handling is needed
+   return interval.startAngle_ <= azimuth || azimuth < interval.endAngle_;
+}
+
+void AzimuthIndex::Add(std::uint16_t radial, float startAngle, float endAngle)
+{
+   p->intervals_.push_back({Impl::NormalizeAngle(startAngle),
+                            Impl::NormalizeAngle(endAngle),
+                            radial});
+}
+
+void AzimuthIndex::Build()
+{
+   std::sort(p->intervals_.begin(),
+             p->intervals_.end(),
+             [](const Impl::Interval& a, const Impl::Interval& b)
+             { return a.startAngle_ < b.startAngle_; });
+
+   p->table_.resize(kTableSize_);
+
+   std::int16_t interval = kNoRadial_;
+   for (std::size_t cell = 0; cell < kTableSize_; ++cell)
+   {
+      const double cellStart = static_cast<double>(cell) * kResolution_;
+
+      while (static_cast<std::size_t>(interval + 1) < p->intervals_.size() &&
+             p->intervals_[interval + 1].startAngle_ <= cellStart)
+      {
+         ++interval;
+      }
+
+      p->table_[cell] = interval;
+   }
+}
+
+std::optional<std::uint16_t> AzimuthIndex::Find(double azimuth) const
+{
+   if (p->intervals_.empty() || p->table_.empty() || std::isnan(azimuth))
+   {
+      return std::nullopt;
+   }
+
+   azimuth = std::fmod(azimuth, 360.0);
+   if (azimuth < 0.0)
+   {
+      azimuth += 360.0;
+   }
+
+   const std::size_t cell = std::min(
+      static_cast<std::size_t>(azimuth / kResolution_), kTableSize_ - 1);
+
+   // Advance past any radials starting within the cell, before the azimuth
+   std::int16_t interval = p->table_[cell];
+   while (static_cast<std::size_t>(interval + 1) < p->intervals_.size() &&
+          p->intervals_[interval + 1].startAngle_ <= azimuth)
+   {
+      ++interval;
+   }
+
+   // An azimuth before the first radial belongs to the last radial, which
+   // crosses 0/360 degrees
+   const Impl::Interval& candidate =
+      (interval == kNoRadial_) ? p->intervals_.back() :
+                                 p->intervals_[interval];
+
+   if (p->Contains(candidate, azimuth))
+   {
+      return candidate.radial_;
+   }
+
+   return std::nullopt;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * The AzimuthIndex class maps an azimuth to the radial containing it. Each
+ * radial spans [startAngle, endAngle), and may cross 0/360 degrees. After the
+ * index is built, a lookup costs a table read and at most a few comparisons,
+ * independent of the number of radials.
+ */
+class AzimuthIndex
+{
+public:
+   explicit AzimuthIndex();
+   ~AzimuthIndex();
+
+   AzimuthIndex(const AzimuthIndex&)            = delete;
+   AzimuthIndex& operator=(const AzimuthIndex&) = delete;
+
+   AzimuthIndex(AzimuthIndex&&) noexcept;
+   AzimuthIndex& operator=(AzimuthIndex&&) noexcept;
+
+   /**
+    * Adds a radial to the index. Build() must be called before lookups.
+    *
+    * @param [in] radial Radial number
+    * @param [in] startAngle Start angle of the radial, in degrees
+    * @param [in] endAngle End angle of the radial, in degrees
+    */
+   void Add(std::uint16_t radial, float startAngle, float endAngle);
+
+   /**
+    * Builds the lookup table from the added radials.
+    */
+   void Build();
+
+   /**
+    * Finds the radial containing an azimuth.
+    *
+    * @param [in] azimuth Azimuth, in degrees
+    *
+    * @return Radial number, or std::nullopt if no radial contains the azimuth
+    */
+   std::optional<std::uint16_t> Find(double azimuth) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,612 @@
+#include <scwx/qt/util/coordinate_cache.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/range/irange.hpp>
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <fmt/format.h>
+#include <QFile>
+#include <QStandardPaths>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::coordinate_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t   kMaxMemoryEntries_ = 8u;
+static constexpr std::uintmax_t kMaxDiskBytes_     = 512u * 1024u * 1024u;
+
+// 64-bit FNV-1a parameters
+static constexpr std::uint64_t kFnvOffsetBasis_ = 14695981039346656037u;
+static constexpr std::uint64_t kFnvPrime_       = 1099511628211u;
+
+// Increment when the file layout or coordinate calculation changes
+static constexpr std::uint32_t kFileVersion_ = 4u;
+static constexpr char kFileMagic_[8] {'S', 'C', 'W', 'X', 'C', 'O', 'R', 'D'};
+
+struct FileHeader
+{
+   char          magic_[8];
+   char          radarId_[8];
+   std::uint32_t version_;
+   std::uint16_t numRadials_;
+   std::uint16_t numRangeBins_;
+   std::uint64_t azimuthHash_;
+   float         gateSize_;
+   std::uint16_t smoothingEnabled_;
+   std::uint16_t exactCoordinates_;
+   std::int16_t  elevation_;
+   std::uint16_t reserved_[3];
+};
+
+static_assert(sizeof(FileHeader) == 48u);
+static_assert(sizeof(FileHeader) % alignof(float) == 0u);
+
+class CoordinateCache::Impl
+{
+public:
+   explicit Impl()
+   {
+      InitializeCachePath();
+
+      if (!cachePath_.empty())
+      {
+         boost::asio::post(threadPool_,
+                           [cachePath = cachePath_]()
+                           { PruneFiles(cachePath); });
+      }
+   }
+   ~Impl() { threadPool_.join(); }
+
+   void InitializeCachePath();
+
+   std::shared_ptr<const CoordinateTable>
+        ReadFile(const CoordinateCacheKey& key, const std::string& path);
+   bool WriteFile(const CoordinateCacheKey& key,
+                  const std::string&        path,
+                  std::span<const float>    coordinates);
+   void QueueWrite(const CoordinateCacheKey&                 key,
+                   const std::string&                        name,
+                   std::shared_ptr<const std::vector<float>> coordinates);
+
+   void Insert(const std::string&                     name,
+               std::shared_ptr<const CoordinateTable> table);
+
+   static std::string FileName(const CoordinateCacheKey& key);
+   static void        PruneFiles(const std::string& cachePath);
+
+   boost::asio::thread_pool threadPool_ {1u};
+
+   std::string cachePath_ {};
+
+   std::mutex             cacheMutex_ {};
+   std::list<std::string> lruList_ {};
+   std::unordered_map<std::string,
+                      std::pair<std::shared_ptr<const CoordinateTable>,
+                                std::list<std::string>::iterator>>
+      memoryCache_ {};
+
+   std::mutex              writeMutex_ {};
+   std::condition_variable writeCondition_ {};
+   std::size_t             pendingWrites_ {0u};
+};
+
+std::uint64_t CoordinateCacheKey::HashAzimuths(std::span<const float> azimuths)
+{
+   std::uint64_t hash = kFnvOffsetBasis_;
+
+   for (float azimuth : azimuths)
+   {
+      // Each NaN hashes the same, regardless of its payload
+      if (std::isnan(azimuth))
+      {
+         azimuth = std::numeric_limits<float>::quiet_NaN();
+      }
+
+      const auto bits = std::bit_cast<std::uint32_t>(azimuth);
+      for (int shift = 0; shift < 32; shift += 8)
+      {
+         hash ^= (bits >> shift) & 0xffu;
+         hash *= kFnvPrime_;
+      }
+   }
+
+   return hash;
+}
+
+CoordinateTable::CoordinateTable(std::shared_ptr<const void> storage,
+                                 std::span<const float>      data,
+                                 std::uint16_t               numRadials,
+                                 std::uint16_t               numRangeBins) :
+    storage_ {std::move(storage)},
+    data_ {data},
+    numRadials_ {numRadials},
+    numRangeBins_ {numRangeBins}
+{
+}
+CoordinateTable::~CoordinateTable() = default;
+
+std::uint16_t CoordinateTable::num_radials() const
+{
+   return numRadials_;
+}
+
+std::uint16_t CoordinateTable::num_range_bins() const
+{
+   return numRangeBins_;
+}
+
+std::span<const float> CoordinateTable::data() const
+{
+   return data_;
+}
+
+std::span<const float> CoordinateTable::radial(std::uint16_t radial) const
+{
+   const std::size_t radialSize = static_cast<std::size_t>(numRangeBins_) * 2;
+   return data_.subspan(radial * radialSize, radialSize);
+}
+
+CoordinateCache::CoordinateCache() : p(std::make_unique<Impl>()) {}
+CoordinateCache::~CoordinateCache() = default;
+
+void CoordinateCache::Impl::InitializeCachePath()
+{
+   std::string cachePath {
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+         .toStdString() +
+      "/coordinates"};
+
+   cachePath_ = cachePath + "/";
+
+   if (!std::filesystem::exists(cachePath))
+   {
+      std::error_code error;
+      if (!std::filesystem::create_directories(cachePath, error))
+      {
+         logger_->error(
+            "Unable to create coordinate cache directory: \"{}\" ({})",
+            cachePath,
+            error.message());
+         cachePath_.clear();
+      }
+   }
+}
+
+std::string CoordinateCache::Impl::FileName(const CoordinateCacheKey& key)
+{
+   return fmt::format("{}-{}-{}-{:016x}x{}-{}-{}{}.bin",
+                      key.radarId_,
+                      key.elevation_,
+                      key.numRadials_,
+                      key.azimuthHash_,
+                      key.numRangeBins_,
+                      std::bit_cast<std::uint32_t>(key.gateSize_),
+                      key.smoothingEnabled_ ? 's' : 'n',
+                      key.exactCoordinates_ ? 'e' : 'a');
+}
+
+std::shared_ptr<const CoordinateTable>
+CoordinateCache::Get(const CoordinateCacheKey& key)
+{
+   const std::string name = Impl::FileName(key);
+
+   {
+      std::unique_lock lock {p->cacheMutex_};
+
+      auto it = p->memoryCache_.find(name);
+      if (it != p->memoryCache_.end())
+      {
+         // Move the entry to the front of the LRU list
+         p->lruList_.splice(
+            p->lruList_.begin(), p->lruList_, it->second.second);
+         return it->second.first;
+      }
+   }
+
+   std::string cachePath {};
+   {
+      std::unique_lock lock {p->cacheMutex_};
+      cachePath = p->cachePath_;
+   }
+
+   if (cachePath.empty())
+   {
+      return nullptr;
+   }
+
+   const std::string path  = cachePath + name;
+   auto              table = p->ReadFile(key, path);
+   if (table != nullptr)
+   {
+      // The modification time of a file is its last use, for pruning
+      std::error_code error;
+      std::filesystem::last_write_time(
+         path, std::filesystem::file_time_type::clock::now(), error);
+
+      p->Insert(name, table);
+   }
+
+   return table;
+}
+
+std::shared_ptr<const CoordinateTable>
+CoordinateCache::Store(const CoordinateCacheKey& key,
+                       std::vector<float>&&      coordinates)
+{
+   const std::string name = Impl::FileName(key);
+   const std::size_t expectedSize =
+      static_cast<std::size_t>(key.numRadials_) * key.numRangeBins_ * 2;
+
+   if (coordinates.size() != expectedSize)
+   {
+      logger_->error("Invalid coordinate table size: {} (expected {})",
+                     coordinates.size(),
+                     expectedSize);
+      return nullptr;
+   }
+
+   auto storage =
+      std::make_shared<const std::vector<float>>(std::move(coordinates));
+   auto table =
+      std::make_shared<const CoordinateTable>(storage,
+                                              std::span<const float> {*storage},
+                                              key.numRadials_,
+                                              key.numRangeBins_);
+
+   p->Insert(name, table);
+
+   // The file is written in the background, and is memory-mapped the next
+   // time the table is read from disk
+   p->QueueWrite(key, name, storage);
+
+   return table;
+}
+
+std::shared_ptr<const CoordinateTable>
+CoordinateCache::GetOrCalculate(const CoordinateCacheKey& key,
+                                const common::Coordinate& center,
+                                std::span<const float>    azimuths,
+                                double                    firstRange)
+{
+   auto table = Get(key);
+   if (table != nullptr)
+   {
+      logger_->debug("Coordinates loaded from cache");
+      return table;
+   }
+
+   const std::size_t radialSize =
+      static_cast<std::size_t>(key.numRangeBins_) * 2;
+   const std::uint32_t numRadials = static_cast<std::uint32_t>(
+      std::min<std::size_t>(key.numRadials_, azimuths.size()));
+
+   std::vector<float> coordinates(key.numRadials_ * radialSize);
+
+   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
+
+   std::for_each(
+      std::execution::par_unseq,
+      radials.begin(),
+      radials.end(),
+      [&](std::uint32_t radial)
+      {
+         if (std::isnan(azimuths[radial]))
+         {
+            return;
+         }
+
+         GeographicLib::GetRadialCoordinates(
+            center,
+            units::degrees<double> {azimuths[radial]},
+            units::meters<double> {firstRange},
+            units::meters<double> {key.gateSize_},
+            std::span<float> {coordinates}.subspan(radial * radialSize,
+                                                   radialSize),
+            key.exactCoordinates_);
+      });
+
+   return Store(key, std::move(coordinates));
+}
+
+void CoordinateCache::Clear()
+{
+   std::unique_lock lock {p->cacheMutex_};
+   p->memoryCache_.clear();
+   p->lruList_.clear();
+}
+
+void CoordinateCache::SetCachePath(const std::string& path)
+{
+   Flush();
+
+   std::string cachePath {};
+
+   if (!path.empty())
+   {
+      std::error_code error;
+      std::filesystem::create_directories(path, error);
+      if (error)
+      {
+         logger_->error(
+            "Unable to create coordinate cache directory: \"{}\" ({})",
+            path,
+            error.message());
+      }
+      else
+      {
+         cachePath = path + "/";
+      }
+   }
+
+   std::unique_lock lock {p->cacheMutex_};
+   p->cachePath_ = cachePath;
+}
+
+void CoordinateCache::Flush()
+{
+   std::unique_lock lock {p->writeMutex_};
+   p->writeCondition_.wait(lock, [this]() { return p->pendingWrites_ == 0u; });
+}
+
+void CoordinateCache::Impl::QueueWrite(
+   const CoordinateCacheKey&                 key,
+   const std::string&                        name,
+   std::shared_ptr<const std::vector<float>> coordinates)
+{
+   std::string cachePath {};
+   {
+      std::unique_lock lock {cacheMutex_};
+      cachePath = cachePath_;
+   }
+
+   if (cachePath.empty())
+   {
+      return;
+   }
+
+   {
+      std::unique_lock lock {writeMutex_};
+      ++pendingWrites_;
+   }
+
+   boost::asio::post(threadPool_,
+                     [=, this]()
+                     {
+                        if (WriteFile(key, cachePath + name, *coordinates))
+                        {
+                           PruneFiles(cachePath);
+                        }
+
+                        std::unique_lock lock {writeMutex_};
+                        --pendingWrites_;
+                        writeCondition_.notify_all();
+                     });
+}
+
+void CoordinateCache::Impl::PruneFiles(const std::string& cachePath)
+{
+   typedef std::tuple<std::filesystem::file_time_type,
+                      std::uintmax_t,
+                      std::filesystem::path>
+      FileInfo;
+
+   std::vector<FileInfo> files {};
+   std::uintmax_t        totalBytes = 0u;
+   std::error_code       error;
+
+   for (auto& entry : std::filesystem::directory_iterator(cachePath, error))
+   {
+      std::error_code entryError;
+      if (!entry.is_regular_file(entryError))
+      {
+         continue;
+      }
+
+      const std::uintmax_t size = entry.file_size(entryError);
+      const auto           time = entry.last_write_time(entryError);
+      if (!entryError)
+      {
+         files.emplace_back(time, size, entry.path());
+         totalBytes += size;
+      }
+   }
+
+   if (totalBytes <= kMaxDiskBytes_)
+   {
+      return;
+   }
+
+   // Delete the least recently used files until the cache is within its limit
+   std::sort(files.begin(), files.end());
+
+   for (auto& [time, size, path] : files)
+   {
+      if (totalBytes <= kMaxDiskBytes_)
+      {
+         break;
+      }
+
+      if (std::filesystem::remove(path, error))
+      {
+         logger_->trace("Removed coordinate cache file: {}", path.string());
+         totalBytes -= size;
+      }
+   }
+}
+
+void CoordinateCache::Impl::Insert(const std::string&                     name,
+                                   std::shared_ptr<const CoordinateTable> table)
+{
+   std::unique_lock lock {cacheMutex_};
+
+   auto it = memoryCache_.find(name);
+   if (it != memoryCache_.end())
+   {
+      lruList_.splice(lruList_.begin(), lruList_, it->second.second);
+      it->second.first = std::move(table);
+      return;
+   }
+
+   lruList_.push_front(name);
+   memoryCache_.emplace(name, std::make_pair(table, lruList_.begin()));
+
+   while (lruList_.size() > kMaxMemoryEntries_)
+   {
+      memoryCache_.erase(lruList_.back());
+      lruList_.pop_back();
+   }
+}
+
+std::shared_ptr<const CoordinateTable>
+CoordinateCache::Impl::ReadFile(const CoordinateCacheKey& key,
+                                const std::string&        path)
+{
+   if (!std::filesystem::exists(path))
+   {
+      return nullptr;
+   }
+
+   auto file = std::make_shared<QFile>(QString::fromStdString(path));
+   if (!file->open(QIODevice::OpenModeFlag::ReadOnly))
+   {
+      logger_->warn("Could not open coordinate cache file: {}", path);
+      return nullptr;
+   }
+
+   const std::size_t valueCount =
+      static_cast<std::size_t>(key.numRadials_) * key.numRangeBins_ * 2;
+   const std::size_t fileSize =
+      sizeof(FileHeader) + valueCount * sizeof(float);
+
+   if (static_cast<std::size_t>(file->size()) != fileSize)
+   {
+      logger_->warn("Invalid coordinate cache file size: {}", path);
+      return nullptr;
+   }
+
+   uchar* data = file->map(0, static_cast<qint64>(fileSize));
+   if (data == nullptr)
+   {
+      logger_->warn("Could not map coordinate cache file: {}", path);
+      return nullptr;
+   }
+
+   FileHeader header {};
+   std::memcpy(&header, data, sizeof(FileHeader));
+
+   if (std::memcmp(header.magic_, kFileMagic_, sizeof(kFileMagic_)) != 0 ||
+       header.version_ != kFileVersion_ ||
+       header.numRadials_ != key.numRadials_ ||
+       header.azimuthHash_ != key.azimuthHash_ ||
+       header.numRangeBins_ != key.numRangeBins_ ||
+       header.gateSize_ != key.gateSize_ ||
+       header.smoothingEnabled_ != key.smoothingEnabled_ ||
+       header.exactCoordinates_ != key.exactCoordinates_ ||
+       header.elevation_ != key.elevation_ ||
+       std::strncmp(header.radarId_,
+                    key.radarId_.c_str(),
+                    sizeof(header.radarId_)) != 0)
+   {
+      logger_->warn("Coordinate cache file header mismatch: {}", path);
+      return nullptr;
+   }
+
+   // The mapping is page-aligned, and the header size is a multiple of the
+   // float alignment
+   const float* coordinates =
+      reinterpret_cast<const float*>(data + sizeof(FileHeader));
+
+   return std::make_shared<const CoordinateTable>(
+      file,
+      std::span<const float> {coordinates, valueCount},
+      key.numRadials_,
+      key.numRangeBins_);
+}
+
+bool CoordinateCache::Impl::WriteFile(const CoordinateCacheKey& key,
+                                      const std::string&        path,
+                                      std::span<const float>    coordinates)
+{
+   FileHeader header {};
+   std::memcpy(header.magic_, kFileMagic_, sizeof(kFileMagic_));
+   header.version_          = kFileVersion_;
+   header.numRadials_       = key.numRadials_;
+   header.azimuthHash_      = key.azimuthHash_;
+   header.numRangeBins_     = key.numRangeBins_;
+   header.gateSize_         = key.gateSize_;
+   header.smoothingEnabled_ = key.smoothingEnabled_;
+   header.exactCoordinates_ = key.exactCoordinates_;
+   header.elevation_        = key.elevation_;
+   std::strncpy(header.radarId_, key.radarId_.c_str(), sizeof(header.radarId_));
+
+   // Write to a uniquely named temporary file first, so a partial file is
+   // never read back, and concurrent writes of the same table do not collide
+   const std::string tempPath =
+      fmt::format("{}.{}.tmp",
+                  path,
+                  boost::uuids::to_string(boost::uuids::random_generator()()));
+
+   {
+      std::ofstream os {tempPath, std::ios_base::out | std::ios_base::binary};
+      os.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+      os.write(reinterpret_cast<const char*>(coordinates.data()),
+               static_cast<std::streamsize>(coordinates.size_bytes()));
+
+      if (!os.good())
+      {
+         logger_->warn("Could not write coordinate cache file: {}", tempPath);
+         os.close();
+
+         std::error_code error;
+         std::filesystem::remove(tempPath, error);
+         return false;
+      }
+   }
+
+   std::error_code error;
+   std::filesystem::rename(tempPath, path, error);
+   if (error)
+   {
+      logger_->warn("Could not rename coordinate cache file: {} ({})",
+                    path,
+                    error.message());
+      std::filesystem::remove(tempPath, error);
+      return false;
+   }
+
+   return true;
+}
+
+CoordinateCache& CoordinateCache::Instance()
+{
+   static CoordinateCache instance_ {};
+   return instance_;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+struct CoordinateCacheKey
+{
+   std::string   radarId_ {};
+   std::int16_t  elevation_ {}; // Elevation angle, in 0.1 degrees
+   std::uint16_t numRadials_ {};
+   std::uint64_t azimuthHash_ {}; // See HashAzimuths
+   std::uint16_t numRangeBins_ {};
+   float         gateSize_ {};
+   bool          smoothingEnabled_ {};
+   bool          exactCoordinates_ {};
+
+   /**
+    * Hashes the azimuth angle of each radial. Azimuths are hashed exactly, so
+    * a cached table has the coordinates of the same azimuths, rather than
+    * azimuths within a tolerance.
+    *
+    * @param [in] azimuths Azimuth angle of each radial, in degrees. Missing
+    * radials are represented by NaN.
+    *
+    * @return Azimuth hash, which is the same on every platform
+    */
+   static std::uint64_t HashAzimuths(std::span<const float> azimuths);
+
+   bool operator==(const CoordinateCacheKey&) const = default;
+};
+
+/**
+ * A table of geographic coordinates for a polar sweep. Coordinates are stored
+ * as latitude/longitude pairs, radial-major, with numRangeBins_ gates per
+ * radial. The storage is either heap-allocated or memory-mapped from disk.
+ */
+class CoordinateTable
+{
+public:
+   explicit CoordinateTable(std::shared_ptr<const void> storage,
+                            std::span<const float>      data,
+                            std::uint16_t               numRadials,
+                            std::uint16_t               numRangeBins);
+   ~CoordinateTable();
+
+   CoordinateTable(const CoordinateTable&)            = delete;
+   CoordinateTable& operator=(const CoordinateTable&) = delete;
+
+   CoordinateTable(CoordinateTable&&) noexcept            = delete;
+   CoordinateTable& operator=(CoordinateTable&&) noexcept = delete;
+
+   std::uint16_t          num_radials() const;
+   std::uint16_t          num_range_bins() const;
+   std::span<const float> data() const;
+   std::span<const float> radial(std::uint16_t radial) const;
+
+private:
+   std::shared_ptr<const void> storage_;
+   std::span<const float>      data_;
+   std::uint16_t               numRadials_;
+   std::uint16_t               numRangeBins_;
+};
+
+/**
+ * The CoordinateCache stores polar to geographic coordinate tables, keyed by
+ * radar site, elevation, gate layout and the azimuth of each radial. Tables
+ * are kept in memory, and written to the user cache directory in a flat
+ * format which is memory-mapped when read back, so repeated sweeps and
+ * application restarts do not need to repeat the geodesic calculations. Files
+ * are written in the background, and the least recently used files are
+ * deleted when the disk cache exceeds its size limit.
+ */
+class CoordinateCache
+{
+public:
+   explicit CoordinateCache();
+   ~CoordinateCache();
+
+   CoordinateCache(const CoordinateCache&)            = delete;
+   CoordinateCache& operator=(const CoordinateCache&) = delete;
+
+   CoordinateCache(CoordinateCache&&) noexcept            = delete;
+   CoordinateCache& operator=(CoordinateCache&&) noexcept = delete;
+
+   /**
+    * Gets a coordinate table from the memory or disk cache.
+    *
+    * @param [in] key Coordinate table key
+    *
+    * @return Coordinate table, or nullptr if not cached
+    */
+   std::shared_ptr<const CoordinateTable> Get(const CoordinateCacheKey& key);
+
+   /**
+    * Stores a coordinate table in the memory and disk cache.
+    *
+    * @param [in] key Coordinate table key
+    * @param [in] coordinates numRadials_ * numRangeBins_ latitude/longitude
+    * pairs
+    *
+    * @return Stored coordinate table
+    */
+   std::shared_ptr<const CoordinateTable>
+   Store(const CoordinateCacheKey& key, std::vector<float>&& coordinates);
+
+   /**
+    * Gets a coordinate table from the memory or disk cache, or calculates the
+    * coordinates of each radial and stores the table. Coordinates of missing
+    * radials are left zero.
+    *
+    * @param [in] key Coordinate table key, with an azimuth hash of the
+    * azimuths
+    * @param [in] center Radar site coordinate
+    * @param [in] azimuths Azimuth angle of each radial, in degrees
+    * @param [in] firstRange Distance from the radar site to the first gate, in
+    * meters
+    *
+    * @return Coordinate table
+    */
+   std::shared_ptr<const CoordinateTable>
+   GetOrCalculate(const CoordinateCacheKey& key,
+                  const common::Coordinate& center,
+                  std::span<const float>    azimuths,
+                  double                    firstRange);
+
+   /**
+    * Removes all coordinate tables from the memory cache. Files in the disk
+    * cache are not removed.
+    */
+   void Clear();
+
+   /**
+    * Sets the disk cache directory. Pending writes are completed first.
+    *
+    * @param [in] path Disk cache directory, or an empty string to disable the
+    * disk cache
+    */
+   void SetCachePath(const std::string& path);
+
+   /**
+    * Waits for pending disk cache writes to complete.
+    */
+   void Flush();
+
+   static CoordinateCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,202 @@
+#include <scwx/qt/util/distance_batch.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/enum.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// WGS84 mean radius, in meters
+static constexpr double kMeanRadius_ = 6371008.8;
+
+static const std::unordered_map<DistanceAccuracy, std::string>
+   distanceAccuracyName_ {{DistanceAccuracy::Spherical, "Spherical"},
+                          {DistanceAccuracy::Geodesic, "Geodesic"},
+                          {DistanceAccuracy::Unknown, "?"}};
+
+struct UnitVector
+{
+   double x_;
+   double y_;
+   double z_;
+};
+
+static UnitVector GetUnitVector(const common::Coordinate& coordinate);
+static double     GetSphericalDistance(double squaredChord);
+
+class DistanceBatch::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::vector<double> latitudes_ {};
+   std::vector<double> longitudes_ {};
+
+   // Position of each coordinate on the unit sphere
+   std::vector<double> x_ {};
+   std::vector<double> y_ {};
+   std::vector<double> z_ {};
+};
+
+SCWX_GET_ENUM(DistanceAccuracy, GetDistanceAccuracy, distanceAccuracyName_)
+
+const std::string& GetDistanceAccuracyName(DistanceAccuracy accuracy)
+{
+   return distanceAccuracyName_.at(accuracy);
+}
+
+DistanceBatch::DistanceBatch() : p(std::make_unique<Impl>()) {}
+DistanceBatch::~DistanceBatch() = default;
+
+DistanceBatch::DistanceBatch(DistanceBatch&&) noexcept            = default;
+DistanceBatch& DistanceBatch::operator=(DistanceBatch&&) noexcept = default;
+
+bool DistanceBatch::empty() const
+{
+   return p->latitudes_.empty();
+}
+
+std::size_t DistanceBatch::size() const
+{
+   return p->latitudes_.size();
+}
+
+common::Coordinate DistanceBatch::coordinate(std::size_t i) const
+{
+   return {p->latitudes_.at(i), p->longitudes_.at(i)};
+}
+
+static UnitVector GetUnitVector(const common::Coordinate& coordinate)
+{
+   const double latitude  = coordinate.latitude_ * common::kDegreesToRadians;
+   const double longitude = coordinate.longitude_ * common::kDegreesToRadians;
+
+   return {std::cos(latitude) * std::cos(longitude),
+           std::cos(latitude) * std::sin(longitude),
+           std::sin(latitude)};
+}
+
+std::size_t DistanceBatch::Add(const common::Coordinate& coordinate)
+{
+   const UnitVector v = GetUnitVector(coordinate);
+
+   p->latitudes_.push_back(coordinate.latitude_);
+   p->longitudes_.push_back(coordinate.longitude_);
+   p->x_.push_back(v.x_);
+   p->y_.push_back(v.y_);
+   p->z_.push_back(v.z_);
+
+   return p->latitudes_.size() - 1;
+}
+
+void DistanceBatch::Set(std::size_t i, const common::Coordinate& coordinate)
+{
+   const UnitVector v = GetUnitVector(coordinate);
+
+   p->latitudes_.at(i)  = coordinate.latitude_;
+   p->longitudes_.at(i) = coordinate.longitude_;
+   p->x_.at(i)          = v.x_;
+   p->y_.at(i)          = v.y_;
+   p->z_.at(i)          = v.z_;
+}
+
+void DistanceBatch::Clear()
+{
+   p->latitudes_.clear();
+   p->longitudes_.clear();
+   p->x_.clear();
+   p->y_.clear();
+   p->z_.clear();
+}
+
+double DistanceBatch::GetDistance(std::size_t               i,
+                                  const common::Coordinate& point,
+                                  DistanceAccuracy          accuracy) const
+{
+   if (accuracy == DistanceAccuracy::Geodesic)
+   {
+      double distance;
+      GeographicLib::DefaultGeodesic().Inverse(point.latitude_,
+                                               point.longitude_,
+                                               p->latitudes_.at(i),
+                                               p->longitudes_.at(i),
+                                               distance);
+      return distance;
+   }
+
+   const UnitVector v  = GetUnitVector(point);
+   const double     dx = p->x_.at(i) - v.x_;
+   const double     dy = p->y_.at(i) - v.y_;
+   const double     dz = p->z_.at(i) - v.z_;
+
+   return GetSphericalDistance(dx * dx + dy * dy + dz * dz);
+}
+
+void DistanceBatch::GetDistances(const common::Coordinate& point,
+                                 std::span<double>         distances,
+                                 DistanceAccuracy          accuracy) const
+{
+   const std::size_t count = std::min(distances.size(), size());
+
+   if (accuracy == DistanceAccuracy::Geodesic)
+   {
+      const auto& geodesic = GeographicLib::DefaultGeodesic();
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         geodesic.Inverse(point.latitude_,
+                          point.longitude_,
+                          p->latitudes_[i],
+                          p->longitudes_[i],
+                          distances[i]);
+      }
+
+      return;
+   }
+
+   const UnitVector v = GetUnitVector(point);
+
+   const double* x = p->x_.data();
+   const double* y = p->y_.data();
+   const double* z = p->z_.data();
+   double*       d = distances.data();
+
+   // Squared chord length between the unit vectors. The loop has no branches
+   // or function calls, so it can be vectorized by the compiler.
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      const double dx = x[i] - v.x_;
+      const double dy = y[i] - v.y_;
+      const double dz = z[i] - v.z_;
+
+      d[i] = dx * dx + dy * dy + dz * dz;
+   }
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      d[i] = GetSphericalDistance(d[i]);
+   }
+}
+
+static double GetSphericalDistance(double squaredChord)
+{
+   // The central angle subtended by a chord of length c is 2 asin(c / 2),
+   // which is equivalent to the haversine formula
+   return 2.0 * kMeanRadius_ *
+          std::asin(std::min(std::sqrt(squaredChord) * 0.5, 1.0));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
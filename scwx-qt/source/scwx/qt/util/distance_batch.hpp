@@ -0,0 +1,109 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+#include <scwx/util/iterator.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+enum class DistanceAccuracy
+{
+   Spherical, ///< Great circle distance on a sphere, within 0.6%
+   Geodesic,  ///< Geodesic distance on the WGS84 ellipsoid
+   Unknown
+};
+typedef scwx::util::Iterator<DistanceAccuracy,
+                             DistanceAccuracy::Spherical,
+                             DistanceAccuracy::Geodesic>
+   DistanceAccuracyIterator;
+
+DistanceAccuracy   GetDistanceAccuracy(const std::string& name);
+const std::string& GetDistanceAccuracyName(DistanceAccuracy accuracy);
+
+/**
+ * The DistanceBatch class calculates the distance from a point to many
+ * coordinates at once. Coordinates are stored as a structure of arrays,
+ * including their position on the unit sphere, so the spherical distance to
+ * every coordinate is calculated in a single loop without trigonometry.
+ */
+class DistanceBatch
+{
+public:
+   explicit DistanceBatch();
+   ~DistanceBatch();
+
+   DistanceBatch(const DistanceBatch&)            = delete;
+   DistanceBatch& operator=(const DistanceBatch&) = delete;
+
+   DistanceBatch(DistanceBatch&&) noexcept;
+   DistanceBatch& operator=(DistanceBatch&&) noexcept;
+
+   bool        empty() const;
+   std::size_t size() const;
+
+   common::Coordinate coordinate(std::size_t i) const;
+
+   /**
+    * Adds a coordinate to the batch.
+    *
+    * @param [in] coordinate Coordinate to add
+    *
+    * @return Position of the coordinate in the batch
+    */
+   std::size_t Add(const common::Coordinate& coordinate);
+
+   /**
+    * Replaces a coordinate in the batch.
+    *
+    * @param [in] i Position of the coordinate in the batch
+    * @param [in] coordinate New coordinate
+    */
+   void Set(std::size_t i, const common::Coordinate& coordinate);
+
+   /**
+    * Removes all coordinates from the batch.
+    */
+   void Clear();
+
+   /**
+    * Calculates the distance from a point to a single coordinate in the batch.
+    *
+    * @param [in] i Position of the coordinate in the batch
+    * @param [in] point Point to measure from
+    * @param [in] accuracy Distance calculation
+    *
+    * @return Distance in meters
+    */
+   double GetDistance(std::size_t               i,
+                      const common::Coordinate& point,
+                      DistanceAccuracy          accuracy) const;
+
+   /**
+    * Calculates the distance from a point to each coordinate in the batch.
+    *
+    * @param [in] point Point to measure from
+    * @param [out] distances Distance to each coordinate in meters, which must
+    * be the same size as the batch
+    * @param [in] accuracy Distance calculation
+    */
+   void GetDistances(const common::Coordinate& point,
+                     std::span<double>         distances,
+                     DistanceAccuracy          accuracy) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
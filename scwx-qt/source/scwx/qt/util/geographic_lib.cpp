@@ -1,8 +1,12 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <numbers>
 
+#include <GeographicLib/GeodesicLine.hpp>
 #include <GeographicLib/Gnomonic.hpp>
 #include <geos/algorithm/PointLocation.h>
 #include <geos/operation/distance/DistanceOp.h>
@@ -21,6 +25,19 @@ namespace GeographicLib
 static const std::string logPrefix_ = "scwx::qt::util::geographic_lib";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Maximum distance between exact solutions along a radial. Cubic Hermite
+// interpolation of latitude and longitude over this distance is accurate to
+// approximately 1 mm below 75 degrees latitude.
+static constexpr double kRadialNodeSpacing_ = 25000.0;
+
+template<typename T>
+static void GetRadialCoordinatesImpl(const common::Coordinate&     center,
+                                     units::angle::degrees<double> angle,
+                                     units::length::meters<double> firstRange,
+                                     units::length::meters<double> gateSize,
+                                     std::span<T>                  coordinates,
+                                     bool                          exact);
+
 const ::GeographicLib::Geodesic& DefaultGeodesic()
 {
    static const ::GeographicLib::Geodesic geodesic_ {
@@ -170,6 +187,178 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
    return {latitude, longitude};
 }
 
+void GetRadialCoordinates(const common::Coordinate&     center,
+                          units::angle::degrees<double> angle,
+                          units::length::meters<double> firstRange,
+                          units::length::meters<double> gateSize,
+                          std::span<float>              coordinates,
+                          bool                          exact)
+{
+   GetRadialCoordinatesImpl(
+      center, angle, firstRange, gateSize, coordinates, exact);
+}
+
+void GetRadialCoordinates(const common::Coordinate&     center,
+                          units::angle::degrees<double> angle,
+                          units::length::meters<double> firstRange,
+                          units::length::meters<double> gateSize,
+                          std::span<double>             coordinates,
+                          bool                          exact)
+{
+   GetRadialCoordinatesImpl(
+      center, angle, firstRange, gateSize, coordinates, exact);
+}
+
+template<typename T>
+static void GetRadialCoordinatesImpl(const common::Coordinate&     center,
+                                     units::angle::degrees<double> angle,
+                                     units::length::meters<double> firstRange,
+                                     units::length::meters<double> gateSize,
+                                     std::span<T>                  coordinates,
+                                     bool                          exact)
+{
+   using ::GeographicLib::Math;
+
+   const std::size_t gateCount = coordinates.size() / 2;
+   if (gateCount == 0)
+   {
+      return;
+   }
+
+   const ::GeographicLib::Geodesic&    geodesic = DefaultGeodesic();
+   const ::GeographicLib::GeodesicLine line     = geodesic.Line(
+      center.latitude_,
+      center.longitude_,
+      angle.value(),
+      ::GeographicLib::Geodesic::LATITUDE |
+         ::GeographicLib::Geodesic::LONGITUDE |
+         ::GeographicLib::Geodesic::AZIMUTH);
+
+   const double s0    = firstRange.value();
+   const double ds    = gateSize.value();
+   const double span  = ds * static_cast<double>(gateCount - 1);
+   const auto   nodes = static_cast<std::size_t>(
+      std::max(1.0, std::ceil(span / kRadialNodeSpacing_)));
+
+   if (exact || gateCount <= nodes + 1)
+   {
+      for (std::size_t gate = 0; gate < gateCount; ++gate)
+      {
+         double latitude;
+         double longitude;
+
+         line.Position(
+            s0 + ds * static_cast<double>(gate), latitude, longitude);
+
+         coordinates[gate * 2]     = static_cast<T>(latitude);
+         coordinates[gate * 2 + 1] = static_cast<T>(longitude);
+      }
+      return;
+   }
+
+   const double a  = geodesic.EquatorialRadius();
+   const double f  = geodesic.Flattening();
+   const double e2 = f * (2.0 - f);
+
+   constexpr double kDegreesPerRadian = 180.0 / std::numbers::pi;
+   constexpr double kRadiansPerDegree = std::numbers::pi / 180.0;
+
+   // Solve the geodesic at each node. Longitude is unrolled relative to the
+   // center, so interpolation is continuous across the antimeridian.
+   const double nodeSpacing = span / static_cast<double>(nodes);
+
+   std::vector<double> nodeLatitude(nodes + 1);
+   std::vector<double> nodeLongitude(nodes + 1);
+   std::vector<double> nodeLatitudeRate(nodes + 1);
+   std::vector<double> nodeLongitudeRate(nodes + 1);
+   bool                unrolled = false;
+
+   for (std::size_t node = 0; node <= nodes; ++node)
+   {
+      double latitude;
+      double longitude;
+      double azimuth;
+
+      line.Position(s0 + nodeSpacing * static_cast<double>(node),
+                    latitude,
+                    longitude,
+                    azimuth);
+
+      longitude =
+         center.longitude_ + Math::AngDiff(center.longitude_, longitude);
+      unrolled |= (longitude < -180.0 || longitude > 180.0);
+
+      // Meridional and prime vertical radii of curvature
+      const double sinLatitude = std::sin(latitude * kRadiansPerDegree);
+      const double w           = 1.0 - e2 * sinLatitude * sinLatitude;
+      const double m           = a * (1.0 - e2) / (w * std::sqrt(w));
+      const double n           = a / std::sqrt(w);
+
+      // Rate of change in degrees per meter along the geodesic
+      nodeLatitude[node]  = latitude;
+      nodeLongitude[node] = longitude;
+      nodeLatitudeRate[node] =
+         std::cos(azimuth * kRadiansPerDegree) / m * kDegreesPerRadian;
+      nodeLongitudeRate[node] =
+         std::sin(azimuth * kRadiansPerDegree) /
+         (n * std::cos(latitude * kRadiansPerDegree)) * kDegreesPerRadian;
+   }
+
+   // Interpolate gates between each pair of nodes using the cubic Hermite
+   // polynomial, evaluated in Horner form
+   std::size_t gate = 0;
+   for (std::size_t node = 0; node < nodes; ++node)
+   {
+      const double nodeStart = nodeSpacing * static_cast<double>(node);
+      const double nodeEnd   = nodeSpacing * static_cast<double>(node + 1);
+
+      const auto hermite =
+         [nodeSpacing](double p0, double m0, double p1, double m1)
+      {
+         const double d0 = m0 * nodeSpacing;
+         const double d1 = m1 * nodeSpacing;
+         return std::array<double, 4> {p0,
+                                       d0,
+                                       3.0 * (p1 - p0) - 2.0 * d0 - d1,
+                                       2.0 * (p0 - p1) + d0 + d1};
+      };
+
+      const auto lat = hermite(nodeLatitude[node],
+                               nodeLatitudeRate[node],
+                               nodeLatitude[node + 1],
+                               nodeLatitudeRate[node + 1]);
+      const auto lon = hermite(nodeLongitude[node],
+                               nodeLongitudeRate[node],
+                               nodeLongitude[node + 1],
+                               nodeLongitudeRate[node + 1]);
+
+      const std::size_t lastGate =
+         (node + 1 == nodes) ?
+            gateCount :
+            static_cast<std::size_t>(std::ceil(nodeEnd / ds));
+
+      for (; gate < lastGate; ++gate)
+      {
+         const double t =
+            (ds * static_cast<double>(gate) - nodeStart) / nodeSpacing;
+
+         coordinates[gate * 2] = static_cast<T>(
+            lat[0] + t * (lat[1] + t * (lat[2] + t * lat[3])));
+         coordinates[gate * 2 + 1] = static_cast<T>(
+            lon[0] + t * (lon[1] + t * (lon[2] + t * lon[3])));
+      }
+   }
+
+   if (unrolled)
+   {
+      for (std::size_t i = 1; i < coordinates.size(); i += 2)
+      {
+         coordinates[i] = static_cast<T>(
+            Math::AngNormalize(static_cast<double>(coordinates[i])));
+      }
+   }
+}
+
 units::length::meters<double>
 GetDistance(double lat1, double lon1, double lat2, double lon2)
 {
@@ -2,6 +2,7 @@
 
 #include <scwx/common/geographic.hpp>
 
+#include <span>
 #include <vector>
 
 #include <GeographicLib/Geodesic.hpp>
@@ -77,6 +78,40 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
                                  units::meters<double>     i,
                                  units::meters<double>     j);
 
+/**
+ * Maximum position error of GetRadialCoordinates when not in exact mode, for
+ * ranges up to 500 km from centers below 75 degrees latitude.
+ */
+static constexpr units::length::meters<double> kRadialCoordinatesMaxError {
+   0.01};
+
+/**
+ * Get the coordinates of evenly spaced gates along a radial. Unless exact mode
+ * is requested, the geodesic is solved at nodes spaced no more than 25 km
+ * apart, and gates between nodes are interpolated using cubic Hermite splines
+ * of latitude and longitude. The error is bounded by
+ * kRadialCoordinatesMaxError.
+ *
+ * @param [in] center The center coordinate from which the radial originates
+ * @param [in] angle The azimuth of the radial
+ * @param [in] firstRange The distance from the center to the first gate
+ * @param [in] gateSize The distance between gates
+ * @param [out] coordinates Latitude/longitude pairs, two values per gate
+ * @param [in] exact Solve the geodesic at every gate
+ */
+void GetRadialCoordinates(const common::Coordinate&     center,
+                          units::angle::degrees<double> angle,
+                          units::length::meters<double> firstRange,
+                          units::length::meters<double> gateSize,
+                          std::span<float>              coordinates,
+                          bool                          exact = false);
+void GetRadialCoordinates(const common::Coordinate&     center,
+                          units::angle::degrees<double> angle,
+                          units::length::meters<double> firstRange,
+                          units::length::meters<double> gateSize,
+                          std::span<double>             coordinates,
+                          bool                          exact = false);
+
 /**
  * Get the distance between two points.
  *
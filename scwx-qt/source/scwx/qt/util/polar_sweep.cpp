@@ -0,0 +1,208 @@
+#include <scwx/qt/util/polar_sweep.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static_assert(sizeof(PolarSweep::Radial) ==
+                 PolarSweep::kTexelsPerRadial_ * 3u * sizeof(std::int32_t),
+              "Radial table entries must be packed as RGB32I texels");
+
+class PolarSweep::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::uint8_t* NextRow(const Radial& radial);
+
+   std::size_t   componentSize_ {1u};
+   std::uint16_t gateCount_ {0u};
+   bool          hasCfpMoments_ {false};
+
+   std::vector<std::uint8_t> moments_ {};
+   std::vector<std::uint8_t> cfpMoments_ {};
+   std::vector<Radial>       radials_ {};
+   Parameters                parameters_ {};
+
+   std::span<const float> coordinates_ {};
+   std::uint16_t          coordinateRadialCount_ {0u};
+   std::uint16_t          coordinateGateCount_ {0u};
+   std::uint64_t          coordinateVersion_ {0u};
+};
+
+PolarSweep::PolarSweep() : p(std::make_unique<Impl>()) {}
+PolarSweep::~PolarSweep() = default;
+
+PolarSweep::PolarSweep(PolarSweep&&) noexcept            = default;
+PolarSweep& PolarSweep::operator=(PolarSweep&&) noexcept = default;
+
+std::size_t PolarSweep::component_size() const
+{
+   return p->componentSize_;
+}
+
+std::uint16_t PolarSweep::gate_count() const
+{
+   return p->gateCount_;
+}
+
+std::size_t PolarSweep::radial_count() const
+{
+   return p->radials_.size();
+}
+
+bool PolarSweep::has_cfp_moments() const
+{
+   return p->hasCfpMoments_;
+}
+
+std::span<const std::uint8_t> PolarSweep::moments() const
+{
+   return p->moments_;
+}
+
+std::span<const std::uint8_t> PolarSweep::cfp_moments() const
+{
+   return p->cfpMoments_;
+}
+
+std::span<const PolarSweep::Radial> PolarSweep::radials() const
+{
+   return p->radials_;
+}
+
+const PolarSweep::Parameters& PolarSweep::parameters() const
+{
+   return p->parameters_;
+}
+
+std::span<const float> PolarSweep::coordinates() const
+{
+   return p->coordinates_;
+}
+
+std::uint16_t PolarSweep::coordinate_gate_count() const
+{
+   return p->coordinateGateCount_;
+}
+
+std::uint16_t PolarSweep::coordinate_radial_count() const
+{
+   return p->coordinateRadialCount_;
+}
+
+std::uint64_t PolarSweep::coordinate_version() const
+{
+   return p->coordinateVersion_;
+}
+
+std::size_t PolarSweep::vertex_count() const
+{
+   return p->radials_.size() * p->gateCount_ * kVerticesPerGate_;
+}
+
+void PolarSweep::Reset(std::size_t   componentSize,
+                       std::uint16_t gateCount,
+                       bool          hasCfpMoments,
+                       std::size_t   radialCapacity)
+{
+   p->componentSize_ = std::clamp<std::size_t>(componentSize, 1u, 2u);
+   p->gateCount_     = gateCount;
+   p->hasCfpMoments_ = hasCfpMoments;
+
+   p->moments_.clear();
+   p->cfpMoments_.clear();
+   p->radials_.clear();
+
+   p->moments_.reserve(radialCapacity * gateCount * p->componentSize_);
+   if (hasCfpMoments)
+   {
+      p->cfpMoments_.reserve(radialCapacity * gateCount);
+   }
+   p->radials_.reserve(radialCapacity);
+}
+
+std::uint8_t* PolarSweep::Impl::NextRow(const Radial& radial)
+{
+   const std::size_t rowSize = gateCount_ * componentSize_;
+   const std::size_t offset  = moments_.size();
+
+   radials_.push_back(radial);
+   moments_.resize(offset + rowSize, 0u);
+   if (hasCfpMoments_)
+   {
+      cfpMoments_.resize(cfpMoments_.size() + gateCount_, 0u);
+   }
+
+   return moments_.data() + offset;
+}
+
+void PolarSweep::AddRadial(const Radial&                 radial,
+                           std::span<const std::uint8_t> moments,
+                           std::span<const std::uint8_t> cfpMoments)
+{
+   if (p->componentSize_ != sizeof(std::uint8_t))
+   {
+      return;
+   }
+
+   std::uint8_t* row = p->NextRow(radial);
+
+   const std::size_t count =
+      std::min<std::size_t>(moments.size(), p->gateCount_);
+   std::copy_n(moments.begin(), count, row);
+
+   if (p->hasCfpMoments_)
+   {
+      const std::size_t cfpCount =
+         std::min<std::size_t>(cfpMoments.size(), p->gateCount_);
+      std::copy_n(cfpMoments.begin(),
+                  cfpCount,
+                  p->cfpMoments_.end() - p->gateCount_);
+   }
+}
+
+void PolarSweep::AddRadial(const Radial&                  radial,
+                           std::span<const std::uint16_t> moments)
+{
+   if (p->componentSize_ != sizeof(std::uint16_t))
+   {
+      return;
+   }
+
+   std::uint8_t* row = p->NextRow(radial);
+
+   const std::size_t count =
+      std::min<std::size_t>(moments.size(), p->gateCount_);
+   if (count > 0)
+   {
+      std::memcpy(row, moments.data(), count * sizeof(std::uint16_t));
+   }
+}
+
+void PolarSweep::SetCoordinates(std::span<const float> coordinates,
+                                std::uint16_t          radialCount,
+                                std::uint16_t          gateCount)
+{
+   p->coordinates_           = coordinates;
+   p->coordinateRadialCount_ = radialCount;
+   p->coordinateGateCount_   = gateCount;
+   ++p->coordinateVersion_;
+}
+
+void PolarSweep::SetParameters(const Parameters& parameters)
+{
+   p->parameters_ = parameters;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * A PolarSweep stores a radar sweep in the layout used to render it: data
+ * moments are packed radial-major into a texture of radials x gates, with a
+ * radial table describing the gate geometry of each row, and a coordinate
+ * table giving the location of each gate edge. The vertex shader expands each
+ * texel into a gate, so no per-gate vertices are built on the CPU.
+ */
+class PolarSweep
+{
+public:
+   /**
+    * Radial table entry. Each entry is uploaded as two RGB32I texels.
+    */
+   struct Radial
+   {
+      std::int32_t coordinateRow_;     // Coordinate row of the radial
+      std::int32_t nextCoordinateRow_; // Coordinate row of the far edge
+      std::int32_t startGate_;         // First gate, in base gate units
+      std::int32_t gateSize_;          // Base gates per data moment gate
+      std::int32_t endGate_;           // End gate (exclusive), in base gates
+      std::int32_t gateCount_;         // Number of data moment gates
+   };
+
+   struct Parameters
+   {
+      float         latitude_ {};
+      float         longitude_ {};
+      std::uint16_t snrThreshold_ {};
+      std::uint16_t edgeValue_ {};
+      bool          smoothingEnabled_ {};
+      bool          showSmoothedRangeFolding_ {};
+   };
+
+   static constexpr std::size_t kVerticesPerGate_ = 6u;
+   static constexpr std::size_t kTexelsPerRadial_ = 2u;
+
+   explicit PolarSweep();
+   ~PolarSweep();
+
+   PolarSweep(const PolarSweep&)            = delete;
+   PolarSweep& operator=(const PolarSweep&) = delete;
+
+   PolarSweep(PolarSweep&&) noexcept;
+   PolarSweep& operator=(PolarSweep&&) noexcept;
+
+   /**
+    * Size of each data moment, in bytes (1 or 2).
+    */
+   std::size_t component_size() const;
+
+   /**
+    * Number of data moment gates in each row of the moment texture.
+    */
+   std::uint16_t gate_count() const;
+
+   /**
+    * Number of packed radials (rows of the moment texture).
+    */
+   std::size_t radial_count() const;
+
+   bool                          has_cfp_moments() const;
+   std::span<const std::uint8_t> moments() const;
+   std::span<const std::uint8_t> cfp_moments() const;
+   std::span<const Radial>       radials() const;
+   const Parameters&             parameters() const;
+
+   std::span<const float> coordinates() const;
+   std::uint16_t          coordinate_gate_count() const;
+   std::uint16_t          coordinate_radial_count() const;
+
+   /**
+    * Incremented each time the coordinate table changes, so renderers only
+    * upload coordinates when necessary.
+    */
+   std::uint64_t coordinate_version() const;
+
+   /**
+    * Number of vertices drawn for the sweep.
+    */
+   std::size_t vertex_count() const;
+
+   /**
+    * Clears all packed radials, and sets the moment texture layout.
+    *
+    * @param [in] componentSize Size of each data moment, in bytes (1 or 2)
+    * @param [in] gateCount Number of data moment gates in each row
+    * @param [in] hasCfpMoments Whether clutter filter power removed moments
+    * are packed alongside the data moments
+    * @param [in] radialCapacity Expected number of radials
+    */
+   void Reset(std::size_t   componentSize,
+              std::uint16_t gateCount,
+              bool          hasCfpMoments,
+              std::size_t   radialCapacity);
+
+   /**
+    * Packs an 8-bit radial into the next row. Moments beyond the gate count
+    * are discarded, and missing moments are zero filled.
+    *
+    * @param [in] radial Radial table entry
+    * @param [in] moments Data moments
+    * @param [in] cfpMoments Clutter filter power removed moments, if present
+    */
+   void AddRadial(const Radial&                 radial,
+                  std::span<const std::uint8_t> moments,
+                  std::span<const std::uint8_t> cfpMoments = {});
+
+   /**
+    * Packs a 16-bit radial into the next row. Moments beyond the gate count
+    * are discarded, and missing moments are zero filled.
+    *
+    * @param [in] radial Radial table entry
+    * @param [in] moments Data moments
+    */
+   void AddRadial(const Radial& radial, std::span<const std::uint16_t> moments);
+
+   /**
+    * Sets the coordinate table. The coordinates are referenced, not copied,
+    * and must remain valid while the sweep is in use.
+    *
+    * @param [in] coordinates Latitude/longitude pairs, radial-major
+    * @param [in] radialCount Number of radials in the table
+    * @param [in] gateCount Number of gates in each radial of the table
+    */
+   void SetCoordinates(std::span<const float> coordinates,
+                       std::uint16_t          radialCount,
+                       std::uint16_t          gateCount);
+
+   void SetParameters(const Parameters& parameters);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
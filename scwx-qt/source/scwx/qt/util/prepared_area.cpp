@@ -0,0 +1,370 @@
+#include <scwx/qt/util/prepared_area.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include <GeographicLib/Gnomonic.hpp>
+#include <geos/algorithm/PointLocation.h>
+#include <geos/geom/CoordinateSequence.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::prepared_area";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Lower bound of the WGS84 meridional radius of curvature (6335 km at the
+// equator). Dividing a distance by this radius gives an upper bound of the
+// angle subtended by the distance.
+static constexpr double kMinimumRadius_ = 6300000.0;
+
+static constexpr double kRadiansToDegrees_ = 180.0 / std::numbers::pi;
+
+// Geodesic edges are assumed to be short relative to the radius of the Earth
+// when calculating how far they bulge poleward. Latitudes are limited here to
+// keep the estimate finite.
+static constexpr double kMaximumBulgeLatitude_ = 89.0;
+
+class PreparedArea::Impl
+{
+public:
+   explicit Impl(const std::vector<common::Coordinate>& area);
+   ~Impl() = default;
+
+   void CalculateBoundingBox();
+   void Project();
+
+   static void ExpandBoundingBox(BoundingBox& box, double distance);
+
+   std::vector<common::Coordinate> area_;
+   BoundingBox                     boundingBox_ {};
+
+   // An area with two points or less is not an area, and contains no points
+   bool valid_ {false};
+
+   // Set if every coordinate of the area is in the hemisphere centered on the
+   // centroid. Otherwise, the area cannot be projected.
+   bool projected_ {false};
+
+   common::Coordinate             centroid_ {};
+   ::GeographicLib::Gnomonic      gnomonic_;
+   geos::geom::CoordinateSequence sequence_ {};
+   double                         minX_ {};
+   double                         minY_ {};
+   double                         maxX_ {};
+   double                         maxY_ {};
+};
+
+PreparedArea::PreparedArea(const std::vector<common::Coordinate>& area) :
+    p(std::make_unique<Impl>(area))
+{
+}
+PreparedArea::~PreparedArea() = default;
+
+PreparedArea::PreparedArea(PreparedArea&&) noexcept            = default;
+PreparedArea& PreparedArea::operator=(PreparedArea&&) noexcept = default;
+
+PreparedArea::Impl::Impl(const std::vector<common::Coordinate>& area) :
+    area_ {area}, gnomonic_ {GeographicLib::DefaultGeodesic()}
+{
+   valid_ = !(area_.size() <= 2 ||
+              (area_.size() == 3 && area_.front() == area_.back()));
+
+   if (!area_.empty())
+   {
+      CalculateBoundingBox();
+   }
+
+   if (valid_)
+   {
+      Project();
+   }
+}
+
+const std::vector<common::Coordinate>& PreparedArea::area() const
+{
+   return p->area_;
+}
+
+const PreparedArea::BoundingBox& PreparedArea::bounding_box() const
+{
+   return p->boundingBox_;
+}
+
+void PreparedArea::Impl::CalculateBoundingBox()
+{
+   const common::Coordinate& first = area_.front();
+
+   boundingBox_ = {first.latitude_,
+                   first.longitude_,
+                   first.latitude_,
+                   first.longitude_};
+
+   double previousLongitude = first.longitude_;
+   double bulge             = 0.0;
+
+   for (std::size_t i = 0; i < area_.size(); ++i)
+   {
+      const common::Coordinate& coordinate = area_[i];
+      const common::Coordinate& next       = area_[(i + 1) % area_.size()];
+
+      // Unroll the longitude, so an edge crossing the antimeridian does not
+      // span the entire globe
+      double longitude = coordinate.longitude_;
+      while (longitude - previousLongitude > 180.0)
+      {
+         longitude -= 360.0;
+      }
+      while (longitude - previousLongitude < -180.0)
+      {
+         longitude += 360.0;
+      }
+      previousLongitude = longitude;
+
+      boundingBox_.minLatitude_ =
+         std::min(boundingBox_.minLatitude_, coordinate.latitude_);
+      boundingBox_.maxLatitude_ =
+         std::max(boundingBox_.maxLatitude_, coordinate.latitude_);
+      boundingBox_.minLongitude_ =
+         std::min(boundingBox_.minLongitude_, longitude);
+      boundingBox_.maxLongitude_ =
+         std::max(boundingBox_.maxLongitude_, longitude);
+
+      // A geodesic edge of length L bulges poleward of its endpoints by
+      // approximately L^2 tan(latitude) / 8R. The estimate is doubled, and
+      // limited to L / 2, which bounds the distance from any point on the edge
+      // to the nearest endpoint.
+      const double length = GeographicLib::GetDistance(coordinate.latitude_,
+                                                       coordinate.longitude_,
+                                                       next.latitude_,
+                                                       next.longitude_)
+                               .value();
+      const double latitude =
+         std::min(std::max(std::abs(coordinate.latitude_),
+                           std::abs(next.latitude_)),
+                  kMaximumBulgeLatitude_);
+      const double edgeBulge =
+         std::min(length * length *
+                     std::tan(latitude * common::kDegreesToRadians) /
+                     (4.0 * kMinimumRadius_),
+                  length / 2.0);
+
+      bulge = std::max(bulge, edgeBulge);
+   }
+
+   if (boundingBox_.maxLongitude_ - boundingBox_.minLongitude_ >= 360.0)
+   {
+      // The area encircles a pole
+      boundingBox_ = {-90.0, -180.0, 90.0, 180.0};
+   }
+   else
+   {
+      ExpandBoundingBox(boundingBox_, bulge);
+   }
+}
+
+void PreparedArea::Impl::Project()
+{
+   centroid_ = common::GetCentroid(area_);
+
+   double x;
+   double y;
+
+   // Create the area coordinate sequence using a gnomonic projection centered
+   // on the centroid. Geodesics are straight lines in this projection, so the
+   // area is a polygon in projected coordinates.
+   for (auto& areaCoordinate : area_)
+   {
+      gnomonic_.Forward(centroid_.latitude_,
+                        centroid_.longitude_,
+                        areaCoordinate.latitude_,
+                        areaCoordinate.longitude_,
+                        x,
+                        y);
+
+      // The area cannot be projected if it extends beyond the hemisphere
+      // centered on the centroid
+      if (std::isnan(x) || std::isnan(y))
+      {
+         sequence_.clear();
+         return;
+      }
+
+      sequence_.add(x, y);
+   }
+
+   // If the sequence is not a ring, add the first point again for closure
+   if (!sequence_.isRing())
+   {
+      sequence_.add(sequence_.front(), false);
+   }
+
+   // The sequence should be a ring at this point, but make sure
+   if (!sequence_.isRing())
+   {
+      sequence_.clear();
+      return;
+   }
+
+   minX_ = maxX_ = sequence_.getX(0);
+   minY_ = maxY_ = sequence_.getY(0);
+
+   for (std::size_t i = 1; i < sequence_.size(); ++i)
+   {
+      minX_ = std::min(minX_, sequence_.getX(i));
+      maxX_ = std::max(maxX_, sequence_.getX(i));
+      minY_ = std::min(minY_, sequence_.getY(i));
+      maxY_ = std::max(maxY_, sequence_.getY(i));
+   }
+
+   projected_ = true;
+}
+
+void PreparedArea::Impl::ExpandBoundingBox(BoundingBox& box, double distance)
+{
+   const double angle        = std::max(distance, 0.0) / kMinimumRadius_;
+   const double angleDegrees = angle * kRadiansToDegrees_;
+
+   const double latitude =
+      std::max(std::abs(box.minLatitude_), std::abs(box.maxLatitude_));
+
+   box.minLatitude_ -= angleDegrees;
+   box.maxLatitude_ += angleDegrees;
+
+   if (box.minLatitude_ <= -90.0 || box.maxLatitude_ >= 90.0)
+   {
+      // A pole is in range, so every longitude is in range
+      box.minLatitude_  = std::max(box.minLatitude_, -90.0);
+      box.maxLatitude_  = std::min(box.maxLatitude_, 90.0);
+      box.minLongitude_ = -180.0;
+      box.maxLongitude_ = 180.0;
+   }
+   else
+   {
+      // Largest longitude difference of a spherical cap with the angular
+      // radius, centered at the latitude furthest from the equator
+      const double longitudeDegrees =
+         std::asin(std::min(std::sin(angle) /
+                               std::cos(latitude * common::kDegreesToRadians),
+                            1.0)) *
+         kRadiansToDegrees_;
+
+      box.minLongitude_ -= longitudeDegrees;
+      box.maxLongitude_ += longitudeDegrees;
+   }
+}
+
+PreparedArea::BoundingBox
+PreparedArea::GetBoundingBox(const common::Coordinate&     point,
+                             units::length::meters<double> distance)
+{
+   BoundingBox box {
+      point.latitude_, point.longitude_, point.latitude_, point.longitude_};
+
+   Impl::ExpandBoundingBox(box, distance.value());
+
+   return box;
+}
+
+bool PreparedArea::BoundingBox::Intersects(const BoundingBox& o) const
+{
+   if (maxLatitude_ < o.minLatitude_ || o.maxLatitude_ < minLatitude_)
+   {
+      return false;
+   }
+
+   // Either box may be unrolled across the antimeridian
+   for (double offset : {-360.0, 0.0, 360.0})
+   {
+      if (minLongitude_ <= o.maxLongitude_ + offset &&
+          o.minLongitude_ + offset <= maxLongitude_)
+      {
+         return true;
+      }
+   }
+
+   return false;
+}
+
+bool PreparedArea::ContainsPoint(const common::Coordinate& point) const
+{
+   if (!p->valid_)
+   {
+      return false;
+   }
+
+   if (!p->projected_)
+   {
+      return GeographicLib::AreaContainsPoint(p->area_, point);
+   }
+
+   if (!p->boundingBox_.Intersects({point.latitude_,
+                                    point.longitude_,
+                                    point.latitude_,
+                                    point.longitude_}))
+   {
+      return false;
+   }
+
+   double x;
+   double y;
+
+   p->gnomonic_.Forward(p->centroid_.latitude_,
+                        p->centroid_.longitude_,
+                        point.latitude_,
+                        point.longitude_,
+                        x,
+                        y);
+
+   if (std::isnan(x) || std::isnan(y) || x < p->minX_ || x > p->maxX_ ||
+       y < p->minY_ || y > p->maxY_)
+   {
+      return false;
+   }
+
+   bool areaContainsPoint = false;
+
+   try
+   {
+      areaContainsPoint = geos::algorithm::PointLocation::isInRing(
+         geos::geom::CoordinateXY {x, y}, &p->sequence_);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Invalid area sequence. {}", ex.what());
+   }
+
+   return areaContainsPoint;
+}
+
+bool PreparedArea::InRangeOfPoint(const common::Coordinate&     point,
+                                  units::length::meters<double> distance) const
+{
+   if (p->area_.empty())
+   {
+      return GeographicLib::AreaInRangeOfPoint(p->area_, point, distance);
+   }
+
+   if (!p->boundingBox_.Intersects(GetBoundingBox(point, distance)))
+   {
+      return false;
+   }
+
+   if (p->projected_ && ContainsPoint(point))
+   {
+      return true;
+   }
+
+   return GeographicLib::AreaInRangeOfPoint(p->area_, point, distance);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
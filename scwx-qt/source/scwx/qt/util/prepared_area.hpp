@@ -0,0 +1,102 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <units/length.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * The PreparedArea class holds an area prepared for repeated location checks.
+ * On construction, the area is projected once using a gnomonic projection
+ * centered on its centroid, and its bounding box is calculated. Each check
+ * then projects only the test point, instead of the entire area.
+ */
+class PreparedArea
+{
+public:
+   /**
+    * Latitude/longitude bounding box, in degrees. Longitudes are unrolled
+    * relative to the first coordinate of the area, so the box of an area
+    * crossing the antimeridian has a minimum longitude less than -180 or a
+    * maximum longitude greater than 180.
+    */
+   struct BoundingBox
+   {
+      double minLatitude_ {};
+      double minLongitude_ {};
+      double maxLatitude_ {};
+      double maxLongitude_ {};
+
+      bool Intersects(const BoundingBox& o) const;
+   };
+
+   explicit PreparedArea(const std::vector<common::Coordinate>& area);
+   ~PreparedArea();
+
+   PreparedArea(const PreparedArea&)            = delete;
+   PreparedArea& operator=(const PreparedArea&) = delete;
+
+   PreparedArea(PreparedArea&&) noexcept;
+   PreparedArea& operator=(PreparedArea&&) noexcept;
+
+   const std::vector<common::Coordinate>& area() const;
+
+   /**
+    * Bounding box of the area, including the geodesic edges between each
+    * coordinate.
+    */
+   const BoundingBox& bounding_box() const;
+
+   /**
+    * Determine if the area contains a point. Equivalent to
+    * GeographicLib::AreaContainsPoint.
+    *
+    * @param [in] point Point to check
+    *
+    * @return true if point is inside the area
+    */
+   bool ContainsPoint(const common::Coordinate& point) const;
+
+   /**
+    * Determine if the area is within a distance of a point. Equivalent to
+    * GeographicLib::AreaInRangeOfPoint, but the distance is only calculated
+    * for a point near the bounding box of the area.
+    *
+    * @param [in] point Point to check
+    * @param [in] distance Maximum distance from the area
+    *
+    * @return true if the area is within the distance of the point
+    */
+   bool InRangeOfPoint(const common::Coordinate&     point,
+                       units::length::meters<double> distance) const;
+
+   /**
+    * Get a bounding box containing every location within a distance of a
+    * point. The box is conservative, and may be larger than necessary.
+    *
+    * @param [in] point Center point
+    * @param [in] distance Distance from the point
+    *
+    * @return Bounding box of the point
+    */
+   static BoundingBox
+   GetBoundingBox(const common::Coordinate&     point,
+                  units::length::meters<double> distance);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,137 @@
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+typedef bg::model::point<float, 2, bg::cs::cartesian> RTreePoint;
+typedef bg::model::box<RTreePoint>                    RTreeBox;
+typedef std::pair<RTreeBox, std::size_t>              RTreeValue;
+
+static constexpr std::size_t kMaxNodeElements_ = 16u;
+
+class SpatialIndex::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static RTreeBox ToRTreeBox(const Box& box);
+
+   std::vector<std::size_t> Query(const RTreeBox& box) const;
+
+   bgi::rtree<RTreeValue, bgi::rstar<kMaxNodeElements_>> rtree_ {};
+};
+
+SpatialIndex::SpatialIndex() : p(std::make_unique<Impl>()) {}
+SpatialIndex::~SpatialIndex() = default;
+
+SpatialIndex::SpatialIndex(SpatialIndex&&) noexcept            = default;
+SpatialIndex& SpatialIndex::operator=(SpatialIndex&&) noexcept = default;
+
+bool SpatialIndex::empty() const
+{
+   return p->rtree_.empty();
+}
+
+std::size_t SpatialIndex::size() const
+{
+   return p->rtree_.size();
+}
+
+RTreeBox SpatialIndex::Impl::ToRTreeBox(const Box& box)
+{
+   const glm::vec2 min = glm::min(box.min_, box.max_);
+   const glm::vec2 max = glm::max(box.min_, box.max_);
+
+   return {{min.x, min.y}, {max.x, max.y}};
+}
+
+void SpatialIndex::Build(const std::vector<Box>& boxes)
+{
+   std::vector<RTreeValue> values {};
+   values.reserve(boxes.size());
+
+   for (std::size_t i = 0; i < boxes.size(); ++i)
+   {
+      values.emplace_back(Impl::ToRTreeBox(boxes[i]), i);
+   }
+
+   // Constructing the tree from a range uses the packing algorithm, which is
+   // faster to build and to query than inserting each value
+   p->rtree_ = decltype(p->rtree_) {values};
+}
+
+void SpatialIndex::Build(const std::vector<Item>& items)
+{
+   std::vector<RTreeValue> values {};
+   values.reserve(items.size());
+
+   for (auto& item : items)
+   {
+      values.emplace_back(Impl::ToRTreeBox(item.second), item.first);
+   }
+
+   p->rtree_ = decltype(p->rtree_) {values};
+}
+
+void SpatialIndex::Insert(std::size_t id, const Box& box)
+{
+   p->rtree_.insert({Impl::ToRTreeBox(box), id});
+}
+
+bool SpatialIndex::Remove(std::size_t id, const Box& box)
+{
+   return p->rtree_.remove(RTreeValue {Impl::ToRTreeBox(box), id}) > 0;
+}
+
+void SpatialIndex::Clear()
+{
+   p->rtree_.clear();
+}
+
+std::vector<std::size_t> SpatialIndex::Impl::Query(const RTreeBox& box) const
+{
+   std::vector<RTreeValue> values {};
+   rtree_.query(bgi::intersects(box), std::back_inserter(values));
+
+   std::vector<std::size_t> items {};
+   items.reserve(values.size());
+
+   for (auto& value : values)
+   {
+      items.push_back(value.second);
+   }
+
+   std::sort(items.begin(), items.end());
+
+   return items;
+}
+
+std::vector<std::size_t> SpatialIndex::Query(const Box& box) const
+{
+   return p->Query(Impl::ToRTreeBox(box));
+}
+
+std::vector<std::size_t> SpatialIndex::Query(const glm::vec2& point,
+                                             float            distance) const
+{
+   return p->Query(Impl::ToRTreeBox({point - distance, point + distance}));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
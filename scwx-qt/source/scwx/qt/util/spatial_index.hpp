@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * The SpatialIndex class indexes draw items by their bounding box in map
+ * screen coordinates, so a mouse picking query only tests the items near the
+ * mouse cursor. Items are identified by a caller-defined ID, typically the
+ * position of the item in its draw list, so items drawn last can be tested
+ * first.
+ *
+ * Items with a pixel size that does not scale with the map (text, icons, line
+ * widths) are indexed by their map coordinates alone. The query box is then
+ * expanded by the largest pixel extent, converted to map screen coordinates at
+ * the current zoom level.
+ */
+class SpatialIndex
+{
+public:
+   struct Box
+   {
+      glm::vec2 min_ {};
+      glm::vec2 max_ {};
+   };
+
+   typedef std::pair<std::size_t, Box> Item;
+
+   explicit SpatialIndex();
+   ~SpatialIndex();
+
+   SpatialIndex(const SpatialIndex&)            = delete;
+   SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+   SpatialIndex(SpatialIndex&&) noexcept;
+   SpatialIndex& operator=(SpatialIndex&&) noexcept;
+
+   bool        empty() const;
+   std::size_t size() const;
+
+   /**
+    * Replaces the contents of the index. Each item is identified by its
+    * position in the list.
+    *
+    * @param [in] boxes Bounding box of each item
+    */
+   void Build(const std::vector<Box>& boxes);
+
+   /**
+    * Replaces the contents of the index.
+    *
+    * @param [in] items ID and bounding box of each item
+    */
+   void Build(const std::vector<Item>& items);
+
+   /**
+    * Adds an item to the index.
+    *
+    * @param [in] id Item ID
+    * @param [in] box Bounding box of the item
+    */
+   void Insert(std::size_t id, const Box& box);
+
+   /**
+    * Removes an item from the index.
+    *
+    * @param [in] id Item ID
+    * @param [in] box Bounding box of the item, as inserted
+    *
+    * @return true if the item was removed, otherwise false
+    */
+   bool Remove(std::size_t id, const Box& box);
+
+   /**
+    * Removes all items from the index.
+    */
+   void Clear();
+
+   /**
+    * Finds the items whose bounding box intersects a query box.
+    *
+    * @param [in] box Query box, in map screen coordinates
+    *
+    * @return Items intersecting the query box, in ascending order
+    */
+   std::vector<std::size_t> Query(const Box& box) const;
+
+   /**
+    * Finds the items whose bounding box lies within a distance of a point.
+    *
+    * @param [in] point Query point, in map screen coordinates
+    * @param [in] distance Distance from the point, in map screen coordinates
+    *
+    * @return Items near the query point, in ascending order
+    */
+   std::vector<std::size_t> Query(const glm::vec2& point, float distance) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
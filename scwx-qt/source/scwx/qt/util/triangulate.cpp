@@ -0,0 +1,259 @@
+#include <scwx/qt/util/triangulate.hpp>
+
+#include <algorithm>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static double Cross(const glm::dvec2& a,
+                    const glm::dvec2& b,
+                    const glm::dvec2& c);
+static bool   OnSegment(const glm::dvec2& a,
+                        const glm::dvec2& b,
+                        const glm::dvec2& p);
+static bool   SegmentsIntersect(const glm::dvec2& a,
+                                const glm::dvec2& b,
+                                const glm::dvec2& c,
+                                const glm::dvec2& d);
+static bool   IsSimple(const std::vector<glm::dvec2>& ring);
+static bool   TriangleContainsPoint(const glm::dvec2& a,
+                                    const glm::dvec2& b,
+                                    const glm::dvec2& c,
+                                    const glm::dvec2& p);
+
+std::optional<std::vector<std::uint32_t>>
+TriangulateSimplePolygon(std::span<const glm::vec2> points)
+{
+   std::vector<std::uint32_t> triangles {};
+
+   // Remove consecutive duplicate points, including a closing point
+   std::vector<std::uint32_t> indices {};
+   std::vector<glm::dvec2>    ring {};
+   indices.reserve(points.size());
+   ring.reserve(points.size());
+
+   for (std::uint32_t i = 0; i < points.size(); ++i)
+   {
+      if (ring.empty() || ring.back() != glm::dvec2 {points[i]})
+      {
+         indices.push_back(i);
+         ring.emplace_back(points[i]);
+      }
+   }
+   while (ring.size() > 1 && ring.back() == ring.front())
+   {
+      indices.pop_back();
+      ring.pop_back();
+   }
+
+   if (ring.size() < 3)
+   {
+      // Nothing to fill
+      return triangles;
+   }
+
+   if (!IsSimple(ring))
+   {
+      return std::nullopt;
+   }
+
+   // Orient the polygon counterclockwise
+   double area = 0.0;
+   for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++)
+   {
+      area += ring[j].x * ring[i].y - ring[i].x * ring[j].y;
+   }
+   if (area == 0.0)
+   {
+      // Nothing to fill
+      return triangles;
+   }
+   if (area < 0.0)
+   {
+      std::reverse(indices.begin(), indices.end());
+      std::reverse(ring.begin(), ring.end());
+   }
+
+   const std::size_t n = ring.size();
+
+   // Remaining vertices are kept in a circular linked list
+   std::vector<std::size_t> prev(n);
+   std::vector<std::size_t> next(n);
+   std::vector<bool>        reflex(n);
+
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      prev[i] = (i + n - 1) % n;
+      next[i] = (i + 1) % n;
+   }
+
+   auto updateReflex = [&](std::size_t i)
+   { reflex[i] = Cross(ring[prev[i]], ring[i], ring[next[i]]) < 0.0; };
+
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      updateReflex(i);
+   }
+
+   auto isEar = [&](std::size_t i)
+   {
+      const std::size_t u = prev[i];
+      const std::size_t w = next[i];
+
+      if (reflex[i])
+      {
+         return false;
+      }
+
+      // An ear contains no remaining reflex vertex. Convex vertices cannot lie
+      // inside an ear.
+      for (std::size_t j = next[w]; j != u; j = next[j])
+      {
+         if (reflex[j] &&
+             TriangleContainsPoint(ring[u], ring[i], ring[w], ring[j]))
+         {
+            return false;
+         }
+      }
+
+      return true;
+   };
+
+   triangles.reserve((n - 2) * 3);
+
+   std::size_t remaining = n;
+   std::size_t i         = 0;
+   std::size_t attempts  = 0;
+
+   while (remaining > 3)
+   {
+      if (isEar(i))
+      {
+         const std::size_t u = prev[i];
+         const std::size_t w = next[i];
+
+         // Collinear vertices are removed without a triangle
+         if (Cross(ring[u], ring[i], ring[w]) > 0.0)
+         {
+            triangles.insert(triangles.end(),
+                             {indices[u], indices[i], indices[w]});
+         }
+
+         next[u] = w;
+         prev[w] = u;
+         --remaining;
+
+         updateReflex(u);
+         updateReflex(w);
+
+         i        = w;
+         attempts = 0;
+      }
+      else if (++attempts > remaining)
+      {
+         // No ear was found, which may occur due to floating point error
+         return std::nullopt;
+      }
+      else
+      {
+         i = next[i];
+      }
+   }
+
+   const std::size_t u = prev[i];
+   const std::size_t w = next[i];
+   if (Cross(ring[u], ring[i], ring[w]) > 0.0)
+   {
+      triangles.insert(triangles.end(), {indices[u], indices[i], indices[w]});
+   }
+
+   return triangles;
+}
+
+static double
+Cross(const glm::dvec2& a, const glm::dvec2& b, const glm::dvec2& c)
+{
+   return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+static bool
+OnSegment(const glm::dvec2& a, const glm::dvec2& b, const glm::dvec2& p)
+{
+   return std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+          std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+}
+
+static bool SegmentsIntersect(const glm::dvec2& a,
+                              const glm::dvec2& b,
+                              const glm::dvec2& c,
+                              const glm::dvec2& d)
+{
+   const double d1 = Cross(c, d, a);
+   const double d2 = Cross(c, d, b);
+   const double d3 = Cross(a, b, c);
+   const double d4 = Cross(a, b, d);
+
+   if (((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0)) &&
+       ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0)))
+   {
+      return true;
+   }
+
+   // Segments touching or overlapping are also considered intersecting
+   return (d1 == 0.0 && OnSegment(c, d, a)) ||
+          (d2 == 0.0 && OnSegment(c, d, b)) ||
+          (d3 == 0.0 && OnSegment(a, b, c)) ||
+          (d4 == 0.0 && OnSegment(a, b, d));
+}
+
+static bool IsSimple(const std::vector<glm::dvec2>& ring)
+{
+   const std::size_t n = ring.size();
+
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const glm::dvec2& a = ring[i];
+      const glm::dvec2& b = ring[(i + 1) % n];
+      const glm::dvec2& c = ring[(i + 2) % n];
+
+      // Adjacent edges may only meet at their shared vertex
+      if (Cross(a, b, c) == 0.0 && glm::dot(b - a, c - b) < 0.0)
+      {
+         return false;
+      }
+
+      // Test against each non-adjacent edge
+      for (std::size_t j = i + 2; j < n; ++j)
+      {
+         if (i == 0 && j == n - 1)
+         {
+            continue;
+         }
+
+         if (SegmentsIntersect(a, b, ring[j], ring[(j + 1) % n]))
+         {
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+static bool TriangleContainsPoint(const glm::dvec2& a,
+                                  const glm::dvec2& b,
+                                  const glm::dvec2& c,
+                                  const glm::dvec2& p)
+{
+   // The triangle is counterclockwise. Points on the boundary are contained.
+   return Cross(a, b, p) >= 0.0 && Cross(b, c, p) >= 0.0 &&
+          Cross(c, a, p) >= 0.0;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * Triangulates a simple polygon using ear clipping. The polygon may be given
+ * in either orientation, and may repeat its first point as its last point.
+ * Consecutive duplicate points and collinear points are removed.
+ *
+ * @param [in] points Polygon vertices
+ *
+ * @return Indices into points of each triangle vertex, with three indices per
+ * triangle, or an empty optional if the polygon is not simple (i.e., its edges
+ * intersect)
+ */
+std::optional<std::vector<std::uint32_t>>
+TriangulateSimplePolygon(std::span<const glm::vec2> points);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,10 +1,16 @@
 #include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/manager/color_table_manager.hpp>
+#include <scwx/qt/settings/product_settings.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
+#include <scwx/qt/util/azimuth_index.hpp>
+#include <scwx/qt/util/coordinate_cache.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/polar_sweep.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 
@@ -21,18 +27,19 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level2_product_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static auto& sweepHistogram_ =
+   scwx::util::MetricsRegistry::Instance().GetHistogram("sweep.level2");
+static auto& coordinatesHistogram_ =
+   scwx::util::MetricsRegistry::Instance().GetHistogram(
+      "sweep.level2.coordinates");
+
 static constexpr std::uint32_t kMaxRadialGates_ =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
 
 static constexpr std::uint8_t kDataWordSize8_ = 8u;
 
-static constexpr std::size_t kVerticesPerGate_       = 6u;
-static constexpr std::size_t kVerticesPerOriginGate_ = 3u;
-
-static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr uint32_t VALUES_PER_VERTEX = 2u;
+static constexpr uint16_t RANGE_FOLDED = 1u;
 
 static const std::unordered_map<common::Level2Product,
                                 wsr88d::rda::DataBlockType>
@@ -116,9 +123,11 @@ public:
    Impl(Impl&&) noexcept            = delete;
    Impl& operator=(Impl&&) noexcept = delete;
 
-   void ComputeCoordinates(
+   bool ComputeCoordinates(
       const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
       bool                                               smoothingEnabled);
+   static std::shared_ptr<const util::AzimuthIndex> BuildAzimuthIndex(
+      const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData);
 
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
@@ -126,8 +135,6 @@ public:
    void UpdateSpeedUnits(const std::string& name);
 
    void ComputeEdgeValue();
-   template<typename T>
-   [[nodiscard]] inline T RemapDataMoment(T dataMoment) const;
 
    static bool IsRadarDataIncomplete(
       const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData);
@@ -150,12 +157,13 @@ public:
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
-   std::uint16_t         edgeValue_ {};
+   std::shared_ptr<const util::CoordinateTable> coordinateTable_ {};
+   std::shared_ptr<const util::AzimuthIndex>    azimuthIndex_ {};
+
+   std::vector<float>                coordinates_ {};
+   std::shared_ptr<util::PolarSweep> polarSweep_ {
+      std::make_shared<util::PolarSweep>()};
+   std::uint16_t edgeValue_ {};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -168,10 +176,10 @@ public:
 
    std::chrono::system_clock::time_point sweepTime_;
 
-   std::shared_ptr<common::ColorTable>    colorTable_;
-   std::vector<boost::gil::rgba8_pixel_t> colorTableLut_;
-   uint16_t                               colorTableMin_;
-   uint16_t                               colorTableMax_;
+   std::shared_ptr<common::ColorTable>                     colorTable_;
+   std::shared_ptr<const manager::ColorTableManager::Lut> colorTableLut_;
+   uint16_t                                                colorTableMin_;
+   uint16_t                                                colorTableMax_;
 
    std::shared_ptr<common::ColorTable> savedColorTable_;
    float                               savedScale_;
@@ -211,6 +219,29 @@ void Level2ProductView::ConnectRadarProductManager()
                  Update();
               }
            });
+   connect(radar_product_manager().get(),
+           &manager::RadarProductManager::ElevationScanLoaded,
+           this,
+           [this](std::shared_ptr<types::RadarProductRecord> record,
+                  float elevationCut)
+           {
+              // Ignore records which are not displayed for the selected time,
+              // such as prefetched loop frames
+              if (!radar_product_manager()->IsLevel2RecordSelected(
+                     record->time(), selected_time()))
+              {
+                 return;
+              }
+
+              // Update the view if the newly loaded elevation scan is at least
+              // as close to the selected elevation as the displayed scan
+              if (p->elevationScan_ == nullptr ||
+                  std::abs(elevationCut - p->selectedElevation_) <=
+                     std::abs(p->elevationCut_ - p->selectedElevation_))
+              {
+                 Update();
+              }
+           });
 }
 
 void Level2ProductView::DisconnectRadarProductManager()
@@ -219,6 +250,10 @@ void Level2ProductView::DisconnectRadarProductManager()
               &manager::RadarProductManager::DataReloaded,
               this,
               nullptr);
+   disconnect(radar_product_manager().get(),
+              &manager::RadarProductManager::ElevationScanLoaded,
+              this,
+              nullptr);
 }
 
 boost::asio::thread_pool& Level2ProductView::thread_pool()
@@ -234,19 +269,19 @@ std::shared_ptr<common::ColorTable> Level2ProductView::color_table() const
 const std::vector<boost::gil::rgba8_pixel_t>&
 Level2ProductView::color_table_lut() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr)
    {
       return RadarProductView::color_table_lut();
    }
    else
    {
-      return p->colorTableLut_;
+      return *p->colorTableLut_;
    }
 }
 
 uint16_t Level2ProductView::color_table_min() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr)
    {
       return RadarProductView::color_table_min();
    }
@@ -258,7 +293,7 @@ uint16_t Level2ProductView::color_table_min() const
 
 uint16_t Level2ProductView::color_table_max() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr)
    {
       return RadarProductView::color_table_max();
    }
@@ -329,7 +364,14 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   // Level 2 sweeps are rendered from the polar sweep, without vertices
+   static const std::vector<float> kNoVertices_ {};
+   return kNoVertices_;
+}
+
+std::shared_ptr<const util::PolarSweep> Level2ProductView::polar_sweep() const
+{
+   return p->polarSweep_;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -349,38 +391,10 @@ std::vector<float> Level2ProductView::GetElevationCuts() const
 
 std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
 {
-   const void* data;
-   size_t      dataSize;
-   size_t      componentSize;
-
-   if (p->dataMoments8_.size() > 0)
-   {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
-      componentSize = 1;
-   }
-   else
-   {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
-      componentSize = 2;
-   }
-
-   return std::tie(data, dataSize, componentSize);
-}
-
-std::tuple<const void*, size_t, size_t>
-Level2ProductView::GetCfpMomentData() const
-{
+   // Data moments are packed in the polar sweep
    const void* data          = nullptr;
    size_t      dataSize      = 0;
-   size_t      componentSize = 1;
-
-   if (p->cfpMoments_.size() > 0)
-   {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
-   }
+   size_t      componentSize = p->polarSweep_->component_size();
 
    return std::tie(data, dataSize, componentSize);
 }
@@ -485,28 +499,10 @@ void Level2ProductView::UpdateColorTableLut()
       break;
    }
 
-   boost::integer_range<uint16_t> dataRange =
-      boost::irange<uint16_t>(rangeMin, rangeMax + 1);
-
-   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
-   lut.resize(rangeMax - rangeMin + 1);
-   lut.shrink_to_fit();
-
-   std::for_each(std::execution::par_unseq,
-                 dataRange.begin(),
-                 dataRange.end(),
-                 [&](uint16_t i)
-                 {
-                    if (i == RANGE_FOLDED)
-                    {
-                       lut[i - *dataRange.begin()] = p->colorTable_->rf_color();
-                    }
-                    else
-                    {
-                       float f                     = (i - offset) / scale;
-                       lut[i - *dataRange.begin()] = p->colorTable_->Color(f);
-                    }
-                 });
+   // The lookup table is shared with other views of the same color table and
+   // moment data scaling
+   p->colorTableLut_ = manager::ColorTableManager::Instance().GetLut(
+      p->colorTable_, scale, offset, rangeMin, rangeMax);
 
    p->colorTableMin_ = rangeMin;
    p->colorTableMax_ = rangeMax;
@@ -523,6 +519,7 @@ void Level2ProductView::ComputeSweep()
    logger_->trace("ComputeSweep()");
 
    boost::timer::cpu_timer timer;
+   const auto sweepStart = std::chrono::steady_clock::now();
 
    if (p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
    {
@@ -563,7 +560,7 @@ void Level2ProductView::ComputeSweep()
 
    logger_->debug("Computing Sweep");
 
-   std::size_t radials       = radarData->crbegin()->first + 1;
+   std::size_t radials       = radarData->size();
    std::size_t vertexRadials = radials;
 
    // When there is missing data, insert another empty vertex radial at the end
@@ -579,14 +576,16 @@ void Level2ProductView::ComputeSweep()
    vertexRadials =
       std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
 
-   p->ComputeCoordinates(radarData, smoothingEnabled);
+   const bool coordinatesChanged =
+      p->ComputeCoordinates(radarData, smoothingEnabled);
 
    const std::vector<float>& coordinates = p->coordinates_;
 
-   auto& radarData0     = (*radarData)[0];
+   auto& radarData0     = radarData->front();
    auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
    p->elevationScan_    = radarData;
    p->momentDataBlock0_ = momentData0;
+   p->azimuthIndex_     = Impl::BuildAzimuthIndex(radarData);
 
    if (momentData0 == nullptr)
    {
@@ -608,56 +607,35 @@ void Level2ProductView::ComputeSweep()
                                          radarData0->collection_time());
    p->vcp_       = radarData0->volume_coverage_pattern_number();
 
-   // Calculate vertices
+   // Pack data moments
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(vertexRadials * gates * VERTICES_PER_BIN *
-                   VALUES_PER_VERTEX);
+   util::PolarSweep& polarSweep = *p->polarSweep_;
 
-   // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
-   size_t                 mIndex        = 0;
+   const bool hasCfpMoments =
+      p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
+      momentData0->data_word_size() == kDataWordSize8_ &&
+      radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
+         nullptr;
 
-   if (momentData0->data_word_size() == 8)
-   {
-      dataMoments16.resize(0);
-      dataMoments16.shrink_to_fit();
+   polarSweep.Reset(momentData0->data_word_size() / kDataWordSize8_,
+                    static_cast<std::uint16_t>(gates),
+                    hasCfpMoments,
+                    radials);
 
-      dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
-   }
-   else
+   if (coordinatesChanged)
    {
-      dataMoments8.resize(0);
-      dataMoments8.shrink_to_fit();
-
-      dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
-   }
-
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
-       radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
-          nullptr)
-   {
-      cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
-   }
-   else
-   {
-      cfpMoments.resize(0);
-      cfpMoments.shrink_to_fit();
+      polarSweep.SetCoordinates(
+         std::span<const float> {coordinates}.first(
+            vertexRadials * common::MAX_DATA_MOMENT_GATES * 2),
+         static_cast<std::uint16_t>(vertexRadials),
+         static_cast<std::uint16_t>(common::MAX_DATA_MOMENT_GATES));
    }
 
    // Compute threshold at which to display an individual bin (minimum of 2)
    const std::uint16_t snrThreshold =
       std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
 
-   // Start radial is always 0, as coordinates are calculated for each sweep
-   constexpr std::uint16_t startRadial = 0u;
-
    // For most products other than reflectivity, the edge should not go to the
    // bottom of the color table
    if (smoothingEnabled)
@@ -665,11 +643,23 @@ void Level2ProductView::ComputeSweep()
       p->ComputeEdgeValue();
    }
 
-   for (auto it = radarData->cbegin(); it != radarData->cend(); ++it)
+   polarSweep.SetParameters({p->latitude_,
+                             p->longitude_,
+                             snrThreshold,
+                             p->edgeValue_,
+                             smoothingEnabled,
+                             showSmoothedRangeFolding});
+
+   const auto radialSlots = radarData->radials();
+
+   for (std::uint16_t radial = 0; radial < radialSlots.size(); ++radial)
    {
-      const auto&   radialPair = *it;
-      std::uint16_t radial     = radialPair.first;
-      const auto&   radialData = radialPair.second;
+      const auto& radialData = radialSlots[radial];
+      if (radialData == nullptr)
+      {
+         continue;
+      }
+
       const std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
          momentData = radialData->moment_data_block(p->dataBlockType_);
 
@@ -710,312 +700,57 @@ void Level2ProductView::ComputeSweep()
          ++startGate;
       }
 
-      const std::uint8_t*  dataMomentsArray8      = nullptr;
-      const std::uint16_t* dataMomentsArray16     = nullptr;
-      const std::uint8_t*  nextDataMomentsArray8  = nullptr;
-      const std::uint16_t* nextDataMomentsArray16 = nullptr;
-      const std::uint8_t*  cfpMomentsArray        = nullptr;
+      const util::PolarSweep::Radial polarRadial {
+         static_cast<std::int32_t>(radial % vertexRadials),
+         static_cast<std::int32_t>((radial + 1u) % vertexRadials),
+         startGate,
+         gateSize,
+         endGate,
+         numberOfDataMomentGates};
 
-      if (momentData->data_word_size() == 8)
-      {
-         dataMomentsArray8 =
-            reinterpret_cast<const std::uint8_t*>(momentData->data_moments());
-      }
-      else
-      {
-         dataMomentsArray16 =
-            reinterpret_cast<const std::uint16_t*>(momentData->data_moments());
-      }
+      const auto moments = static_cast<std::size_t>(numberOfDataMomentGates);
 
-      if (cfpMoments.size() > 0)
+      if (momentData->data_word_size() == kDataWordSize8_)
       {
-         cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
-            radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
-               ->data_moments());
-      }
+         std::span<const std::uint8_t> cfpMoments {};
 
-      std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-                   nextMomentData              = nullptr;
-      std::int32_t numberOfNextDataMomentGates = 0;
-      if (smoothingEnabled)
-      {
-         // Smoothing requires the next radial pair as well
-         auto nextIt = std::next(it);
-         if (nextIt == radarData->cend())
+         if (hasCfpMoments)
          {
-            nextIt = radarData->cbegin();
-         }
-
-         const auto& nextRadialPair = *(nextIt);
-         const auto& nextRadialData = nextRadialPair.second;
-         nextMomentData = nextRadialData->moment_data_block(p->dataBlockType_);
-
-         if (momentData->data_word_size() != nextMomentData->data_word_size())
-         {
-            // Data should be consistent between radials
-            logger_->warn("Invalid data moment size");
-            continue;
-         }
-
-         if (nextMomentData->data_word_size() == kDataWordSize8_)
-         {
-            nextDataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(
-               nextMomentData->data_moments());
-         }
-         else
-         {
-            nextDataMomentsArray16 = reinterpret_cast<const std::uint16_t*>(
-               nextMomentData->data_moments());
-         }
-
-         numberOfNextDataMomentGates = std::min<std::int32_t>(
-            nextMomentData->number_of_data_moment_gates(),
-            static_cast<std::int32_t>(gates));
-      }
-
-      for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
-      {
-         if (gate < 0)
-         {
-            continue;
-         }
-
-         const std::size_t vertexCount =
-            (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
-
-         // Allow pointer arithmetic here, as bounds have already been checked
-         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-         // Store data moment value
-         if (dataMomentsArray8 != nullptr)
-         {
-            if (!smoothingEnabled)
-            {
-               const std::uint8_t& dataValue = dataMomentsArray8[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-               {
-                  continue;
-               }
-
-               for (std::size_t m = 0; m < vertexCount; m++)
-               {
-                  dataMoments8[mIndex++] = dataValue;
-
-                  if (cfpMomentsArray != nullptr)
-                  {
-                     cfpMoments[mIndex - 1] = cfpMomentsArray[i];
-                  }
-               }
-            }
-            else if (gate > 0)
-            {
-               // Validate indices are all in range
-               if (i + 1 >= numberOfDataMomentGates ||
-                   i + 1 >= numberOfNextDataMomentGates)
-               {
-                  continue;
-               }
-
-               const std::uint8_t& dm1 = dataMomentsArray8[i];
-               const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
-               const std::uint8_t& dm3 = nextDataMomentsArray8[i];
-               const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-               {
-                  // Skip only if all data moments are hidden
-                  continue;
-               }
-
-               // The order must match the store vertices section below
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-
-               // cfpMoments is unused, so not populated here
-            }
-            else
-            {
-               // If smoothing is enabled, gate should never start at zero
-               // (radar site origin)
-               logger_->error(
-                  "Smoothing enabled, gate should not start at zero");
-               continue;
-            }
-         }
-         else
-         {
-            if (!smoothingEnabled)
-            {
-               const std::uint16_t& dataValue = dataMomentsArray16[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-               {
-                  continue;
-               }
-
-               for (std::size_t m = 0; m < vertexCount; m++)
-               {
-                  dataMoments16[mIndex++] = dataValue;
-               }
-            }
-            else if (gate > 0)
+            auto cfpData = radialData->moment_data_block(
+               wsr88d::rda::DataBlockType::MomentCfp);
+            if (cfpData != nullptr)
             {
-               // Validate indices are all in range
-               if (i + 1 >= numberOfDataMomentGates ||
-                   i + 1 >= numberOfNextDataMomentGates)
-               {
-                  continue;
-               }
-
-               const std::uint16_t& dm1 = dataMomentsArray16[i];
-               const std::uint16_t& dm2 = dataMomentsArray16[i + 1];
-               const std::uint16_t& dm3 = nextDataMomentsArray16[i];
-               const std::uint16_t& dm4 = nextDataMomentsArray16[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-               {
-                  // Skip only if all data moments are hidden
-                  continue;
-               }
-
-               // The order must match the store vertices section below
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-
-               // cfpMoments is unused, so not populated here
-            }
-            else
-            {
-               // If smoothing is enabled, gate should never start at zero
-               // (radar site origin)
-               continue;
+               cfpMoments = {reinterpret_cast<const std::uint8_t*>(
+                                cfpData->data_moments()),
+                             std::min<std::size_t>(
+                                cfpData->number_of_data_moment_gates(),
+                                moments)};
             }
          }
 
-         // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-         // Store vertices
-         if (gate > 0)
-         {
-            // Draw two triangles per gate
-            //
-            // 2 +---+ 4
-            //   |  /|
-            //   | / |
-            //   |/  |
-            // 1 +---+ 3
-
-            const std::uint16_t baseCoord = gate - 1;
-
-            const std::size_t offset1 =
-               ((startRadial + radial) % vertexRadials *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            const std::size_t offset2 =
-               offset1 + static_cast<std::size_t>(gateSize) * 2;
-            const std::size_t offset3 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            const std::size_t offset4 =
-               offset3 + static_cast<std::size_t>(gateSize) * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-         }
-         else
-         {
-            const std::uint16_t baseCoord = gate;
-
-            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
-                                      common::MAX_DATA_MOMENT_GATES +
-                                   baseCoord) *
-                                  2;
-            std::size_t offset2 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-         }
+         polarSweep.AddRadial(polarRadial,
+                              {reinterpret_cast<const std::uint8_t*>(
+                                  momentData->data_moments()),
+                               moments},
+                              cfpMoments);
+      }
+      else
+      {
+         polarSweep.AddRadial(polarRadial,
+                              {reinterpret_cast<const std::uint16_t*>(
+                                  momentData->data_moments()),
+                               moments});
       }
-   }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
-
-   if (momentData0->data_word_size() == 8)
-   {
-      dataMoments8.resize(mIndex);
-      dataMoments8.shrink_to_fit();
-   }
-   else
-   {
-      dataMoments16.resize(mIndex);
-      dataMoments16.shrink_to_fit();
-   }
-
-   if (cfpMoments.size() > 0)
-   {
-      cfpMoments.resize(mIndex);
-      cfpMoments.shrink_to_fit();
    }
 
    timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   logger_->debug("Sweep packed in {}", timer.format(6, "%ws"));
 
    UpdateColorTableLut();
 
+   // Only computed sweeps are recorded
+   sweepHistogram_.Record(std::chrono::steady_clock::now() - sweepStart);
+
    Q_EMIT SweepComputed();
 }
 
@@ -1046,45 +781,33 @@ void Level2ProductView::Impl::ComputeEdgeValue()
    }
 }
 
-template<typename T>
-T Level2ProductView::Impl::RemapDataMoment(T dataMoment) const
-{
-   if (dataMoment != 0 &&
-       (dataMoment != RANGE_FOLDED || showSmoothedRangeFolding_))
-   {
-      return dataMoment;
-   }
-   else
-   {
-      return edgeValue_;
-   }
-}
-
-void Level2ProductView::Impl::ComputeCoordinates(
+bool Level2ProductView::Impl::ComputeCoordinates(
    const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
    bool                                               smoothingEnabled)
 {
    logger_->debug("ComputeCoordinates()");
 
    boost::timer::cpu_timer timer;
+   scwx::util::ScopedTimer coordinatesTimer {coordinatesHistogram_};
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+   auto        radarProductManager = self_->radar_product_manager();
+   auto        radarSite           = radarProductManager->radar_site();
+   const float gateSize            = radarProductManager->gate_size();
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   const common::Coordinate radarCoordinate {radarSite->latitude(),
+                                             radarSite->longitude()};
+   const bool               exactCoordinates =
+      settings::ProductSettings::Instance()
+         .exact_sweep_coordinates()
+         .GetValue();
 
    // Calculate azimuth coordinates
    timer.start();
 
-   auto& radarData0  = (*radarData)[0];
+   auto& radarData0  = radarData->front();
    auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
 
-   std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->crbegin()->first + 1);
+   std::uint16_t numRadials = static_cast<std::uint16_t>(radarData->size());
    const std::uint16_t numRangeBins =
       std::max(momentData0->number_of_data_moment_gates() + 1u,
                common::MAX_DATA_MOMENT_GATES);
@@ -1100,7 +823,20 @@ void Level2ProductView::Impl::ComputeCoordinates(
       std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
 
    auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+
+   // Radials without enough angles present to determine an angle are NaN
+   std::vector<float> azimuths(numRadials,
+                               std::numeric_limits<float>::quiet_NaN());
+
+   // Azimuth angles of received radials, NaN if not received
+   const auto azimuthAngles = radarData->azimuth_angles();
+   const auto azimuthAngle  = [&azimuthAngles](std::uint32_t radial)
+   {
+      return units::degrees<float> {
+         (radial < azimuthAngles.size()) ?
+            azimuthAngles[radial] :
+            std::numeric_limits<float>::quiet_NaN()};
+   };
 
    const float gateRangeOffset = (smoothingEnabled) ?
                                     // Center of the first gate is half the gate
@@ -1118,29 +854,27 @@ void Level2ProductView::Impl::ComputeCoordinates(
       {
          units::degrees<float> angle {};
 
-         auto radialData = radarData->find(radial);
-         if (radialData != radarData->cend() && !smoothingEnabled)
+         const units::degrees<float> currentAngle = azimuthAngle(radial);
+         const bool hasRadial = !std::isnan(currentAngle.value());
+
+         if (hasRadial && !smoothingEnabled)
          {
-            angle = radialData->second->azimuth_angle();
+            angle = currentAngle;
          }
          else
          {
-            auto prevRadial1 = radarData->find(
+            const units::degrees<float> prevAngle1 = azimuthAngle(
                (radial >= 1) ? radial - 1 : numRadials - (1 - radial));
-            auto prevRadial2 = radarData->find(
+            const units::degrees<float> prevAngle2 = azimuthAngle(
                (radial >= 2) ? radial - 2 : numRadials - (2 - radial));
+            const bool hasPrevRadial1 = !std::isnan(prevAngle1.value());
+            const bool hasPrevRadial2 = !std::isnan(prevAngle2.value());
 
-            if (radialData != radarData->cend() &&
-                prevRadial1 != radarData->cend() && smoothingEnabled)
+            if (hasRadial && hasPrevRadial1 && smoothingEnabled)
             {
-               const units::degrees<float> currentAngle =
-                  radialData->second->azimuth_angle();
-               const units::degrees<float> prevAngle =
-                  prevRadial1->second->azimuth_angle();
-
                // Calculate delta angle
                const units::degrees<float> deltaAngle =
-                  NormalizeAngle(currentAngle - prevAngle);
+                  NormalizeAngle(currentAngle - prevAngle1);
 
                // Delta scale is half the delta angle to reach the center of the
                // bin, because smoothing is enabled
@@ -1148,11 +882,8 @@ void Level2ProductView::Impl::ComputeCoordinates(
 
                angle = currentAngle + deltaAngle * deltaScale;
             }
-            else if (radialData != radarData->cend() && smoothingEnabled)
+            else if (hasRadial && smoothingEnabled)
             {
-               const units::degrees<float> currentAngle =
-                  radialData->second->azimuth_angle();
-
                // Assume a half degree delta if there aren't enough angles
                // to determine a delta angle
                constexpr units::degrees<float> deltaAngle {0.5f};
@@ -1163,14 +894,8 @@ void Level2ProductView::Impl::ComputeCoordinates(
 
                angle = currentAngle + deltaAngle * deltaScale;
             }
-            else if (prevRadial1 != radarData->cend() &&
-                     prevRadial2 != radarData->cend())
+            else if (hasPrevRadial1 && hasPrevRadial2)
             {
-               const units::degrees<float> prevAngle1 =
-                  prevRadial1->second->azimuth_angle();
-               const units::degrees<float> prevAngle2 =
-                  prevRadial2->second->azimuth_angle();
-
                // Calculate delta angle
                const units::degrees<float> deltaAngle =
                   NormalizeAngle(prevAngle1 - prevAngle2);
@@ -1185,11 +910,8 @@ void Level2ProductView::Impl::ComputeCoordinates(
 
                angle = prevAngle1 + deltaAngle * deltaScale;
             }
-            else if (prevRadial1 != radarData->cend())
+            else if (hasPrevRadial1)
             {
-               const units::degrees<float> prevAngle1 =
-                  prevRadial1->second->azimuth_angle();
-
                // Assume a half degree delta if there aren't enough angles
                // to determine a delta angle
                constexpr units::degrees<float> deltaAngle {0.5f};
@@ -1211,35 +933,137 @@ void Level2ProductView::Impl::ComputeCoordinates(
             }
          }
 
-         std::for_each(
-            std::execution::par_unseq,
-            gates.begin(),
-            gates.end(),
-            [&](std::uint32_t gate)
-            {
-               const std::uint32_t radialGate =
-                  radial * common::MAX_DATA_MOMENT_GATES + gate;
-               const float range =
-                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-               const std::size_t offset =
-                  static_cast<std::size_t>(radialGate) * 2;
-
-               double latitude  = 0.0;
-               double longitude = 0.0;
-
-               geodesic.Direct(radarLatitude,
-                               radarLongitude,
-                               angle.value(),
-                               range,
-                               latitude,
-                               longitude);
-
-               coordinates_[offset]     = static_cast<float>(latitude);
-               coordinates_[offset + 1] = static_cast<float>(longitude);
-            });
+         azimuths[radial] = angle.value();
+      });
+
+   // The coordinate table is keyed by the azimuth of each radial, so it is
+   // shared by every sweep with the same azimuths
+   const util::CoordinateCacheKey key {
+      radarSite->id(),
+      static_cast<std::int16_t>(std::lround(elevationCut_ * 10.0f)),
+      numRadials,
+      util::CoordinateCacheKey::HashAzimuths(azimuths),
+      numRangeBins,
+      gateSize,
+      smoothingEnabled,
+      exactCoordinates};
+
+   auto coordinateTable = util::CoordinateCache::Instance().GetOrCalculate(
+      key, radarCoordinate, azimuths, gateRangeOffset * gateSize);
+
+   if (coordinateTable != nullptr && coordinateTable == coordinateTable_)
+   {
+      // Coordinates are unchanged since the last computation
+      timer.stop();
+      logger_->debug("Coordinates unchanged in {}", timer.format(6, "%ws"));
+      return false;
+   }
+
+   // Copy cached coordinates into the rendering layout
+   std::for_each(
+      std::execution::par_unseq,
+      radials.begin(),
+      radials.end(),
+      [&](std::uint32_t radial)
+      {
+         constexpr std::size_t kRadialSize = common::MAX_DATA_MOMENT_GATES * 2;
+
+         auto destination = std::span<float> {coordinates_}.subspan(
+            radial * kRadialSize, kRadialSize);
+
+         if (std::isnan(azimuths[radial]))
+         {
+            return;
+         }
+
+         if (coordinateTable != nullptr)
+         {
+            auto source = coordinateTable->radial(
+               static_cast<std::uint16_t>(radial));
+            source = source.first(std::min(source.size(), kRadialSize));
+
+            std::copy(source.begin(), source.end(), destination.begin());
+         }
+         else
+         {
+            util::GeographicLib::GetRadialCoordinates(
+               radarCoordinate,
+               units::degrees<double> {azimuths[radial]},
+               units::meters<double> {gateRangeOffset * gateSize},
+               units::meters<double> {gateSize},
+               destination,
+               exactCoordinates);
+         }
       });
+
+   coordinateTable_ = coordinateTable;
+
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+
+   return true;
+}
+
+std::shared_ptr<const util::AzimuthIndex>
+Level2ProductView::Impl::BuildAzimuthIndex(
+   const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData)
+{
+   auto azimuthIndex = std::make_shared<util::AzimuthIndex>();
+
+   std::uint16_t numRadials = static_cast<std::uint16_t>(radarData->size());
+
+   // Add an extra radial when incomplete data exists
+   if (IsRadarDataIncomplete(radarData))
+   {
+      ++numRadials;
+   }
+
+   // Limit radials
+   numRadials =
+      std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
+
+   // Azimuth angles of received radials, NaN if not received
+   const auto azimuthAngles = radarData->azimuth_angles();
+   const auto azimuthAngle  = [&azimuthAngles](std::uint32_t radial)
+   {
+      return units::degrees<float> {
+         (radial < azimuthAngles.size()) ?
+            azimuthAngles[radial] :
+            std::numeric_limits<float>::quiet_NaN()};
+   };
+
+   for (std::uint16_t radial = 0; radial < numRadials; ++radial)
+   {
+      const units::degrees<float> startAngle = azimuthAngle(radial);
+      if (std::isnan(startAngle.value()))
+      {
+         continue;
+      }
+
+      const units::degrees<float> nextAngle =
+         azimuthAngle((radial + 1) % numRadials);
+      if (!std::isnan(nextAngle.value()))
+      {
+         azimuthIndex->Add(radial, startAngle.value(), nextAngle.value());
+         continue;
+      }
+
+      // Next angle is not available, interpolate
+      const units::degrees<float> prevAngle =
+         azimuthAngle((radial >= 1) ? radial - 1 : numRadials - 1);
+      if (!std::isnan(prevAngle.value()))
+      {
+         const units::degrees<float> deltaAngle =
+            common::GetAngleDelta(startAngle, prevAngle);
+
+         azimuthIndex->Add(
+            radial, startAngle.value(), (startAngle + deltaAngle).value());
+      }
+   }
+
+   azimuthIndex->Build();
+
+   return azimuthIndex;
 }
 
 bool Level2ProductView::Impl::IsRadarDataIncomplete(
@@ -1249,10 +1073,8 @@ bool Level2ProductView::Impl::IsRadarDataIncomplete(
    // angles is greater than 2.5 degrees.
    constexpr units::degrees<float> kIncompleteDataAngleThreshold_ {2.5};
 
-   const units::degrees<float> firstAngle =
-      radarData->cbegin()->second->azimuth_angle();
-   const units::degrees<float> lastAngle =
-      radarData->crbegin()->second->azimuth_angle();
+   const units::degrees<float> firstAngle = radarData->front()->azimuth_angle();
+   const units::degrees<float> lastAngle  = radarData->back()->azimuth_angle();
    const units::degrees<float> angleDelta =
       common::GetAngleDelta(firstAngle, lastAngle);
 
@@ -1282,6 +1104,7 @@ std::optional<std::uint16_t>
 Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
 {
    auto radarData     = p->elevationScan_;
+   auto azimuthIndex  = p->azimuthIndex_;
    auto dataBlockType = p->dataBlockType_;
 
    if (radarData == nullptr)
@@ -1320,94 +1143,18 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
    }
 
    // Find Radial
-   std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->crbegin()->first + 1);
-
-   // Add an extra radial when incomplete data exists
-   if (Impl::IsRadarDataIncomplete(radarData))
-   {
-      ++numRadials;
-   }
-
-   // Limit radials
-   numRadials =
-      std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
-
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
-      {
-         bool hasNextAngle = false;
-         bool found        = false;
-
-         units::degrees<float> startAngle {};
-         units::degrees<float> nextAngle {};
-
-         auto radialData = radarData->find(i);
-         if (radialData != radarData->cend())
-         {
-            startAngle = radialData->second->azimuth_angle();
-
-            auto nextRadial = radarData->find((i + 1) % numRadials);
-            if (nextRadial != radarData->cend())
-            {
-               nextAngle    = nextRadial->second->azimuth_angle();
-               hasNextAngle = true;
-            }
-            else
-            {
-               // Next angle is not available, interpolate
-               auto prevRadial =
-                  radarData->find((i >= 1) ? i - 1 : numRadials - (1 - i));
-
-               if (prevRadial != radarData->cend())
-               {
-                  const units::degrees<float> prevAngle =
-                     prevRadial->second->azimuth_angle();
-
-                  const units::degrees<float> deltaAngle =
-                     common::GetAngleDelta(startAngle, prevAngle);
-
-                  nextAngle    = startAngle + deltaAngle;
-                  hasNextAngle = true;
-               }
-            }
-         }
-
-         if (hasNextAngle)
-         {
-            if (startAngle < nextAngle)
-            {
-               if (startAngle.value() <= azi1 && azi1 < nextAngle.value())
-               {
-                  found = true;
-               }
-            }
-            else
-            {
-               // If the bin crosses 0/360 degrees, special handling is needed
-               if (startAngle.value() <= azi1 || azi1 < nextAngle.value())
-               {
-                  found = true;
-               }
-            }
-         }
-
-         return found;
-      });
+   auto radial = (azimuthIndex != nullptr) ? azimuthIndex->Find(azi1) :
+                                             std::nullopt;
+   auto radialData = radial.has_value() ? radarData->radial(*radial) : nullptr;
 
-   if (radial == radials.end())
+   if (radialData == nullptr)
    {
       // No radial was found (not likely to happen without a gap in data)
       return std::nullopt;
    }
 
    // Compute gate interval
-   auto momentData = (*radarData)[*radial]->moment_data_block(dataBlockType);
+   auto momentData = radialData->moment_data_block(dataBlockType);
    const std::int32_t dataMomentInterval =
       momentData->data_moment_range_sample_interval_raw();
    const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
@@ -38,6 +38,8 @@ public:
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
+   std::shared_ptr<const util::PolarSweep> polar_sweep() const override;
+
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
    void SelectProduct(const std::string& productName) override;
@@ -47,8 +49,6 @@ public:
    std::vector<float>        GetElevationCuts() const override;
    std::tuple<const void*, std::size_t, std::size_t>
    GetMomentData() const override;
-   std::tuple<const void*, std::size_t, std::size_t>
-   GetCfpMomentData() const override;
 
    std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const override;
@@ -1,7 +1,11 @@
 #include <scwx/qt/view/level3_radial_view.hpp>
+#include <scwx/qt/settings/product_settings.hpp>
+#include <scwx/qt/util/azimuth_index.hpp>
+#include <scwx/qt/util/coordinate_cache.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
@@ -20,6 +24,12 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level3_radial_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static auto& sweepHistogram_ =
+   scwx::util::MetricsRegistry::Instance().GetHistogram("sweep.level3_radial");
+static auto& coordinatesHistogram_ =
+   scwx::util::MetricsRegistry::Instance().GetHistogram(
+      "sweep.level3_radial.coordinates");
+
 static constexpr std::uint32_t kMaxRadialGates_ =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
@@ -45,7 +55,10 @@ public:
 
    void ComputeCoordinates(
       const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
+      float                                                        elevation,
       bool smoothingEnabled);
+   static std::shared_ptr<const util::AzimuthIndex> BuildAzimuthIndex(
+      const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData);
 
    [[nodiscard]] inline std::uint8_t
    RemapDataMoment(std::uint8_t dataMoment) const;
@@ -62,6 +75,7 @@ public:
    bool showSmoothedRangeFolding_ {false};
 
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> lastRadialData_ {};
+   std::shared_ptr<const util::AzimuthIndex>             azimuthIndex_ {};
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
 
@@ -129,6 +143,7 @@ void Level3RadialView::ComputeSweep()
    logger_->trace("ComputeSweep()");
 
    boost::timer::cpu_timer timer;
+   const auto sweepStart = std::chrono::steady_clock::now();
 
    std::scoped_lock sweepLock(sweep_mutex());
 
@@ -258,6 +273,7 @@ void Level3RadialView::ComputeSweep()
    }
 
    p->lastRadialData_ = radialData;
+   p->azimuthIndex_   = Impl::BuildAzimuthIndex(radialData);
 
    // Valid number of radials is 1-720
    size_t radials = radialData->number_of_radials();
@@ -327,7 +343,10 @@ void Level3RadialView::ComputeSweep()
    std::uint16_t startRadial;
    if (radialSize == common::RadialSize::NonStandard)
    {
-      p->ComputeCoordinates(radialData, smoothingEnabled);
+      p->ComputeCoordinates(
+         radialData,
+         static_cast<float>(descriptionBlock->elevation().value()),
+         smoothingEnabled);
       startRadial = 0;
    }
    else
@@ -507,6 +526,9 @@ void Level3RadialView::ComputeSweep()
 
    UpdateColorTableLut();
 
+   // Only computed sweeps are recorded
+   sweepHistogram_.Record(std::chrono::steady_clock::now() - sweepStart);
+
    Q_EMIT SweepComputed();
 }
 
@@ -526,20 +548,24 @@ Level3RadialView::Impl::RemapDataMoment(std::uint8_t dataMoment) const
 
 void Level3RadialView::Impl::ComputeCoordinates(
    const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
+   float                                                        elevation,
    bool smoothingEnabled)
 {
    logger_->debug("ComputeCoordinates()");
 
    boost::timer::cpu_timer timer;
+   scwx::util::ScopedTimer coordinatesTimer {coordinatesHistogram_};
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+   auto        radarProductManager = self_->radar_product_manager();
+   auto        radarSite           = radarProductManager->radar_site();
+   const float gateSize            = radarProductManager->gate_size();
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   const common::Coordinate radarCoordinate {radarSite->latitude(),
+                                             radarSite->longitude()};
+   const bool               exactCoordinates =
+      settings::ProductSettings::Instance()
+         .exact_sweep_coordinates()
+         .GetValue();
 
    // Calculate azimuth coordinates
    timer.start();
@@ -548,7 +574,6 @@ void Level3RadialView::Impl::ComputeCoordinates(
    const std::uint16_t numRangeBins = radialData->number_of_range_bins();
 
    auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
 
    const float gateRangeOffset = (smoothingEnabled) ?
                                     // Center of the first gate is half the gate
@@ -558,50 +583,93 @@ void Level3RadialView::Impl::ComputeCoordinates(
                                     // size distance from the radar site
                                     1.0f;
 
+   std::vector<float> azimuths(numRadials);
+
+   for (std::uint16_t radial = 0; radial < numRadials; ++radial)
+   {
+      float angle = radialData->start_angle(radial);
+
+      if (smoothingEnabled)
+      {
+         static constexpr float kDeltaAngleFactor = 0.5f;
+         angle += radialData->delta_angle(radial) * kDeltaAngleFactor;
+      }
+
+      azimuths[radial] = angle;
+   }
+
+   // The coordinate table is keyed by the azimuth of each radial, so it is
+   // shared by every product with the same azimuths
+   const util::CoordinateCacheKey key {
+      radarSite->id(),
+      static_cast<std::int16_t>(std::lround(elevation * 10.0f)),
+      numRadials,
+      util::CoordinateCacheKey::HashAzimuths(azimuths),
+      numRangeBins,
+      gateSize,
+      smoothingEnabled,
+      exactCoordinates};
+
+   auto coordinateTable = util::CoordinateCache::Instance().GetOrCalculate(
+      key, radarCoordinate, azimuths, gateRangeOffset * gateSize);
+
+   // Copy cached coordinates into the rendering layout
    std::for_each(
       std::execution::par_unseq,
       radials.begin(),
       radials.end(),
       [&](std::uint32_t radial)
       {
-         float angle = radialData->start_angle(radial);
+         constexpr std::size_t kRadialSize = common::MAX_DATA_MOMENT_GATES * 2;
 
-         if (smoothingEnabled)
+         auto destination = std::span<float> {coordinates_}.subspan(
+            radial * kRadialSize,
+            std::min<std::size_t>(numRangeBins * 2u, kRadialSize));
+
+         if (coordinateTable != nullptr)
          {
-            static constexpr float kDeltaAngleFactor = 0.5f;
-            angle += radialData->delta_angle(radial) * kDeltaAngleFactor;
-         }
+            auto source = coordinateTable->radial(
+               static_cast<std::uint16_t>(radial));
+            source = source.first(destination.size());
 
-         std::for_each(
-            std::execution::par_unseq,
-            gates.begin(),
-            gates.end(),
-            [&](std::uint32_t gate)
-            {
-               const std::uint32_t radialGate =
-                  radial * common::MAX_DATA_MOMENT_GATES + gate;
-               const float range =
-                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-               const std::size_t offset = static_cast<size_t>(radialGate) * 2;
-
-               double latitude  = 0.0;
-               double longitude = 0.0;
-
-               geodesic.Direct(radarLatitude,
-                               radarLongitude,
-                               angle,
-                               range,
-                               latitude,
-                               longitude);
-
-               coordinates_[offset]     = static_cast<float>(latitude);
-               coordinates_[offset + 1] = static_cast<float>(longitude);
-            });
+            std::copy(source.begin(), source.end(), destination.begin());
+         }
+         else
+         {
+            util::GeographicLib::GetRadialCoordinates(
+               radarCoordinate,
+               units::degrees<double> {azimuths[radial]},
+               units::meters<double> {gateRangeOffset * gateSize},
+               units::meters<double> {gateSize},
+               destination,
+               exactCoordinates);
+         }
       });
+
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
 }
 
+std::shared_ptr<const util::AzimuthIndex>
+Level3RadialView::Impl::BuildAzimuthIndex(
+   const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData)
+{
+   auto azimuthIndex = std::make_shared<util::AzimuthIndex>();
+
+   const std::uint16_t numRadials = radialData->number_of_radials();
+
+   for (std::uint16_t radial = 0; radial < numRadials; ++radial)
+   {
+      azimuthIndex->Add(radial,
+                        radialData->start_angle(radial),
+                        radialData->start_angle((radial + 1) % numRadials));
+   }
+
+   azimuthIndex->Build();
+
+   return azimuthIndex;
+}
+
 std::optional<std::uint16_t>
 Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
 {
@@ -620,6 +688,7 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
 
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> radialData =
       p->lastRadialData_;
+   std::shared_ptr<const util::AzimuthIndex> azimuthIndex = p->azimuthIndex_;
    if (radialData == nullptr)
    {
       return std::nullopt;
@@ -668,39 +737,10 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
    }
 
    // Find Radial
-   const std::uint16_t numRadials = radialData->number_of_radials();
-   auto                radials = boost::irange<std::uint32_t>(0u, numRadials);
-
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
-      {
-         bool   found      = false;
-         double startAngle = radialData->start_angle(i);
-         double nextAngle  = radialData->start_angle((i + 1) % numRadials);
-
-         if (startAngle < nextAngle)
-         {
-            if (startAngle <= azi1 && azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-         else
-         {
-            // If the bin crosses 0/360 degrees, special handling is needed
-            if (startAngle <= azi1 || azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-
-         return found;
-      });
+   auto radial = (azimuthIndex != nullptr) ? azimuthIndex->Find(azi1) :
+                                             std::nullopt;
 
-   if (radial == radials.end())
+   if (!radial.has_value())
    {
       // No radial was found (not likely to happen without a gap in data)
       return std::nullopt;
@@ -2,6 +2,7 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
@@ -20,6 +21,9 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level3_raster_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static auto& sweepHistogram_ =
+   scwx::util::MetricsRegistry::Instance().GetHistogram("sweep.level3_raster");
+
 static constexpr uint16_t RANGE_FOLDED      = 1u;
 static constexpr uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr uint32_t VALUES_PER_VERTEX = 2u;
@@ -112,6 +116,7 @@ void Level3RasterView::ComputeSweep()
    logger_->trace("ComputeSweep()");
 
    boost::timer::cpu_timer timer;
+   const auto sweepStart = std::chrono::steady_clock::now();
 
    std::scoped_lock sweepLock(sweep_mutex());
 
@@ -433,6 +438,9 @@ void Level3RasterView::ComputeSweep()
 
    UpdateColorTableLut();
 
+   // Only computed sweeps are recorded
+   sweepHistogram_.Record(std::chrono::steady_clock::now() - sweepStart);
+
    Q_EMIT SweepComputed();
 }
 
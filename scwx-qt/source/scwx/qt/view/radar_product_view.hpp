@@ -5,6 +5,7 @@
 #include <scwx/common/products.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/types/map_types.hpp>
+#include <scwx/qt/util/polar_sweep.hpp>
 #include <scwx/wsr88d/wsr88d_types.hpp>
 
 #include <chrono>
@@ -47,6 +48,14 @@ public:
    virtual std::uint16_t                         vcp() const        = 0;
    virtual const std::vector<float>&             vertices() const   = 0;
 
+   /**
+    * Gets the polar sweep, for views which render the sweep from packed data
+    * moments instead of vertices.
+    *
+    * @return Polar sweep, or nullptr if the view renders vertices
+    */
+   virtual std::shared_ptr<const util::PolarSweep> polar_sweep() const;
+
    [[nodiscard]] std::shared_ptr<manager::RadarProductManager>
    radar_product_manager() const;
    [[nodiscard]] std::chrono::system_clock::time_point selected_time() const;
@@ -0,0 +1,75 @@
+#include <scwx/awips/text_product_file.hpp>
+#include <scwx/wxbench.hpp>
+
+namespace scwx
+{
+namespace awips
+{
+
+static void TextProductFileLoadFile(benchmark::State&  state,
+                                    const std::string& path)
+{
+   const std::string filename = bench::TestDataPath(path);
+
+   for (auto _ : state)
+   {
+      TextProductFile file;
+      benchmark::DoNotOptimize(file.LoadFile(filename));
+   }
+
+   bench::SetFileBytesProcessed(state, path);
+}
+
+static void TextProductFileLoadData(benchmark::State&  state,
+                                    const std::string& path)
+{
+   // Parse from memory, excluding file I/O
+   const std::string data = bench::ReadTestData(path);
+
+   for (auto _ : state)
+   {
+      std::istringstream is {data};
+      TextProductFile    file;
+      benchmark::DoNotOptimize(file.LoadData(is));
+   }
+
+   bench::SetBytesProcessed(state, data.size());
+}
+
+static void TextProductFileLoadDataView(benchmark::State&  state,
+                                        const std::string& path)
+{
+   // Parse from a contiguous buffer, without an intermediate stream
+   const std::string data = bench::ReadTestData(path);
+
+   for (auto _ : state)
+   {
+      TextProductFile file;
+      benchmark::DoNotOptimize(file.LoadData(std::string_view {data}));
+   }
+
+   bench::SetBytesProcessed(state, data.size());
+}
+
+BENCHMARK_CAPTURE(TextProductFileLoadFile,
+                  Warnings_20210604_21,
+                  "/warnings/warnings_20210604_21.txt");
+BENCHMARK_CAPTURE(TextProductFileLoadFile,
+                  Warnings_20210606_15,
+                  "/warnings/warnings_20210606_15.txt");
+BENCHMARK_CAPTURE(TextProductFileLoadFile,
+                  FTM,
+                  "/nexrad/level3/KLSX_NOUS63_FTMLSX_202201041404");
+
+BENCHMARK_CAPTURE(TextProductFileLoadData,
+                  Warnings_20210604_21,
+                  "/warnings/warnings_20210604_21.txt");
+BENCHMARK_CAPTURE(TextProductFileLoadDataView,
+                  Warnings_20210604_21,
+                  "/warnings/warnings_20210604_21.txt");
+BENCHMARK_CAPTURE(TextProductFileLoadDataView,
+                  Warnings_20210606_15,
+                  "/warnings/warnings_20210606_15.txt");
+
+} // namespace awips
+} // namespace scwx
@@ -1,5 +1,9 @@
 #include <scwx/awips/text_product_file.hpp>
 
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -56,5 +60,146 @@ TEST(TextProductFile, Update)
    EXPECT_EQ(file.message_count(), 13);
 }
 
+TEST(TextProductFile, LoadDataView)
+{
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) +
+                               "/warnings/warnings_20210604_21.txt"};
+
+   std::ifstream     f(filename, std::ios_base::in | std::ios_base::binary);
+   std::stringstream ss {};
+   ss << f.rdbuf();
+   std::string data = ss.str();
+
+   TextProductFile streamFile;
+   streamFile.LoadFile(filename);
+
+   TextProductFile viewFile;
+   EXPECT_EQ(viewFile.LoadData(std::string_view {data}), true);
+
+   // Messages do not reference the input data after parsing
+   std::fill(data.begin(), data.end(), '\0');
+   data.clear();
+   data.shrink_to_fit();
+
+   ASSERT_EQ(viewFile.message_count(), streamFile.message_count());
+   ASSERT_GT(viewFile.message_count(), 0);
+
+   for (std::size_t i = 0; i < viewFile.message_count(); ++i)
+   {
+      auto viewMessage   = viewFile.message(i);
+      auto streamMessage = streamFile.message(i);
+
+      EXPECT_EQ(viewMessage->message_content(),
+                streamMessage->message_content());
+      ASSERT_EQ(viewMessage->segment_count(), streamMessage->segment_count());
+
+      for (std::size_t s = 0; s < viewMessage->segment_count(); ++s)
+      {
+         auto viewSegment   = viewMessage->segment(s);
+         auto streamSegment = streamMessage->segment(s);
+
+         EXPECT_EQ(viewSegment->productContent_,
+                   streamSegment->productContent_);
+         ASSERT_EQ(viewSegment->header_.has_value(),
+                   streamSegment->header_.has_value());
+
+         if (viewSegment->header_.has_value())
+         {
+            EXPECT_EQ(viewSegment->header_->ugcString_,
+                      streamSegment->header_->ugcString_);
+            EXPECT_EQ(viewSegment->header_->issuanceDateTime_,
+                      streamSegment->header_->issuanceDateTime_);
+         }
+      }
+   }
+}
+
+TEST(TextProductFile, SharedSegmentBuffer)
+{
+   std::string data {"\x01\r\r\n"
+                     "123 \r\r\n"
+                     "WUUS53 KLSX 042130\r\r\n"
+                     "SVRLSX\r\r\n"
+                     "MOC071-099-042200-\r\r\n"
+                     "/O.NEW.KLSX.SV.W.0245.210604T2130Z-210604T2200Z/\r\r\n"
+                     "\r\r\n"
+                     "BULLETIN - IMMEDIATE BROADCAST REQUESTED\r\r\n"
+                     "Severe Thunderstorm Warning\r\r\n"
+                     "\r\r\n"
+                     "$$\r\r\n"
+                     "\x03"};
+
+   TextProductFile file;
+   EXPECT_EQ(file.LoadData(std::string_view {data}), true);
+   data.assign(data.size(), 'x');
+
+   ASSERT_EQ(file.message_count(), 1);
+   auto message = file.message(0);
+   ASSERT_EQ(message->segment_count(), 1);
+   auto segment = message->segment(0);
+
+   ASSERT_NE(segment->buffer_, nullptr);
+   ASSERT_EQ(segment->header_.has_value(), true);
+   EXPECT_EQ(segment->header_->buffer_, segment->buffer_);
+   ASSERT_EQ(segment->header_->ugcString_.size(), 1);
+   EXPECT_EQ(segment->header_->ugcString_[0], "MOC071-099-042200-");
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1);
+   EXPECT_EQ(segment->header_->vtecString_[0].buffer_, segment->buffer_);
+   EXPECT_EQ(segment->header_->vtecString_[0].pVtec_.event_tracking_number(),
+             245);
+   EXPECT_EQ(segment->productContent_,
+             (std::vector<std::string_view> {
+                "BULLETIN - IMMEDIATE BROADCAST REQUESTED",
+                "Severe Thunderstorm Warning",
+                "",
+                "$$"}));
+
+   // Segment text references the message buffer
+   const std::string_view buffer {*segment->buffer_};
+   EXPECT_GE(segment->productContent_[0].data(), buffer.data());
+   EXPECT_LE(segment->productContent_[0].data() +
+                segment->productContent_[0].size(),
+             buffer.data() + buffer.size());
+}
+
+TEST(TextProductFile, SharedFileBuffer)
+{
+   auto message = [](const std::string& time)
+   {
+      return "\x01\r\r\n"
+             "123 \r\r\n"
+             "WUUS53 KLSX " +
+             time +
+             "\r\r\n"
+             "SVRLSX\r\r\n"
+             "MOC071-099-042200-\r\r\n"
+             "\r\r\n"
+             "Severe Thunderstorm Warning\r\r\n"
+             "\r\r\n"
+             "$$\r\r\n"
+             "\x03";
+   };
+
+   const std::string data {message("042130") + message("042131")};
+   std::istringstream is {data};
+
+   TextProductFile file;
+   EXPECT_EQ(file.LoadData(is), true);
+
+   // Each message references a single buffer read from the stream
+   ASSERT_EQ(file.message_count(), 2);
+   auto segment0 = file.message(0)->segment(0);
+   auto segment1 = file.message(1)->segment(0);
+
+   ASSERT_NE(segment0->buffer_, nullptr);
+   EXPECT_EQ(segment0->buffer_, segment1->buffer_);
+   EXPECT_EQ(segment0->header_->ugcString_[0], "MOC071-099-042200-");
+   EXPECT_EQ(segment1->header_->ugcString_[0], "MOC071-099-042200-");
+   EXPECT_NE(file.message(0)->message_content().find("KLSX 042130"),
+             std::string::npos);
+   EXPECT_NE(file.message(1)->message_content().find("KLSX 042131"),
+             std::string::npos);
+}
+
 } // namespace awips
 } // namespace scwx
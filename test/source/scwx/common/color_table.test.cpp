@@ -1,5 +1,7 @@
 #include <scwx/common/color_table.hpp>
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -30,5 +32,28 @@ TEST(color_table, reflectivity)
    EXPECT_EQ(ct->Color(85), boost::gil::rgba8_pixel_t(128, 128, 128, 255));
 }
 
+TEST(color_table, interpolation)
+{
+   std::istringstream is {"Scale: 2\n"
+                          "Offset: 10\n"
+                          "Color: 10 0 0 0\n"
+                          "Color: 20 100 100 100 200 200 200\n"
+                          "SolidColor: 30 50 50 50\n"
+                          "Color: 40 255 255 255\n"};
+
+   std::shared_ptr<ColorTable> ct = ColorTable::Load(is);
+   ASSERT_TRUE(ct->IsValid());
+
+   // Values are scaled and offset before lookup
+   EXPECT_EQ(ct->Color(-10), boost::gil::rgba8_pixel_t(0, 0, 0, 255));
+   EXPECT_EQ(ct->Color(0), boost::gil::rgba8_pixel_t(0, 0, 0, 255));
+   EXPECT_EQ(ct->Color(2.5), boost::gil::rgba8_pixel_t(50, 50, 50, 255));
+   EXPECT_EQ(ct->Color(5), boost::gil::rgba8_pixel_t(100, 100, 100, 255));
+   EXPECT_EQ(ct->Color(7.5), boost::gil::rgba8_pixel_t(150, 150, 150, 255));
+   EXPECT_EQ(ct->Color(12), boost::gil::rgba8_pixel_t(50, 50, 50, 255));
+   EXPECT_EQ(ct->Color(15), boost::gil::rgba8_pixel_t(255, 255, 255, 255));
+   EXPECT_EQ(ct->Color(100), boost::gil::rgba8_pixel_t(255, 255, 255, 255));
+}
+
 } // namespace common
 } // namespace scwx
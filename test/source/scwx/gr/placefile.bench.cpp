@@ -0,0 +1,43 @@
+#include <scwx/gr/placefile.hpp>
+#include <scwx/wxbench.hpp>
+
+namespace scwx
+{
+namespace gr
+{
+
+static void PlacefileLoad(benchmark::State& state, const std::string& path)
+{
+   const std::string filename = bench::TestDataPath(path);
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(Placefile::Load(filename));
+   }
+
+   bench::SetFileBytesProcessed(state, path);
+}
+
+static void PlacefileLoadData(benchmark::State& state, const std::string& path)
+{
+   // Parse from memory, excluding file I/O
+   const std::string data = bench::ReadTestData(path);
+
+   for (auto _ : state)
+   {
+      std::istringstream is {data};
+      benchmark::DoNotOptimize(Placefile::Load(path, is));
+   }
+
+   bench::SetBytesProcessed(state, data.size());
+}
+
+BENCHMARK_CAPTURE(PlacefileLoad,
+                  OldExample,
+                  "/gr/placefiles/placefile-old-example.txt");
+BENCHMARK_CAPTURE(PlacefileLoadData,
+                  OldExample,
+                  "/gr/placefiles/placefile-old-example.txt");
+
+} // namespace gr
+} // namespace scwx
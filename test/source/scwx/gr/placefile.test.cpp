@@ -1,5 +1,7 @@
 #include <scwx/gr/placefile.hpp>
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -17,5 +19,112 @@ TEST(PlacefileTest, OldExample)
    EXPECT_EQ(true, true);
 }
 
+TEST(PlacefileTest, DrawStatements)
+{
+   std::istringstream is {"Title: Test Placefile ; comment\r\n"
+                          "Threshold: 100\n"
+                          "Color: 255 0 0\n"
+                          "Place: 35.0, -97.0, Place Text\n"
+                          "Object: 36.0, -98.0\n"
+                          "  Text: 1, 2, 1, \"Text, Comma\", \"Hover\\nText\"\n"
+                          "  Line: 2, 0\n"
+                          "    3, 4\n"
+                          "    bad\n"
+                          "  End:\n"
+                          "End:\n"
+                          "Color: 0 255 0\n"
+                          "Place: 37.0, -99.0\n"
+                          "Polygon:\n"
+                          "  30, -90\n"
+                          "  31, -90\n"
+                          "  31, -91\n"
+                          "  30, -90\n"
+                          "  32, -92\n"
+                          "End:\n"};
+
+   std::shared_ptr<Placefile> placefile = Placefile::Load("test", is);
+
+   ASSERT_NE(placefile, nullptr);
+   EXPECT_EQ(placefile->title(), "Test Placefile");
+
+   auto drawItems = placefile->GetDrawItems();
+   ASSERT_EQ(drawItems.size(), 4);
+
+   ASSERT_EQ(drawItems[0]->itemType_, Placefile::ItemType::Text);
+   auto place = std::static_pointer_cast<Placefile::TextDrawItem>(drawItems[0]);
+   EXPECT_DOUBLE_EQ(place->latitude_, 35.0);
+   EXPECT_DOUBLE_EQ(place->longitude_, -97.0);
+   EXPECT_DOUBLE_EQ(place->threshold_.value(), 100.0);
+   EXPECT_EQ(place->color_, (boost::gil::rgba8_pixel_t {255, 0, 0, 255}));
+   EXPECT_EQ(place->text_, "Place Text");
+
+   ASSERT_EQ(drawItems[1]->itemType_, Placefile::ItemType::Text);
+   auto text = std::static_pointer_cast<Placefile::TextDrawItem>(drawItems[1]);
+   EXPECT_DOUBLE_EQ(text->latitude_, 36.0);
+   EXPECT_DOUBLE_EQ(text->longitude_, -98.0);
+   EXPECT_DOUBLE_EQ(text->x_, 1.0);
+   EXPECT_DOUBLE_EQ(text->y_, 2.0);
+   EXPECT_EQ(text->text_, "Text, Comma");
+   EXPECT_EQ(text->hoverText_, "Hover\nText");
+
+   ASSERT_EQ(drawItems[2]->itemType_, Placefile::ItemType::Line);
+   auto line = std::static_pointer_cast<Placefile::LineDrawItem>(drawItems[2]);
+   EXPECT_DOUBLE_EQ(line->width_, 2.0);
+   ASSERT_EQ(line->elements_.size(), 1);
+   EXPECT_DOUBLE_EQ(line->elements_[0].latitude_, 36.0);
+   EXPECT_DOUBLE_EQ(line->elements_[0].x_, 3.0);
+   EXPECT_DOUBLE_EQ(line->elements_[0].y_, 4.0);
+
+   ASSERT_EQ(drawItems[3]->itemType_, Placefile::ItemType::Polygon);
+   auto polygon =
+      std::static_pointer_cast<Placefile::PolygonDrawItem>(drawItems[3]);
+   EXPECT_EQ(polygon->color_, (boost::gil::rgba8_pixel_t {0, 255, 0, 255}));
+   ASSERT_EQ(polygon->contours_.size(), 2);
+   EXPECT_EQ(polygon->contours_[0].size(), 4);
+   EXPECT_EQ(polygon->contours_[1].size(), 1);
+}
+
+TEST(PlacefileTest, DrawItemEquality)
+{
+   const std::string content {"Color: 255 0 0\n"
+                              "Line: 2, 0, \"Hover\"\n"
+                              "36.0, -98.0\n"
+                              "37.0, -99.0\n"
+                              "End:\n"
+                              "Text: 36.0, -98.0, 1, \"Text\"\n"};
+
+   std::istringstream is1 {content};
+   std::istringstream is2 {content};
+   std::istringstream is3 {"Color: 255 0 0\n"
+                           "Line: 2, 0, \"Hover\"\n"
+                           "36.0, -98.0\n"
+                           "37.0, -99.5\n"
+                           "End:\n"};
+
+   auto drawItems1 = Placefile::Load("test", is1)->GetDrawItems();
+   auto drawItems2 = Placefile::Load("test", is2)->GetDrawItems();
+   auto drawItems3 = Placefile::Load("test", is3)->GetDrawItems();
+
+   ASSERT_EQ(drawItems1.size(), 2);
+   ASSERT_EQ(drawItems2.size(), 2);
+   ASSERT_EQ(drawItems3.size(), 1);
+
+   auto line1 =
+      std::static_pointer_cast<Placefile::LineDrawItem>(drawItems1[0]);
+   auto line2 =
+      std::static_pointer_cast<Placefile::LineDrawItem>(drawItems2[0]);
+   auto line3 =
+      std::static_pointer_cast<Placefile::LineDrawItem>(drawItems3[0]);
+   auto text1 =
+      std::static_pointer_cast<Placefile::TextDrawItem>(drawItems1[1]);
+   auto text2 =
+      std::static_pointer_cast<Placefile::TextDrawItem>(drawItems2[1]);
+
+   // Draw items loaded from the same content compare equal
+   EXPECT_EQ(*line1, *line2);
+   EXPECT_EQ(*text1, *text2);
+   EXPECT_NE(*line1, *line3);
+}
+
 } // namespace gr
 } // namespace scwx
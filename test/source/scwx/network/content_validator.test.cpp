@@ -0,0 +1,109 @@
+#include <scwx/network/content_validator.hpp>
+
+#include <cpr/status_codes.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace network
+{
+
+static const std::string kContent_ {"Title: Test Placefile\n"
+                                    "RefreshSeconds: 60\n"
+                                    "Text: 38.7, -90.7, 1, \"Text\"\n"};
+
+static ::cpr::Response Response(long status, const std::string& text = {})
+{
+   ::cpr::Response response {};
+   response.status_code = status;
+   response.text        = text;
+   return response;
+}
+
+TEST(ContentValidator, ConditionalHeaders)
+{
+   ContentValidator validator {};
+
+   // No headers are added before content is accepted
+   ::cpr::Header header {};
+   validator.AddConditionalHeaders(header);
+   EXPECT_TRUE(header.empty());
+
+   ::cpr::Response response = Response(::cpr::status::HTTP_OK, kContent_);
+   response.header.insert_or_assign("ETag", "\"1\"");
+   response.header.insert_or_assign("Last-Modified",
+                                    "Sat, 11 Dec 2021 02:00:00 GMT");
+
+   ContentValidator::Validators validators {};
+   EXPECT_EQ(validator.CheckResponse(response, validators),
+             ContentValidator::Status::Modified);
+   validator.Accept(std::move(validators));
+
+   validator.AddConditionalHeaders(header);
+   EXPECT_EQ(header["If-None-Match"], "\"1\"");
+   EXPECT_EQ(header["If-Modified-Since"], "Sat, 11 Dec 2021 02:00:00 GMT");
+}
+
+TEST(ContentValidator, NotModifiedResponse)
+{
+   ContentValidator validator {};
+
+   ::cpr::Response response = Response(::cpr::status::HTTP_OK, kContent_);
+   response.header.insert_or_assign("ETag", "\"1\"");
+
+   ContentValidator::Validators validators {};
+   validator.CheckResponse(response, validators);
+   validator.Accept(std::move(validators));
+
+   // A 304 response is not modified, and has no content to check
+   ::cpr::Response notModified = Response(::cpr::status::HTTP_NOT_MODIFIED);
+   notModified.header.insert_or_assign("ETag", "\"2\"");
+
+   validators = {};
+   EXPECT_EQ(validator.CheckResponse(notModified, validators),
+             ContentValidator::Status::NotModified);
+
+   // Refreshing takes the updated validator from the server
+   validator.Refresh(std::move(validators));
+
+   ::cpr::Header header {};
+   validator.AddConditionalHeaders(header);
+   EXPECT_EQ(header["If-None-Match"], "\"2\"");
+
+   // A failed request is neither modified nor unmodified
+   validators = {};
+   EXPECT_EQ(validator.CheckResponse(
+                Response(::cpr::status::HTTP_NOT_FOUND), validators),
+             ContentValidator::Status::Error);
+   EXPECT_EQ(validator.CheckResponse(Response(0), validators),
+             ContentValidator::Status::Error);
+}
+
+TEST(ContentValidator, UnchangedDigest)
+{
+   ContentValidator validator {};
+
+   ContentValidator::Validators validators {};
+   EXPECT_EQ(validator.CheckContent(kContent_, validators),
+             ContentValidator::Status::Modified);
+   EXPECT_FALSE(validators.digest_.empty());
+   validator.Accept(std::move(validators));
+
+   // Identical content returned without validators is not modified
+   validators = {};
+   EXPECT_EQ(validator.CheckResponse(
+                Response(::cpr::status::HTTP_OK, kContent_), validators),
+             ContentValidator::Status::NotModified);
+
+   // Refreshing without validators keeps the digest
+   validator.Refresh(std::move(validators));
+
+   validators = {};
+   EXPECT_EQ(validator.CheckContent(kContent_, validators),
+             ContentValidator::Status::NotModified);
+   EXPECT_EQ(validator.CheckContent(kContent_ + "\n", validators),
+             ContentValidator::Status::Modified);
+}
+
+} // namespace network
+} // namespace scwx
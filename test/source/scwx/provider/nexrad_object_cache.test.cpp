@@ -0,0 +1,137 @@
+#include <scwx/provider/nexrad_object_cache.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string kBucket_ {"unidata-nexrad-level2"};
+
+class NexradObjectCacheTest : public ::testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+      directory_    = std::filesystem::temp_directory_path() /
+                   fmt::format("nexrad_object_cache_{}", testInfo->name());
+      std::filesystem::remove_all(directory_);
+   }
+
+   void TearDown() override { std::filesystem::remove_all(directory_); }
+
+   static std::string ReadFile(const std::string& path)
+   {
+      std::ifstream     f {path, std::ios_base::binary};
+      std::stringstream ss;
+      ss << f.rdbuf();
+      return ss.str();
+   }
+
+   std::filesystem::path directory_ {};
+};
+
+TEST_F(NexradObjectCacheTest, StoreAndFind)
+{
+   const std::string key  = "2022/04/21/KLSX/KLSX20220421_160055_V06";
+   const std::string data = "AR2V0006.";
+
+   NexradObjectCache cache {};
+   cache.SetMaxSize(1024);
+
+   EXPECT_FALSE(cache.Store(kBucket_, key, data));
+
+   cache.SetDirectory(directory_.string());
+
+   EXPECT_TRUE(cache.enabled());
+   EXPECT_EQ(cache.Find(kBucket_, key), std::nullopt);
+   EXPECT_TRUE(cache.Store(kBucket_, key, data));
+
+   auto path = cache.Find(kBucket_, key);
+   ASSERT_TRUE(path.has_value());
+   EXPECT_EQ(ReadFile(*path), data);
+   EXPECT_EQ(cache.size(), data.size());
+
+   cache.Remove(kBucket_, key);
+   EXPECT_EQ(cache.Find(kBucket_, key), std::nullopt);
+   EXPECT_FALSE(std::filesystem::exists(*path));
+}
+
+TEST_F(NexradObjectCacheTest, EvictLeastRecentlyUsed)
+{
+   const std::string data(100, 'x');
+
+   NexradObjectCache cache {};
+   cache.SetMaxSize(250);
+   cache.SetDirectory(directory_.string());
+
+   EXPECT_TRUE(cache.Store(kBucket_, "a", data));
+   EXPECT_TRUE(cache.Store(kBucket_, "b", data));
+   EXPECT_TRUE(cache.Find(kBucket_, "a").has_value());
+   EXPECT_TRUE(cache.Store(kBucket_, "c", data));
+
+   EXPECT_TRUE(cache.Find(kBucket_, "a").has_value());
+   EXPECT_FALSE(cache.Find(kBucket_, "b").has_value());
+   EXPECT_TRUE(cache.Find(kBucket_, "c").has_value());
+   EXPECT_EQ(cache.object_count(), 2u);
+
+   // Objects larger than the cache are not stored
+   EXPECT_FALSE(cache.Store(kBucket_, "d", std::string(300, 'x')));
+}
+
+TEST_F(NexradObjectCacheTest, PersistIndex)
+{
+   const std::string data(100, 'x');
+
+   {
+      NexradObjectCache cache {};
+      cache.SetMaxSize(1000);
+      cache.SetDirectory(directory_.string());
+
+      cache.Store(kBucket_, "a", data);
+      cache.Store(kBucket_, "b", data);
+      cache.Find(kBucket_, "a");
+   }
+
+   // The least recently used order is restored from the index
+   NexradObjectCache cache {};
+   cache.SetMaxSize(150);
+   cache.SetDirectory(directory_.string());
+
+   EXPECT_EQ(cache.object_count(), 1u);
+   EXPECT_TRUE(cache.Find(kBucket_, "a").has_value());
+   EXPECT_FALSE(cache.Find(kBucket_, "b").has_value());
+}
+
+TEST_F(NexradObjectCacheTest, SeedDirectory)
+{
+   const std::string key  = "KLSX/NXL2LSX20220421_160055";
+   const std::string data = "seeded";
+
+   std::filesystem::create_directories(directory_);
+   {
+      std::ofstream f {
+         directory_ / NexradObjectCache::GetObjectName(kBucket_, key),
+         std::ios_base::binary};
+      f << data;
+   }
+
+   NexradObjectCache cache {};
+   cache.SetMaxSize(1024);
+   cache.SetDirectory(directory_.string());
+
+   auto path = cache.Find(kBucket_, key);
+   ASSERT_TRUE(path.has_value());
+   EXPECT_EQ(ReadFile(*path), data);
+}
+
+} // namespace provider
+} // namespace scwx
@@ -1,5 +1,15 @@
 #include <scwx/provider/warnings_provider.hpp>
 
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -66,5 +76,261 @@ INSTANTIATE_TEST_SUITE_P(WarningsProvider,
                          WarningsProviderTest,
                          testing::Values(kDefaultUrl, kAlternateUrl));
 
+/**
+ * Local stand-in for a warnings server, serving a directory listing and
+ * warnings files with support for byte range requests.
+ */
+class LocalWarningsServer
+{
+public:
+   explicit LocalWarningsServer() :
+       acceptor_ {ioContext_, {boost::asio::ip::address_v4::loopback(), 0}}
+   {
+      Accept();
+      thread_ = std::thread {[this]() { ioContext_.run(); }};
+   }
+   ~LocalWarningsServer()
+   {
+      ioContext_.stop();
+      thread_.join();
+   }
+
+   LocalWarningsServer(const LocalWarningsServer&)            = delete;
+   LocalWarningsServer& operator=(const LocalWarningsServer&) = delete;
+
+   std::string url() const
+   {
+      return fmt::format("http://127.0.0.1:{}",
+                         acceptor_.local_endpoint().port());
+   }
+
+   void SetFile(const std::string& filename, const std::string& contents)
+   {
+      std::unique_lock lock {mutex_};
+      files_[filename] = contents;
+   }
+
+   void AppendFile(const std::string& filename, const std::string& contents)
+   {
+      std::unique_lock lock {mutex_};
+      files_[filename] += contents;
+   }
+
+   std::vector<std::string> ranges()
+   {
+      std::unique_lock lock {mutex_};
+      return ranges_;
+   }
+
+private:
+   void Accept()
+   {
+      acceptor_.async_accept(
+         [this](const boost::system::error_code& error,
+                boost::asio::ip::tcp::socket    socket)
+         {
+            if (!error)
+            {
+               HandleRequest(socket);
+            }
+            Accept();
+         });
+   }
+
+   void HandleRequest(boost::asio::ip::tcp::socket& socket)
+   {
+      boost::system::error_code error;
+      boost::asio::streambuf    buffer;
+      boost::asio::read_until(socket, buffer, "\r\n\r\n", error);
+      if (error)
+      {
+         return;
+      }
+
+      std::istream request {&buffer};
+      std::string  method;
+      std::string  target;
+      std::string  line;
+      std::string  range;
+
+      request >> method >> target;
+      std::getline(request, line);
+      while (std::getline(request, line) && line != "\r")
+      {
+         if (line.starts_with("Range: bytes="))
+         {
+            range = line.substr(13, line.find('-') - 13);
+         }
+      }
+
+      std::unique_lock lock {mutex_};
+
+      std::string status  = "200 OK";
+      std::string headers = "";
+      std::string body    = "";
+
+      if (target == "/")
+      {
+         // Apache style directory listing
+         body = "<html><body><table>\n";
+         for (auto& file : files_)
+         {
+            body += fmt::format("<tr><td><a href=\"{0}\">{0}</a></td>"
+                                "<td>2024-05-27 17:57  </td>"
+                                "<td>{1}</td></tr>\n",
+                                file.first,
+                                file.second.size());
+         }
+         body += "</table></body></html>\n";
+      }
+      else if (auto it = files_.find(target.substr(1)); it != files_.end())
+      {
+         const std::string& contents = it->second;
+         ranges_.push_back(range);
+
+         if (range.empty())
+         {
+            body = contents;
+         }
+         else if (std::stoull(range) < contents.size())
+         {
+            const std::size_t start = std::stoull(range);
+            status                  = "206 Partial Content";
+            headers = fmt::format("Content-Range: bytes {}-{}/{}\r\n",
+                                  start,
+                                  contents.size() - 1,
+                                  contents.size());
+            body    = contents.substr(start);
+         }
+         else
+         {
+            status = "416 Range Not Satisfiable";
+            headers =
+               fmt::format("Content-Range: bytes */{}\r\n", contents.size());
+         }
+      }
+      else
+      {
+         status = "404 Not Found";
+      }
+
+      const std::string response =
+         fmt::format("HTTP/1.1 {}\r\n"
+                     "{}"
+                     "Content-Length: {}\r\n"
+                     "Connection: close\r\n"
+                     "\r\n"
+                     "{}",
+                     status,
+                     headers,
+                     body.size(),
+                     body);
+
+      boost::asio::write(socket, boost::asio::buffer(response), error);
+   }
+
+   boost::asio::io_context        ioContext_ {};
+   boost::asio::ip::tcp::acceptor acceptor_;
+   std::thread                    thread_ {};
+
+   std::mutex                         mutex_ {};
+   std::map<std::string, std::string> files_ {};
+   std::vector<std::string>           ranges_ {};
+};
+
+static const std::string kWarningsFile_ {"warnings_20240527_17.txt"};
+
+static std::string TextProduct(int minute)
+{
+   return fmt::format("\x01\r\r\n"
+                      "{0:03} \r\r\n"
+                      "WUUS53 KLSX 2717{0:02}\r\r\n"
+                      "SVRLSX\r\r\n"
+                      "\r\r\n"
+                      "TEST PRODUCT {0}\r\r\n"
+                      "\r\r\n"
+                      "$$\r\r\n"
+                      "\x03",
+                      minute);
+}
+
+TEST(WarningsProviderLocalTest, LoadAppendedData)
+{
+   LocalWarningsServer server {};
+
+   const std::string product3 = TextProduct(3);
+   const std::size_t split    = product3.size() / 2;
+
+   // The third product is partially written
+   const std::string initialData =
+      TextProduct(1) + TextProduct(2) + product3.substr(0, split);
+   server.SetFile(kWarningsFile_, initialData);
+
+   WarningsProvider provider(server.url());
+
+   auto [newObjects, totalObjects] = provider.ListFiles();
+   auto updatedFiles               = provider.LoadUpdatedFiles();
+
+   EXPECT_EQ(newObjects, 1);
+   EXPECT_EQ(totalObjects, 1);
+   ASSERT_EQ(updatedFiles.size(), 1);
+   EXPECT_EQ(updatedFiles[0]->message_count(), 2);
+
+   // Complete the third product, and append a fourth
+   server.AppendFile(kWarningsFile_, product3.substr(split) + TextProduct(4));
+
+   auto [newObjects2, totalObjects2] = provider.ListFiles();
+   auto updatedFiles2                = provider.LoadUpdatedFiles();
+
+   EXPECT_EQ(newObjects2, 1);
+   ASSERT_EQ(updatedFiles2.size(), 1);
+   ASSERT_EQ(updatedFiles2[0]->message_count(), 2);
+   EXPECT_EQ(updatedFiles2[0]->message(0)->wmo_header()->date_time(), "271703");
+   EXPECT_EQ(updatedFiles2[0]->message(1)->wmo_header()->date_time(), "271704");
+
+   // Only data following the complete products was requested
+   const std::size_t offset = initialData.size() - split;
+   EXPECT_EQ(server.ranges(),
+             (std::vector<std::string> {"", std::to_string(offset)}));
+
+   // No data has been appended
+   auto [newObjects3, totalObjects3] = provider.ListFiles();
+   auto updatedFiles3                = provider.LoadUpdatedFiles();
+
+   EXPECT_EQ(newObjects3, 0);
+   EXPECT_EQ(updatedFiles3.size(), 0);
+}
+
+TEST(WarningsProviderLocalTest, ReloadTruncatedFile)
+{
+   LocalWarningsServer server {};
+
+   server.SetFile(kWarningsFile_, TextProduct(1) + TextProduct(2));
+
+   WarningsProvider provider(server.url());
+
+   provider.ListFiles();
+   auto updatedFiles = provider.LoadUpdatedFiles();
+
+   ASSERT_EQ(updatedFiles.size(), 1);
+   EXPECT_EQ(updatedFiles[0]->message_count(), 2);
+
+   // Replace the file with a shorter file
+   server.SetFile(kWarningsFile_, TextProduct(5));
+
+   auto [newObjects2, totalObjects2] = provider.ListFiles();
+   auto updatedFiles2                = provider.LoadUpdatedFiles();
+
+   // The requested range is not satisfiable, and the file must be reloaded
+   EXPECT_EQ(newObjects2, 1);
+   EXPECT_EQ(updatedFiles2.size(), 0);
+
+   auto updatedFiles3 = provider.LoadUpdatedFiles();
+
+   ASSERT_EQ(updatedFiles3.size(), 1);
+   ASSERT_EQ(updatedFiles3[0]->message_count(), 1);
+   EXPECT_EQ(updatedFiles3[0]->message(0)->wmo_header()->date_time(), "271705");
+}
+
 } // namespace provider
 } // namespace scwx
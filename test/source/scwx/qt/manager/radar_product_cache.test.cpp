@@ -0,0 +1,171 @@
+#include <scwx/qt/manager/radar_product_cache.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+class TestNexradFile : public wsr88d::NexradFile
+{
+public:
+   explicit TestNexradFile(std::size_t residentBytes) :
+       residentBytes_ {residentBytes}
+   {
+   }
+
+   std::size_t resident_bytes() const override { return residentBytes_; }
+   void set_resident_bytes(std::size_t bytes) { residentBytes_ = bytes; }
+
+   bool LoadFile(const std::string&) override { return true; }
+   bool LoadData(std::istream&) override { return true; }
+
+private:
+   std::size_t residentBytes_;
+};
+
+static std::shared_ptr<types::RadarProductRecord>
+CreateRecord(std::size_t residentBytes)
+{
+   return types::RadarProductRecord::Create(
+      std::make_shared<TestNexradFile>(residentBytes));
+}
+
+TEST(RadarProductCache, BudgetEviction)
+{
+   RadarProductCache cache {};
+   cache.SetBudget(250u);
+
+   auto record1 = CreateRecord(100u);
+   auto record2 = CreateRecord(100u);
+   auto record3 = CreateRecord(100u);
+
+   cache.Touch("KLSX", "N0B", record1, 10u);
+   cache.Touch("KLSX", "N0G", record2, 10u);
+
+   // Touching the first record makes the second least recently used
+   cache.Touch("KLSX", "N0B", record1, 10u);
+   cache.Touch("KLSX", "N0Q", record3, 10u);
+
+   RadarProductCache::Statistics statistics = cache.statistics();
+   EXPECT_EQ(statistics.recordCount_, 2u);
+   EXPECT_EQ(statistics.residentBytes_, 200u);
+   EXPECT_EQ(statistics.evictions_, 1u);
+   EXPECT_EQ(statistics.budget_, 250u);
+
+   // The second record was evicted, and is added again as the most recent
+   cache.Touch("KLSX", "N0G", record2, 10u);
+
+   statistics = cache.statistics();
+   EXPECT_EQ(statistics.recordCount_, 2u);
+   EXPECT_EQ(statistics.evictions_, 2u);
+
+   // Reducing the budget evicts all but the most recently used record, even
+   // if it is over budget
+   cache.SetBudget(50u);
+
+   statistics = cache.statistics();
+   EXPECT_EQ(statistics.recordCount_, 1u);
+   EXPECT_EQ(statistics.residentBytes_, 100u);
+   EXPECT_EQ(statistics.evictions_, 3u);
+}
+
+TEST(RadarProductCache, ProductLimit)
+{
+   RadarProductCache cache {};
+   cache.SetBudget(1000u);
+
+   auto record1 = CreateRecord(10u);
+   auto record2 = CreateRecord(10u);
+   auto record3 = CreateRecord(10u);
+   auto other   = CreateRecord(10u);
+
+   cache.Touch("KLSX", "N0B", record1, 2u);
+   cache.Touch("KLSX", "N0G", other, 2u);
+   cache.Touch("KLSX", "N0B", record2, 2u);
+   cache.Touch("KLSX", "N0B", record3, 2u);
+
+   // Only the oldest record of the product is evicted
+   RadarProductCache::Statistics statistics = cache.statistics();
+   EXPECT_EQ(statistics.recordCount_, 3u);
+   EXPECT_EQ(statistics.evictions_, 1u);
+
+   // Records of another radar are counted separately
+   cache.Touch("KEAX", "N0B", CreateRecord(10u), 2u);
+   EXPECT_EQ(cache.statistics().recordCount_, 4u);
+}
+
+TEST(RadarProductCache, Erase)
+{
+   RadarProductCache cache {};
+   cache.SetBudget(1000u);
+
+   auto record1 = CreateRecord(10u);
+   auto record2 = CreateRecord(20u);
+   auto record3 = CreateRecord(40u);
+
+   cache.Touch("KLSX", "N0B", record1, 10u);
+   cache.Touch("KLSX", "N0G", record2, 10u);
+   cache.Touch("KEAX", "N0B", record3, 10u);
+
+   cache.Erase(record2);
+   EXPECT_EQ(cache.statistics().residentBytes_, 50u);
+
+   cache.Erase("KLSX");
+
+   // Erased records are not counted as evictions
+   RadarProductCache::Statistics statistics = cache.statistics();
+   EXPECT_EQ(statistics.recordCount_, 1u);
+   EXPECT_EQ(statistics.residentBytes_, 40u);
+   EXPECT_EQ(statistics.evictions_, 0u);
+
+   // Erasing a record not in the cache has no effect
+   cache.Erase(record1);
+   EXPECT_EQ(cache.statistics().recordCount_, 1u);
+}
+
+TEST(RadarProductCache, MeasuredOnTouch)
+{
+   RadarProductCache cache {};
+   cache.SetBudget(250u);
+
+   auto file1   = std::make_shared<TestNexradFile>(100u);
+   auto record1 = types::RadarProductRecord::Create(file1);
+   auto record2 = CreateRecord(100u);
+
+   cache.Touch("KLSX", "", record1, 10u);
+   cache.Touch("KLSX", "N0B", record2, 10u);
+
+   // A growing record is measured again when it is touched
+   file1->set_resident_bytes(200u);
+   EXPECT_EQ(cache.statistics().residentBytes_, 200u);
+
+   cache.Touch("KLSX", "", record1, 10u);
+
+   RadarProductCache::Statistics statistics = cache.statistics();
+   EXPECT_EQ(statistics.recordCount_, 1u);
+   EXPECT_EQ(statistics.residentBytes_, 200u);
+   EXPECT_EQ(statistics.evictions_, 1u);
+}
+
+TEST(RadarProductCache, HitsAndMisses)
+{
+   RadarProductCache cache {};
+
+   cache.RecordHit();
+   cache.RecordHit();
+   cache.RecordMiss();
+
+   RadarProductCache::Statistics statistics = cache.statistics();
+   EXPECT_EQ(statistics.hits_, 2u);
+   EXPECT_EQ(statistics.misses_, 1u);
+   EXPECT_EQ(statistics.evictions_, 0u);
+   EXPECT_EQ(statistics.recordCount_, 0u);
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,194 @@
+#include <scwx/qt/types/text_event_store.hpp>
+#include <scwx/awips/text_product_file.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+static std::shared_ptr<awips::TextProductMessage>
+TextProduct(const std::string& wmoTime, const std::string& vtec)
+{
+   const std::string data = fmt::format("\x01\r\r\n"
+                                        "123 \r\r\n"
+                                        "WUUS53 KLSX {}\r\r\n"
+                                        "SVRLSX\r\r\n"
+                                        "MOC071-099-042200-\r\r\n"
+                                        "{}\r\r\n"
+                                        "\r\r\n"
+                                        "TEST PRODUCT\r\r\n"
+                                        "\r\r\n"
+                                        "$$\r\r\n"
+                                        "\x03",
+                                        wmoTime,
+                                        vtec);
+
+   awips::TextProductFile file;
+   file.LoadData(std::string_view {data});
+
+   return (file.message_count() > 0) ? file.message(0) : nullptr;
+}
+
+static TextEventKey
+GetKey(const std::shared_ptr<awips::TextProductMessage>& message)
+{
+   return TextEventKey {message->segment(0)->header_->vtecString_[0].pVtec_};
+}
+
+static std::chrono::system_clock::time_point
+TimePoint(std::chrono::hours hour, std::chrono::minutes minute)
+{
+   using namespace std::chrono;
+   return sys_days {2021y / June / 4d} + hour + minute;
+}
+
+TEST(TextEventStore, AddMessages)
+{
+   auto message1 = TextProduct(
+      "042130", "/O.NEW.KLSX.SV.W.0245.210604T2130Z-210604T2200Z/");
+   auto message2 = TextProduct(
+      "042145", "/O.CON.KLSX.SV.W.0245.000000T0000Z-210604T2200Z/");
+   auto duplicate = TextProduct(
+      "042130", "/O.NEW.KLSX.SV.W.0245.210604T2130Z-210604T2200Z/");
+
+   ASSERT_NE(message1, nullptr);
+   ASSERT_NE(message2, nullptr);
+   ASSERT_NE(duplicate, nullptr);
+
+   const TextEventKey key = GetKey(message1);
+
+   TextEventStore store {};
+   EXPECT_EQ(store.event_count(), 0u);
+   EXPECT_EQ(store.message_count(key), 0u);
+   EXPECT_TRUE(store.message_list(key)->empty());
+   EXPECT_EQ(store.latest_message(key), nullptr);
+
+   EXPECT_EQ(store.Add(key, message1), std::optional<std::size_t> {0u});
+
+   // A snapshot is not modified by later messages
+   auto snapshot = store.message_list(key);
+
+   EXPECT_EQ(store.Add(key, message2), std::optional<std::size_t> {1u});
+   EXPECT_EQ(store.Add(key, duplicate), std::nullopt);
+
+   EXPECT_EQ(store.version(), 2u);
+   EXPECT_EQ(store.event_count(), 1u);
+   EXPECT_EQ(store.message_count(key), 2u);
+   EXPECT_EQ(snapshot->size(), 1u);
+
+   EXPECT_EQ(store.message(key, 0), message1);
+   EXPECT_EQ(store.message(key, 1), message2);
+   EXPECT_EQ(store.message(key, 2), nullptr);
+   EXPECT_EQ(store.latest_message(key), message2);
+}
+
+TEST(TextEventStore, GetEvents)
+{
+   auto severe = TextProduct(
+      "042130", "/O.NEW.KLSX.SV.W.0245.210604T2130Z-210604T2200Z/");
+   auto tornado = TextProduct(
+      "042130", "/O.NEW.KLSX.TO.W.0100.210604T2130Z-210604T2200Z/");
+   auto otherOffice = TextProduct(
+      "042130", "/O.NEW.KEAX.SV.W.0050.210604T2130Z-210604T2200Z/");
+   auto continued = TextProduct(
+      "042145", "/O.CON.KLSX.SV.W.0245.000000T0000Z-210604T2200Z/");
+
+   TextEventStore store {};
+   store.Add(GetKey(severe), severe);
+   store.Add(GetKey(tornado), tornado);
+   store.Add(GetKey(otherOffice), otherOffice);
+
+   // Later messages do not add the event to an index again
+   store.Add(GetKey(continued), continued);
+
+   EXPECT_EQ(store.GetEvents(awips::Phenomenon::SevereThunderstorm),
+             (std::vector<TextEventKey> {GetKey(severe), GetKey(otherOffice)}));
+   EXPECT_EQ(store.GetEvents(awips::Phenomenon::Tornado),
+             (std::vector<TextEventKey> {GetKey(tornado)}));
+   EXPECT_TRUE(store.GetEvents(awips::Phenomenon::FlashFlood).empty());
+   EXPECT_EQ(store.GetEvents("KLSX"),
+             (std::vector<TextEventKey> {GetKey(severe), GetKey(tornado)}));
+   EXPECT_EQ(store.GetEvents("KEAX"),
+             (std::vector<TextEventKey> {GetKey(otherOffice)}));
+   EXPECT_TRUE(store.GetEvents("KSGF").empty());
+}
+
+TEST(TextEventStore, GetActiveEvents)
+{
+   using namespace std::chrono_literals;
+
+   auto event1 = TextProduct(
+      "042130", "/O.NEW.KLSX.SV.W.0245.210604T2130Z-210604T2200Z/");
+   auto event2 = TextProduct(
+      "042200", "/O.NEW.KLSX.SV.W.0246.210604T2200Z-210604T2300Z/");
+   auto extended = TextProduct(
+      "042150", "/O.EXT.KLSX.SV.W.0245.000000T0000Z-210604T2230Z/");
+
+   const TextEventKey key1 = GetKey(event1);
+   const TextEventKey key2 = GetKey(event2);
+
+   TextEventStore store {};
+   store.Add(key1, event1);
+   store.Add(key2, event2);
+
+   const auto at2140 = TimePoint(21h, 40min);
+   const auto at2150 = TimePoint(21h, 50min);
+   const auto at2205 = TimePoint(22h, 5min);
+   const auto at2210 = TimePoint(22h, 10min);
+   const auto at2305 = TimePoint(23h, 5min);
+   const auto at2310 = TimePoint(23h, 10min);
+
+   EXPECT_EQ(store.GetActiveEvents(at2140, at2150),
+             (std::vector<TextEventKey> {key1}));
+   EXPECT_EQ(store.GetActiveEvents(at2205, at2210),
+             (std::vector<TextEventKey> {key2}));
+   EXPECT_TRUE(store.GetActiveEvents(at2305, at2310).empty());
+
+   // Extending an event updates its end time
+   store.Add(key1, extended);
+
+   EXPECT_EQ(store.GetActiveEvents(at2205, at2210),
+             (std::vector<TextEventKey> {key1, key2}));
+}
+
+TEST(TextEventStore, CanceledEvent)
+{
+   using namespace std::chrono_literals;
+
+   auto event = TextProduct(
+      "042130", "/O.NEW.KLSX.SV.W.0245.210604T2130Z-210604T2200Z/");
+   auto canceled = TextProduct(
+      "042145", "/O.CAN.KLSX.SV.W.0245.000000T0000Z-210604T2200Z/");
+
+   const TextEventKey key = GetKey(event);
+
+   TextEventStore store {};
+   EXPECT_EQ(store.event_end(key), std::nullopt);
+   store.Add(key, event);
+   EXPECT_EQ(store.event_end(key), TimePoint(22h, 0min));
+
+   const auto at2140 = TimePoint(21h, 40min);
+   const auto at2144 = TimePoint(21h, 44min);
+   const auto at2150 = TimePoint(21h, 50min);
+   const auto at2155 = TimePoint(21h, 55min);
+
+   EXPECT_EQ(store.GetActiveEvents(at2150, at2155),
+             (std::vector<TextEventKey> {key}));
+
+   // A cancelled event ends when the cancellation is issued
+   store.Add(key, canceled);
+   EXPECT_EQ(store.event_end(key), TimePoint(21h, 45min));
+
+   EXPECT_EQ(store.GetActiveEvents(at2140, at2144),
+             (std::vector<TextEventKey> {key}));
+   EXPECT_TRUE(store.GetActiveEvents(at2150, at2155).empty());
+}
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
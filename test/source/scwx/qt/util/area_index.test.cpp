@@ -0,0 +1,80 @@
+#include <scwx/qt/util/area_index.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static std::shared_ptr<const PreparedArea>
+CreateArea(double latitude, double longitude, double size)
+{
+   return std::make_shared<const PreparedArea>(
+      std::vector<common::Coordinate> {
+         common::Coordinate(latitude, longitude),
+         common::Coordinate(latitude, longitude + size),
+         common::Coordinate(latitude + size, longitude + size),
+         common::Coordinate(latitude + size, longitude)});
+}
+
+TEST(AreaIndex, Query)
+{
+   AreaIndex index {};
+   EXPECT_TRUE(index.empty());
+
+   index.Build({CreateArea(37.0, -92.0, 0.5),
+                CreateArea(37.0, -91.0, 0.5),
+                CreateArea(36.0, -92.0, 2.0),
+                CreateArea(52.0, 179.5, 1.0)});
+
+   EXPECT_EQ(index.size(), 4u);
+
+   const std::vector<std::size_t> expected0 {0u, 2u};
+   const std::vector<std::size_t> expected1 {1u, 2u};
+   const std::vector<std::size_t> expected2 {3u};
+
+   EXPECT_EQ(index.Query({37.25, -91.75}, units::length::meters<double>(0)),
+             expected0);
+   EXPECT_EQ(index.Query({37.25, -90.75}, units::length::meters<double>(0)),
+             expected1);
+   EXPECT_TRUE(
+      index.Query({40.0, -91.0}, units::length::meters<double>(0)).empty());
+
+   // The point is outside of areas 0 and 2, but within range
+   EXPECT_TRUE(
+      index.Query({37.25, -92.1}, units::length::meters<double>(0)).empty());
+   EXPECT_EQ(index.Query({37.25, -92.1}, units::length::meters<double>(20e3)),
+             expected0);
+
+   // Area 3 crosses the antimeridian, and is found from either side
+   EXPECT_EQ(index.Query({52.5, 179.9}, units::length::meters<double>(0)),
+             expected2);
+   EXPECT_EQ(index.Query({52.5, -179.9}, units::length::meters<double>(0)),
+             expected2);
+   EXPECT_EQ(index.Query({52.5, -179.0}, units::length::meters<double>(50e3)),
+             expected2);
+}
+
+TEST(AreaIndex, Rebuild)
+{
+   AreaIndex index {};
+   index.Build({CreateArea(37.0, -92.0, 0.5)});
+   index.Build({nullptr, CreateArea(37.0, -92.0, 0.5)});
+
+   EXPECT_EQ(index.size(), 2u);
+   EXPECT_EQ(index.Query({37.25, -91.75}, units::length::meters<double>(0)),
+             std::vector<std::size_t> {1u});
+
+   index.Clear();
+
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(
+      index.Query({37.25, -91.75}, units::length::meters<double>(0)).empty());
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
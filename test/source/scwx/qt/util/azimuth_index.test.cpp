@@ -0,0 +1,60 @@
+#include <scwx/qt/util/azimuth_index.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+TEST(AzimuthIndex, FindHalfDegreeRadials)
+{
+   AzimuthIndex index {};
+
+   // Radials offset from 0 degrees, so the last radial crosses 0/360 degrees
+   for (std::uint16_t radial = 0; radial < 720; ++radial)
+   {
+      const float startAngle = 0.25f + radial * 0.5f;
+      index.Add(radial, startAngle, startAngle + 0.5f);
+   }
+   index.Build();
+
+   EXPECT_EQ(index.Find(0.25), 0);
+   EXPECT_EQ(index.Find(0.74), 0);
+   EXPECT_EQ(index.Find(0.75), 1);
+   EXPECT_EQ(index.Find(180.3), 360);
+   EXPECT_EQ(index.Find(359.9), 719);
+   EXPECT_EQ(index.Find(0.1), 719);
+   EXPECT_EQ(index.Find(-0.1), 719);
+}
+
+TEST(AzimuthIndex, FindWithGap)
+{
+   AzimuthIndex index {};
+
+   index.Add(2, 10.0f, 11.0f);
+   index.Add(0, 8.0f, 9.0f);
+   index.Add(3, 11.0f, 12.0f);
+   index.Build();
+
+   EXPECT_EQ(index.Find(8.5), 0);
+   EXPECT_EQ(index.Find(9.5), std::nullopt);
+   EXPECT_EQ(index.Find(10.0), 2);
+   EXPECT_EQ(index.Find(11.99), 3);
+   EXPECT_EQ(index.Find(12.0), std::nullopt);
+   EXPECT_EQ(index.Find(270.0), std::nullopt);
+}
+
+TEST(AzimuthIndex, FindEmpty)
+{
+   AzimuthIndex index {};
+   index.Build();
+
+   EXPECT_EQ(index.Find(45.0), std::nullopt);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,204 @@
+#include <scwx/qt/util/coordinate_cache.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const common::Coordinate kRadarSite_ {38.6989, -90.6828}; // KLSX
+
+static constexpr std::uint16_t kNumRadials_   = 720u;
+static constexpr std::uint16_t kNumRangeBins_ = 1840u;
+static constexpr float         kGateSize_     = 250.0f;
+
+// Half degree radials, each varying slightly from an even spacing
+static std::vector<float> Azimuths()
+{
+   std::vector<float> azimuths {};
+   for (int radial = 0; radial < kNumRadials_; ++radial)
+   {
+      azimuths.push_back(std::fmod(
+         123.27f + radial * 0.5f + ((radial % 7) - 3) * 0.004f, 360.0f));
+   }
+   return azimuths;
+}
+
+static CoordinateCacheKey Key(std::span<const float> azimuths)
+{
+   return {"KLSX",
+           5,
+           static_cast<std::uint16_t>(azimuths.size()),
+           CoordinateCacheKey::HashAzimuths(azimuths),
+           kNumRangeBins_,
+           kGateSize_,
+           true,
+           false};
+}
+
+// Checks the coordinates of a table against coordinates calculated without
+// the cache, for every 5th radial and 23rd gate
+static void ExpectUncachedCoordinates(const CoordinateTable& table,
+                                      std::span<const float> azimuths)
+{
+   const auto& geodesic = GeographicLib::DefaultGeodesic();
+
+   double maxError = 0.0;
+
+   for (std::uint16_t radial = 0; radial < azimuths.size(); radial += 5)
+   {
+      std::vector<float> uncached(kNumRangeBins_ * 2u);
+      GeographicLib::GetRadialCoordinates(
+         kRadarSite_,
+         units::degrees<double> {azimuths[radial]},
+         units::meters<double> {0.5 * kGateSize_},
+         units::meters<double> {kGateSize_},
+         std::span<float> {uncached});
+
+      auto cached = table.radial(radial);
+      ASSERT_EQ(cached.size(), uncached.size());
+
+      for (std::size_t gate = 0; gate < kNumRangeBins_; gate += 23)
+      {
+         double error;
+         geodesic.Inverse(uncached[gate * 2],
+                          uncached[gate * 2 + 1],
+                          cached[gate * 2],
+                          cached[gate * 2 + 1],
+                          error);
+         maxError = std::max(maxError, error);
+      }
+   }
+
+   EXPECT_LT(maxError, GeographicLib::kRadialCoordinatesMaxError.value());
+}
+
+TEST(CoordinateCacheKey, HashAzimuths)
+{
+   std::vector<float> azimuths = Azimuths();
+   const std::uint64_t hash    = CoordinateCacheKey::HashAzimuths(azimuths);
+
+   EXPECT_EQ(CoordinateCacheKey::HashAzimuths(Azimuths()), hash);
+
+   // A change in any azimuth changes the hash
+   azimuths[100] += 0.01f;
+   EXPECT_NE(CoordinateCacheKey::HashAzimuths(azimuths), hash);
+
+   // Missing radials hash the same, regardless of the NaN
+   azimuths[100] = std::numeric_limits<float>::quiet_NaN();
+   const std::uint64_t missingHash = CoordinateCacheKey::HashAzimuths(azimuths);
+   azimuths[100] = -std::numeric_limits<float>::quiet_NaN();
+   EXPECT_EQ(CoordinateCacheKey::HashAzimuths(azimuths), missingHash);
+}
+
+TEST(CoordinateCache, GetOrCalculate)
+{
+   const auto directory =
+      std::filesystem::temp_directory_path() / "coordinate_cache_calc_test";
+   std::filesystem::remove_all(directory);
+
+   std::vector<float> azimuths = Azimuths();
+   const auto         key      = Key(azimuths);
+
+   std::shared_ptr<const CoordinateTable> table {};
+
+   {
+      CoordinateCache cache {};
+      cache.SetCachePath(directory.string());
+
+      table =
+         cache.GetOrCalculate(key, kRadarSite_, azimuths, 0.5 * kGateSize_);
+      ASSERT_NE(table, nullptr);
+      EXPECT_EQ(table->num_radials(), kNumRadials_);
+      EXPECT_EQ(cache.Get(key), table);
+      ExpectUncachedCoordinates(*table, azimuths);
+
+      cache.Flush();
+   }
+
+   {
+      // Coordinates read from disk match the calculated coordinates
+      CoordinateCache cache {};
+      cache.SetCachePath(directory.string());
+
+      auto diskTable =
+         cache.GetOrCalculate(key, kRadarSite_, azimuths, 0.5 * kGateSize_);
+      ASSERT_NE(diskTable, nullptr);
+      EXPECT_TRUE(std::equal(table->data().begin(),
+                             table->data().end(),
+                             diskTable->data().begin(),
+                             diskTable->data().end()));
+
+      // A sweep with slightly different azimuths does not reuse the table
+      for (std::size_t radial = 0; radial < azimuths.size(); radial += 3)
+      {
+         azimuths[radial] += 0.02f;
+      }
+
+      auto otherTable = cache.GetOrCalculate(
+         Key(azimuths), kRadarSite_, azimuths, 0.5 * kGateSize_);
+      ASSERT_NE(otherTable, nullptr);
+      EXPECT_NE(otherTable, diskTable);
+      ExpectUncachedCoordinates(*otherTable, azimuths);
+   }
+
+   std::filesystem::remove_all(directory);
+}
+
+TEST(CoordinateCache, StoreAndGet)
+{
+   const auto directory =
+      std::filesystem::temp_directory_path() / "coordinate_cache_test";
+   std::filesystem::remove_all(directory);
+
+   const CoordinateCacheKey key {"KLSX", 5, 360u, 1u, 4u, 250.0f, true};
+   const std::vector<float> coordinates(360u * 4u * 2u, 1.5f);
+
+   {
+      CoordinateCache cache {};
+      cache.SetCachePath(directory.string());
+
+      // Tables of the wrong size are not stored
+      EXPECT_EQ(cache.Store(key, std::vector<float>(4u)), nullptr);
+
+      auto table = cache.Store(key, std::vector<float> {coordinates});
+      ASSERT_NE(table, nullptr);
+      EXPECT_EQ(cache.Get(key), table);
+      EXPECT_EQ(table->num_radials(), 360u);
+      EXPECT_EQ(table->radial(1).size(), 8u);
+
+      cache.Flush();
+   }
+
+   {
+      // A new cache reads the table from disk
+      CoordinateCache cache {};
+      cache.SetCachePath(directory.string());
+
+      auto table = cache.Get(key);
+      ASSERT_NE(table, nullptr);
+      EXPECT_TRUE(std::equal(coordinates.cbegin(),
+                             coordinates.cend(),
+                             table->data().begin(),
+                             table->data().end()));
+
+      CoordinateCacheKey otherKey {key};
+      otherKey.elevation_ = 9;
+      EXPECT_EQ(cache.Get(otherKey), nullptr);
+   }
+
+   std::filesystem::remove_all(directory);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,53 @@
+#include <scwx/qt/util/distance_batch.hpp>
+#include <scwx/wxbench.hpp>
+
+#include <random>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static void DistanceBatchGetDistances(benchmark::State& state,
+                                      DistanceAccuracy  accuracy)
+{
+   // Alert centroids spread across the continental United States
+   std::mt19937                           generator {0u};
+   std::uniform_real_distribution<double> latitude {25.0, 50.0};
+   std::uniform_real_distribution<double> longitude {-125.0, -67.0};
+
+   DistanceBatch batch {};
+   for (std::int64_t i = 0; i < state.range(0); ++i)
+   {
+      batch.Add({latitude(generator), longitude(generator)});
+   }
+
+   std::vector<double> distances(batch.size());
+
+   for (auto _ : state)
+   {
+      batch.GetDistances({38.6989, -90.6828}, distances, accuracy);
+      benchmark::DoNotOptimize(distances.data());
+   }
+
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_CAPTURE(DistanceBatchGetDistances,
+                  Spherical,
+                  DistanceAccuracy::Spherical)
+   ->ArgName("count")
+   ->Arg(100)
+   ->Arg(1000);
+BENCHMARK_CAPTURE(DistanceBatchGetDistances,
+                  Geodesic,
+                  DistanceAccuracy::Geodesic)
+   ->ArgName("count")
+   ->Arg(100)
+   ->Arg(1000);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,117 @@
+#include <scwx/qt/util/distance_batch.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::vector<common::Coordinate> kCoordinates_ = {
+   common::Coordinate(38.6989, -90.6828),   // KLSX
+   common::Coordinate(18.1156, -66.0781),   // TJUA
+   common::Coordinate(64.5114, -165.2950),  // PAEC
+   common::Coordinate(-14.2550, -170.6750), // Southern hemisphere
+   common::Coordinate(51.8800, 179.0000),   // Antimeridian
+   common::Coordinate(38.6989, -90.6828)};  // Same as the point
+
+static const common::Coordinate kPoint_ {38.6989, -90.6828};
+
+TEST(DistanceBatch, Geodesic)
+{
+   DistanceBatch batch {};
+   EXPECT_TRUE(batch.empty());
+
+   for (auto& coordinate : kCoordinates_)
+   {
+      batch.Add(coordinate);
+   }
+
+   ASSERT_EQ(batch.size(), kCoordinates_.size());
+
+   std::vector<double> distances(batch.size());
+   batch.GetDistances(kPoint_, distances, DistanceAccuracy::Geodesic);
+
+   for (std::size_t i = 0; i < kCoordinates_.size(); ++i)
+   {
+      const double expected =
+         GeographicLib::GetDistance(kPoint_.latitude_,
+                                    kPoint_.longitude_,
+                                    kCoordinates_[i].latitude_,
+                                    kCoordinates_[i].longitude_)
+            .value();
+
+      EXPECT_DOUBLE_EQ(distances[i], expected);
+      EXPECT_DOUBLE_EQ(
+         batch.GetDistance(i, kPoint_, DistanceAccuracy::Geodesic), expected);
+   }
+}
+
+TEST(DistanceBatch, Spherical)
+{
+   DistanceBatch batch {};
+
+   for (auto& coordinate : kCoordinates_)
+   {
+      batch.Add(coordinate);
+   }
+
+   std::vector<double> distances(batch.size());
+   batch.GetDistances(kPoint_, distances, DistanceAccuracy::Spherical);
+
+   for (std::size_t i = 0; i < kCoordinates_.size(); ++i)
+   {
+      const double expected =
+         GeographicLib::GetDistance(kPoint_.latitude_,
+                                    kPoint_.longitude_,
+                                    kCoordinates_[i].latitude_,
+                                    kCoordinates_[i].longitude_)
+            .value();
+
+      // The spherical distance is within 0.6% of the geodesic distance
+      EXPECT_NEAR(distances[i], expected, expected * 0.006 + 1e-6);
+      EXPECT_DOUBLE_EQ(
+         batch.GetDistance(i, kPoint_, DistanceAccuracy::Spherical),
+         distances[i]);
+   }
+
+   EXPECT_EQ(distances.back(), 0.0);
+}
+
+TEST(DistanceBatch, Set)
+{
+   DistanceBatch batch {};
+   batch.Add(kCoordinates_[0]);
+   batch.Add(kCoordinates_[1]);
+
+   batch.Set(0, kCoordinates_[2]);
+
+   EXPECT_EQ(batch.coordinate(0), kCoordinates_[2]);
+   EXPECT_EQ(batch.coordinate(1), kCoordinates_[1]);
+   EXPECT_DOUBLE_EQ(
+      batch.GetDistance(0, kCoordinates_[2], DistanceAccuracy::Spherical),
+      0.0);
+
+   batch.Clear();
+
+   EXPECT_TRUE(batch.empty());
+}
+
+TEST(DistanceBatch, DistanceAccuracyName)
+{
+   for (DistanceAccuracy accuracy : DistanceAccuracyIterator())
+   {
+      EXPECT_EQ(GetDistanceAccuracy(GetDistanceAccuracyName(accuracy)),
+                accuracy);
+   }
+
+   EXPECT_EQ(GetDistanceAccuracy("geodesic"), DistanceAccuracy::Geodesic);
+   EXPECT_EQ(GetDistanceAccuracy("invalid"), DistanceAccuracy::Unknown);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
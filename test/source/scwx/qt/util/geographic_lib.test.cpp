@@ -64,6 +64,82 @@ TEST(geographic_lib, area_in_range_far)
    EXPECT_EQ(value, true);
 }
 
+TEST(geographic_lib, radial_coordinates_error)
+{
+   static constexpr std::size_t kGateCount = 1840;
+   static constexpr double      kGateSize  = 250.0;
+
+   const std::vector<common::Coordinate> sites = {
+      common::Coordinate(38.6989, -90.6828),   // KLSX
+      common::Coordinate(18.1156, -66.0781),   // TJUA
+      common::Coordinate(64.5114, -165.2950),  // PAEC
+      common::Coordinate(-14.2550, -170.6750), // Southern hemisphere
+      common::Coordinate(51.8800, 179.0000)    // Antimeridian
+   };
+
+   const auto& geodesic = scwx::qt::util::GeographicLib::DefaultGeodesic();
+
+   std::vector<double> approximate(kGateCount * 2);
+   std::vector<double> exact(kGateCount * 2);
+   double              maxError      = 0.0;
+   double              maxExactError = 0.0;
+
+   for (auto& site : sites)
+   {
+      for (double azimuth = 0.0; azimuth < 360.0; azimuth += 7.5)
+      {
+         for (double offset : {0.5, 1.0})
+         {
+            scwx::qt::util::GeographicLib::GetRadialCoordinates(
+               site,
+               units::angle::degrees<double> {azimuth},
+               units::length::meters<double> {offset * kGateSize},
+               units::length::meters<double> {kGateSize},
+               std::span<double> {approximate});
+            scwx::qt::util::GeographicLib::GetRadialCoordinates(
+               site,
+               units::angle::degrees<double> {azimuth},
+               units::length::meters<double> {offset * kGateSize},
+               units::length::meters<double> {kGateSize},
+               std::span<double> {exact},
+               true);
+
+            for (std::size_t gate = 0; gate < kGateCount; ++gate)
+            {
+               double latitude;
+               double longitude;
+               double error;
+               double exactError;
+
+               geodesic.Direct(site.latitude_,
+                               site.longitude_,
+                               azimuth,
+                               (gate + offset) * kGateSize,
+                               latitude,
+                               longitude);
+
+               geodesic.Inverse(latitude,
+                                longitude,
+                                approximate[gate * 2],
+                                approximate[gate * 2 + 1],
+                                error);
+               geodesic.Inverse(latitude,
+                                longitude,
+                                exact[gate * 2],
+                                exact[gate * 2 + 1],
+                                exactError);
+
+               maxError      = std::max(maxError, error);
+               maxExactError = std::max(maxExactError, exactError);
+            }
+         }
+      }
+   }
+
+   EXPECT_LT(maxError,
+             scwx::qt::util::GeographicLib::kRadialCoordinatesMaxError.value());
+   EXPECT_LT(maxExactError, 1e-6);
+}
 
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,111 @@
+#include <scwx/qt/util/polar_sweep.hpp>
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const PolarSweep::Radial kRadial_ {0, 1, 0, 4, 16, 4};
+
+TEST(PolarSweep, Pack8Bit)
+{
+   PolarSweep sweep {};
+   sweep.Reset(1u, 4u, true, 2u);
+
+   const std::array<std::uint8_t, 4> moments0 {10, 20, 30, 40};
+   const std::array<std::uint8_t, 2> moments1 {50, 60};
+   const std::array<std::uint8_t, 3> cfpMoments0 {9, 10, 11};
+
+   sweep.AddRadial(kRadial_, moments0, cfpMoments0);
+   sweep.AddRadial({1, 2, 1, 4, 9, 2}, moments1);
+
+   EXPECT_EQ(sweep.component_size(), 1u);
+   EXPECT_EQ(sweep.gate_count(), 4u);
+   EXPECT_EQ(sweep.radial_count(), 2u);
+   EXPECT_EQ(sweep.vertex_count(), 2u * 4u * PolarSweep::kVerticesPerGate_);
+
+   // Short radials are zero filled
+   const std::vector<std::uint8_t> expectedMoments {
+      10, 20, 30, 40, 50, 60, 0, 0};
+   const std::vector<std::uint8_t> expectedCfpMoments {
+      9, 10, 11, 0, 0, 0, 0, 0};
+
+   EXPECT_EQ(std::vector<std::uint8_t>(sweep.moments().begin(),
+                                       sweep.moments().end()),
+             expectedMoments);
+   EXPECT_EQ(std::vector<std::uint8_t>(sweep.cfp_moments().begin(),
+                                       sweep.cfp_moments().end()),
+             expectedCfpMoments);
+
+   ASSERT_EQ(sweep.radials().size(), 2u);
+   EXPECT_EQ(sweep.radials()[1].coordinateRow_, 1);
+   EXPECT_EQ(sweep.radials()[1].nextCoordinateRow_, 2);
+   EXPECT_EQ(sweep.radials()[1].startGate_, 1);
+   EXPECT_EQ(sweep.radials()[1].endGate_, 9);
+   EXPECT_EQ(sweep.radials()[1].gateCount_, 2);
+}
+
+TEST(PolarSweep, Pack16Bit)
+{
+   PolarSweep sweep {};
+   sweep.Reset(2u, 2u, false, 1u);
+
+   // Long radials are truncated
+   const std::array<std::uint16_t, 3> moments {1000, 2000, 3000};
+
+   sweep.AddRadial(kRadial_, moments);
+
+   // Radials of the wrong size are not packed
+   sweep.AddRadial(kRadial_, std::array<std::uint8_t, 2> {1, 2});
+
+   ASSERT_EQ(sweep.radial_count(), 1u);
+   ASSERT_EQ(sweep.moments().size(), 2u * sizeof(std::uint16_t));
+   EXPECT_TRUE(sweep.cfp_moments().empty());
+
+   std::array<std::uint16_t, 2> packed {};
+   std::memcpy(packed.data(), sweep.moments().data(), sweep.moments().size());
+   EXPECT_EQ(packed[0], 1000u);
+   EXPECT_EQ(packed[1], 2000u);
+}
+
+TEST(PolarSweep, Reset)
+{
+   PolarSweep sweep {};
+   sweep.Reset(1u, 4u, false, 1u);
+   sweep.AddRadial(kRadial_, std::array<std::uint8_t, 4> {1, 2, 3, 4});
+
+   sweep.Reset(2u, 8u, false, 1u);
+
+   EXPECT_EQ(sweep.component_size(), 2u);
+   EXPECT_EQ(sweep.gate_count(), 8u);
+   EXPECT_EQ(sweep.radial_count(), 0u);
+   EXPECT_TRUE(sweep.moments().empty());
+   EXPECT_EQ(sweep.vertex_count(), 0u);
+}
+
+TEST(PolarSweep, Coordinates)
+{
+   const std::vector<float> coordinates(2u * 3u * 2u, 1.0f);
+
+   PolarSweep sweep {};
+   EXPECT_EQ(sweep.coordinate_version(), 0u);
+
+   sweep.SetCoordinates(coordinates, 2u, 3u);
+
+   EXPECT_EQ(sweep.coordinate_version(), 1u);
+   EXPECT_EQ(sweep.coordinate_radial_count(), 2u);
+   EXPECT_EQ(sweep.coordinate_gate_count(), 3u);
+   EXPECT_EQ(sweep.coordinates().data(), coordinates.data());
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
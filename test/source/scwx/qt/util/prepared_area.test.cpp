@@ -0,0 +1,123 @@
+#include <scwx/qt/util/prepared_area.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::vector<common::Coordinate> kArea_ = {
+   common::Coordinate(37.0193692, -91.8778413),
+   common::Coordinate(36.9719180, -91.3006973),
+   common::Coordinate(36.7270831, -91.6815753),
+};
+
+TEST(PreparedArea, InRangeOfPoint)
+{
+   const PreparedArea area {kArea_};
+
+   const auto inside = common::Coordinate(36.9241584, -91.6425933);
+   const auto near   = common::Coordinate(36.8009181, -91.3922700);
+   const auto far    = common::Coordinate(37.6481966, -94.2163834);
+
+   EXPECT_TRUE(area.ContainsPoint(inside));
+   EXPECT_FALSE(area.ContainsPoint(near));
+   EXPECT_FALSE(area.ContainsPoint(far));
+
+   EXPECT_TRUE(area.InRangeOfPoint(inside, units::length::meters<double>(0)));
+   EXPECT_TRUE(area.InRangeOfPoint(inside, units::length::meters<double>(1e6)));
+
+   EXPECT_FALSE(area.InRangeOfPoint(near, units::length::meters<double>(9000)));
+   EXPECT_TRUE(area.InRangeOfPoint(near, units::length::meters<double>(10100)));
+
+   EXPECT_FALSE(area.InRangeOfPoint(far, units::length::meters<double>(100e3)));
+   EXPECT_TRUE(area.InRangeOfPoint(far, units::length::meters<double>(300e3)));
+}
+
+TEST(PreparedArea, MatchesGeographicLib)
+{
+   const PreparedArea area {kArea_};
+
+   // Sample a grid around the area, including points near each edge
+   for (double latitude = 36.5; latitude <= 37.2; latitude += 0.025)
+   {
+      for (double longitude = -92.0; longitude <= -91.2; longitude += 0.025)
+      {
+         const common::Coordinate point {latitude, longitude};
+
+         EXPECT_EQ(area.ContainsPoint(point),
+                   GeographicLib::AreaContainsPoint(kArea_, point))
+            << latitude << ", " << longitude;
+         EXPECT_EQ(
+            area.InRangeOfPoint(point, units::length::meters<double>(5000)),
+            GeographicLib::AreaInRangeOfPoint(
+               kArea_, point, units::length::meters<double>(5000)))
+            << latitude << ", " << longitude;
+      }
+   }
+}
+
+TEST(PreparedArea, BoundingBox)
+{
+   const PreparedArea area {kArea_};
+   const auto&        box = area.bounding_box();
+
+   for (auto& coordinate : kArea_)
+   {
+      EXPECT_GE(coordinate.latitude_, box.minLatitude_);
+      EXPECT_LE(coordinate.latitude_, box.maxLatitude_);
+      EXPECT_GE(coordinate.longitude_, box.minLongitude_);
+      EXPECT_LE(coordinate.longitude_, box.maxLongitude_);
+   }
+
+   // Every location within the distance of the point is inside its box
+   const common::Coordinate point {36.9, -91.6};
+   const auto               distance = units::length::meters<double>(50e3);
+   const auto pointBox = PreparedArea::GetBoundingBox(point, distance);
+
+   for (double angle = 0.0; angle < 360.0; angle += 15.0)
+   {
+      const common::Coordinate edge = GeographicLib::GetCoordinate(
+         point, units::angle::degrees<double>(angle), distance);
+
+      EXPECT_GE(edge.latitude_, pointBox.minLatitude_);
+      EXPECT_LE(edge.latitude_, pointBox.maxLatitude_);
+      EXPECT_GE(edge.longitude_, pointBox.minLongitude_);
+      EXPECT_LE(edge.longitude_, pointBox.maxLongitude_);
+   }
+}
+
+TEST(PreparedArea, Antimeridian)
+{
+   const PreparedArea area {{common::Coordinate(52.0, 179.5),
+                             common::Coordinate(52.0, -179.5),
+                             common::Coordinate(51.0, -179.5),
+                             common::Coordinate(51.0, 179.5)}};
+
+   EXPECT_TRUE(area.bounding_box().maxLongitude_ > 180.0 ||
+               area.bounding_box().minLongitude_ < -180.0);
+
+   EXPECT_TRUE(area.ContainsPoint({51.5, 179.9}));
+   EXPECT_TRUE(area.ContainsPoint({51.5, -179.9}));
+   EXPECT_FALSE(area.ContainsPoint({51.5, 179.0}));
+   EXPECT_FALSE(area.ContainsPoint({51.5, -179.0}));
+
+   EXPECT_TRUE(
+      area.InRangeOfPoint({51.5, -179.0}, units::length::meters<double>(50e3)));
+}
+
+TEST(PreparedArea, Invalid)
+{
+   const PreparedArea line {{common::Coordinate(37.0, -91.0),
+                             common::Coordinate(37.0, -92.0)}};
+
+   EXPECT_FALSE(line.ContainsPoint({37.0, -91.5}));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
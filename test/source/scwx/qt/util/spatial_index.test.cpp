@@ -0,0 +1,75 @@
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+TEST(SpatialIndex, Query)
+{
+   SpatialIndex index {};
+   EXPECT_TRUE(index.empty());
+
+   index.Build({{{0.0f, 0.0f}, {1.0f, 1.0f}},
+                {{5.0f, 5.0f}, {6.0f, 6.0f}},
+                {{0.5f, 0.5f}, {5.5f, 5.5f}},
+                {{-2.0f, -2.0f}, {-1.0f, -1.0f}}});
+
+   EXPECT_EQ(index.size(), 4u);
+
+   const std::vector<std::size_t> expected0 {0u, 2u};
+   const std::vector<std::size_t> expected1 {1u, 2u};
+   const std::vector<std::size_t> expected2 {3u};
+
+   EXPECT_EQ(index.Query({{0.75f, 0.75f}, {0.8f, 0.8f}}), expected0);
+   EXPECT_EQ(index.Query(glm::vec2 {5.8f, 5.8f}, 0.5f), expected1);
+   EXPECT_TRUE(index.Query(glm::vec2 {10.0f, 10.0f}, 1.0f).empty());
+
+   // Box corners may be given in any order
+   EXPECT_EQ(index.Query({{-1.5f, -1.0f}, {-1.75f, -1.5f}}), expected2);
+}
+
+TEST(SpatialIndex, Rebuild)
+{
+   SpatialIndex index {};
+   index.Build({{{0.0f, 0.0f}, {1.0f, 1.0f}}});
+   index.Build({{{2.0f, 2.0f}, {3.0f, 3.0f}}, {{0.0f, 0.0f}, {1.0f, 1.0f}}});
+
+   const std::vector<std::size_t> expected {1u};
+
+   EXPECT_EQ(index.Query(glm::vec2 {0.5f, 0.5f}, 0.0f), expected);
+
+   index.Clear();
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(index.Query(glm::vec2 {0.5f, 0.5f}, 1.0f).empty());
+}
+
+TEST(SpatialIndex, InsertRemove)
+{
+   SpatialIndex index {};
+   index.Build(std::vector<SpatialIndex::Item> {
+      {10u, {{0.0f, 0.0f}, {1.0f, 1.0f}}}, {20u, {{2.0f, 2.0f}, {3.0f, 3.0f}}}});
+
+   index.Insert(30u, {{0.5f, 0.5f}, {0.5f, 0.5f}});
+
+   const std::vector<std::size_t> expected0 {10u, 30u};
+   const std::vector<std::size_t> expected1 {10u};
+
+   EXPECT_EQ(index.Query(glm::vec2 {0.5f, 0.5f}, 0.1f), expected0);
+
+   // Items are removed by ID and bounding box
+   EXPECT_FALSE(index.Remove(30u, {{1.0f, 1.0f}, {1.0f, 1.0f}}));
+   EXPECT_FALSE(index.Remove(20u, {{0.5f, 0.5f}, {0.5f, 0.5f}}));
+   EXPECT_TRUE(index.Remove(30u, {{0.5f, 0.5f}, {0.5f, 0.5f}}));
+
+   EXPECT_EQ(index.Query(glm::vec2 {0.5f, 0.5f}, 0.1f), expected1);
+   EXPECT_EQ(index.size(), 2u);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
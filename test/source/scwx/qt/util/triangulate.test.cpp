@@ -0,0 +1,125 @@
+#include <scwx/qt/util/triangulate.hpp>
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static double TriangulatedArea(const std::vector<glm::vec2>&     points,
+                               const std::vector<std::uint32_t>& triangles)
+{
+   double area = 0.0;
+
+   for (std::size_t i = 0; i + 2 < triangles.size(); i += 3)
+   {
+      const glm::vec2& a = points[triangles[i + 0]];
+      const glm::vec2& b = points[triangles[i + 1]];
+      const glm::vec2& c = points[triangles[i + 2]];
+
+      area += std::abs((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)) /
+              2.0;
+   }
+
+   return area;
+}
+
+TEST(Triangulate, Square)
+{
+   const std::vector<glm::vec2> points {
+      {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+
+   auto triangles = TriangulateSimplePolygon(points);
+
+   ASSERT_TRUE(triangles.has_value());
+   EXPECT_EQ(triangles->size(), 6u);
+   EXPECT_DOUBLE_EQ(TriangulatedArea(points, *triangles), 1.0);
+}
+
+TEST(Triangulate, ConcaveClockwiseClosed)
+{
+   // Clockwise "U" shape, with the first point repeated
+   const std::vector<glm::vec2> points {{0.0f, 0.0f},
+                                        {0.0f, 3.0f},
+                                        {1.0f, 3.0f},
+                                        {1.0f, 1.0f},
+                                        {2.0f, 1.0f},
+                                        {2.0f, 3.0f},
+                                        {3.0f, 3.0f},
+                                        {3.0f, 0.0f},
+                                        {0.0f, 0.0f}};
+
+   auto triangles = TriangulateSimplePolygon(points);
+
+   ASSERT_TRUE(triangles.has_value());
+   EXPECT_EQ(triangles->size(), 6u * 3u);
+   EXPECT_DOUBLE_EQ(TriangulatedArea(points, *triangles), 7.0);
+
+   for (auto index : *triangles)
+   {
+      EXPECT_LT(index, 8u);
+   }
+}
+
+TEST(Triangulate, Collinear)
+{
+   // Square with a duplicate point and a collinear point along each edge
+   const std::vector<glm::vec2> points {{0.0f, 0.0f},
+                                        {1.0f, 0.0f},
+                                        {1.0f, 0.0f},
+                                        {2.0f, 0.0f},
+                                        {2.0f, 1.0f},
+                                        {2.0f, 2.0f},
+                                        {1.0f, 2.0f},
+                                        {0.0f, 2.0f},
+                                        {0.0f, 1.0f}};
+
+   auto triangles = TriangulateSimplePolygon(points);
+
+   ASSERT_TRUE(triangles.has_value());
+   EXPECT_DOUBLE_EQ(TriangulatedArea(points, *triangles), 4.0);
+}
+
+TEST(Triangulate, Degenerate)
+{
+   const std::vector<glm::vec2> line {{0.0f, 0.0f}, {1.0f, 1.0f}};
+   const std::vector<glm::vec2> flat {{0.0f, 0.0f}, {1.0f, 1.0f}, {2.0f, 2.0f}};
+
+   auto lineTriangles = TriangulateSimplePolygon(line);
+   auto flatTriangles = TriangulateSimplePolygon(flat);
+
+   ASSERT_TRUE(lineTriangles.has_value());
+   EXPECT_TRUE(lineTriangles->empty());
+
+   // The edges of a flat polygon overlap
+   EXPECT_FALSE(flatTriangles.has_value());
+}
+
+TEST(Triangulate, SelfIntersecting)
+{
+   // Bowtie
+   const std::vector<glm::vec2> bowtie {
+      {0.0f, 0.0f}, {1.0f, 1.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}};
+
+   // Two squares touching at a vertex
+   const std::vector<glm::vec2> touching {{0.0f, 0.0f},
+                                          {1.0f, 0.0f},
+                                          {1.0f, 1.0f},
+                                          {2.0f, 1.0f},
+                                          {2.0f, 2.0f},
+                                          {1.0f, 2.0f},
+                                          {1.0f, 1.0f},
+                                          {0.0f, 1.0f}};
+
+   EXPECT_FALSE(TriangulateSimplePolygon(bowtie).has_value());
+   EXPECT_FALSE(TriangulateSimplePolygon(touching).has_value());
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
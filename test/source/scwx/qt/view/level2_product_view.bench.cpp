@@ -0,0 +1,164 @@
+#include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/request/nexrad_file_request.hpp>
+#include <scwx/qt/util/coordinate_cache.hpp>
+#include <scwx/util/metrics.hpp>
+#include <scwx/wxbench.hpp>
+
+#include <future>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string kLevel2File_ =
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+static std::shared_ptr<manager::RadarProductManager>
+LoadLevel2File(const std::string& path)
+{
+   config::RadarSite::Initialize();
+
+   // Coordinate tables are held in memory only, so benchmarks do not read or
+   // write the user's coordinate cache directory
+   util::CoordinateCache::Instance().SetCachePath("");
+
+   auto request = std::make_shared<request::NexradFileRequest>();
+   std::promise<std::shared_ptr<types::RadarProductRecord>> recordPromise {};
+
+   QObject::connect(
+      request.get(),
+      &request::NexradFileRequest::RequestComplete,
+      [&](std::shared_ptr<request::NexradFileRequest> completedRequest)
+      { recordPromise.set_value(completedRequest->radar_product_record()); });
+
+   manager::RadarProductManager::LoadFile(bench::TestDataPath(path), request);
+
+   auto record = recordPromise.get_future().get();
+   if (record == nullptr)
+   {
+      return nullptr;
+   }
+
+   return manager::RadarProductManager::Instance(record->radar_id());
+}
+
+static void Level2ProductViewComputeSweep(benchmark::State&     state,
+                                          common::Level2Product product)
+{
+   // Load the file once, without a map or OpenGL context
+   static const auto radarProductManager = LoadLevel2File(kLevel2File_);
+
+   if (radarProductManager == nullptr)
+   {
+      state.SkipWithError("Could not load Level 2 file");
+      return;
+   }
+
+   const bool smoothingEnabled = (state.range(0) != 0);
+
+   std::shared_ptr<Level2ProductView> view {};
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      // A new view computes the full sweep. After the first iteration,
+      // coordinates are copied from the memory cache, as they are for each
+      // product of the same sweep.
+      state.PauseTiming();
+      view = Level2ProductView::Create(product, radarProductManager);
+      view->set_smoothing_enabled(smoothingEnabled);
+      state.ResumeTiming();
+
+      QMetaObject::invokeMethod(
+         view.get(), "ComputeSweep", Qt::ConnectionType::DirectConnection);
+   }
+
+   state.PauseTiming();
+   view.reset();
+   state.ResumeTiming();
+
+   bench::SetStageCounters(state, "sweep.level2");
+}
+
+static void Level2ProductViewComputeCoordinates(benchmark::State& state)
+{
+   static const auto radarProductManager = LoadLevel2File(kLevel2File_);
+
+   if (radarProductManager == nullptr)
+   {
+      state.SkipWithError("Could not load Level 2 file");
+      return;
+   }
+
+   const bool smoothingEnabled = (state.range(0) != 0);
+
+   auto& coordinatesHistogram =
+      scwx::util::MetricsRegistry::Instance().GetHistogram(
+         "sweep.level2.coordinates");
+
+   std::shared_ptr<Level2ProductView> view {};
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      // Clear the memory cache, so each iteration calculates the coordinate
+      // table
+      view = Level2ProductView::Create(common::Level2Product::Reflectivity,
+                                       radarProductManager);
+      view->set_smoothing_enabled(smoothingEnabled);
+      util::CoordinateCache::Instance().Clear();
+
+      const auto total = coordinatesHistogram.GetSnapshot().total_;
+
+      QMetaObject::invokeMethod(
+         view.get(), "ComputeSweep", Qt::ConnectionType::DirectConnection);
+
+      // Only the coordinate calculation is timed
+      state.SetIterationTime(
+         std::chrono::duration<double>(
+            coordinatesHistogram.GetSnapshot().total_ - total)
+            .count());
+   }
+
+   view.reset();
+
+   bench::SetStageCounters(state, "sweep.level2");
+}
+
+BENCHMARK(Level2ProductViewComputeCoordinates)
+   ->ArgName("smoothing")
+   ->Arg(0)
+   ->Arg(1)
+   ->UseManualTime()
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Level2ProductViewComputeSweep,
+                  Reflectivity,
+                  common::Level2Product::Reflectivity)
+   ->ArgName("smoothing")
+   ->Arg(0)
+   ->Arg(1)
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Level2ProductViewComputeSweep,
+                  Velocity,
+                  common::Level2Product::Velocity)
+   ->ArgName("smoothing")
+   ->Arg(0)
+   ->Arg(1)
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Level2ProductViewComputeSweep,
+                  DifferentialReflectivity,
+                  common::Level2Product::DifferentialReflectivity)
+   ->ArgName("smoothing")
+   ->Arg(0)
+   ->Unit(benchmark::kMillisecond);
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
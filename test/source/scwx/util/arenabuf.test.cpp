@@ -0,0 +1,58 @@
+#include <scwx/util/arenabuf.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+class arenabuf_test : public ::testing::Test
+{
+protected:
+   arenabuf_test() :
+       arena_ {std::make_shared<std::vector<char>>(
+          std::initializer_list<char> {'s', 'm', 'i', 'l', 'e', 's', '\0'})},
+       ab_(arena_),
+       is_(&ab_),
+       Test()
+   {
+   }
+   ~arenabuf_test() = default;
+
+   std::shared_ptr<std::vector<char>> arena_;
+   arenabuf                           ab_;
+   std::istream                       is_;
+};
+
+TEST_F(arenabuf_test, smiles)
+{
+   char data[7];
+   is_.read(data, 7);
+
+   EXPECT_EQ(std::string(data), std::string("smiles"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+
+   is_.read(data, 1);
+
+   EXPECT_EQ(is_.eof(), true);
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(arenabuf_test, current)
+{
+   EXPECT_EQ(ab_.arena(), arena_);
+   EXPECT_EQ(ab_.current(), arena_->data());
+
+   is_.seekg(1, std::ios_base::beg);
+   EXPECT_EQ(ab_.current(), arena_->data() + 1);
+   EXPECT_EQ(std::string(ab_.current()), std::string("miles"));
+
+   is_.seekg(2, std::ios_base::cur);
+   EXPECT_EQ(ab_.current(), arena_->data() + 3);
+   EXPECT_EQ(ab_.in_avail(), 4);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,178 @@
+#include <scwx/util/metrics.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+using namespace std::chrono_literals;
+
+static double Milliseconds(std::chrono::nanoseconds duration)
+{
+   return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+TEST(MetricsTest, Counter)
+{
+   Counter counter {"counter"};
+
+   counter.Increment();
+   counter.Increment(4);
+
+   EXPECT_EQ(counter.name(), "counter");
+   EXPECT_EQ(counter.value(), 5u);
+
+   counter.Reset();
+
+   EXPECT_EQ(counter.value(), 0u);
+}
+
+TEST(MetricsTest, CounterThreads)
+{
+   static constexpr std::size_t kThreadCount_    = 4u;
+   static constexpr std::size_t kIncrementCount_ = 10000u;
+
+   Counter                  counter {"counter"};
+   std::vector<std::thread> threads {};
+
+   for (std::size_t i = 0; i < kThreadCount_; ++i)
+   {
+      threads.emplace_back(
+         [&]()
+         {
+            for (std::size_t j = 0; j < kIncrementCount_; ++j)
+            {
+               counter.Increment();
+            }
+         });
+   }
+
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   EXPECT_EQ(counter.value(), kThreadCount_ * kIncrementCount_);
+}
+
+TEST(MetricsTest, HistogramEmpty)
+{
+   Histogram histogram {"histogram"};
+
+   auto snapshot = histogram.GetSnapshot();
+
+   EXPECT_EQ(snapshot.name_, "histogram");
+   EXPECT_EQ(snapshot.count_, 0u);
+   EXPECT_EQ(snapshot.min_, 0ns);
+   EXPECT_EQ(snapshot.max_, 0ns);
+   EXPECT_EQ(snapshot.p50_, 0ns);
+}
+
+TEST(MetricsTest, HistogramSnapshot)
+{
+   Histogram histogram {"histogram"};
+
+   // 1 ms through 100 ms
+   for (int i = 1; i <= 100; ++i)
+   {
+      histogram.Record(std::chrono::milliseconds {i});
+   }
+
+   auto snapshot = histogram.GetSnapshot();
+
+   EXPECT_EQ(snapshot.count_, 100u);
+   EXPECT_EQ(snapshot.total_, 5050ms);
+   EXPECT_EQ(snapshot.min_, 1ms);
+   EXPECT_EQ(snapshot.max_, 100ms);
+   EXPECT_EQ(snapshot.mean_, 50500us);
+
+   // Percentiles are estimated to within the bucket width
+   EXPECT_NEAR(Milliseconds(snapshot.p50_), 50.0, 50.0 * 0.25);
+   EXPECT_NEAR(Milliseconds(snapshot.p90_), 90.0, 90.0 * 0.25);
+   EXPECT_NEAR(Milliseconds(snapshot.p99_), 99.0, 99.0 * 0.25);
+   EXPECT_LE(snapshot.p99_, snapshot.max_);
+
+   histogram.Reset();
+
+   EXPECT_EQ(histogram.GetSnapshot().count_, 0u);
+}
+
+TEST(MetricsTest, HistogramSmallValues)
+{
+   Histogram histogram {"histogram"};
+
+   histogram.Record(0ns);
+   histogram.Record(1ns);
+   histogram.Record(2ns);
+   histogram.Record(-5ns);
+
+   auto snapshot = histogram.GetSnapshot();
+
+   EXPECT_EQ(snapshot.count_, 4u);
+   EXPECT_EQ(snapshot.min_, 0ns);
+   EXPECT_EQ(snapshot.max_, 2ns);
+   EXPECT_EQ(snapshot.p50_, 0ns);
+   EXPECT_EQ(snapshot.p99_, 2ns);
+}
+
+TEST(MetricsTest, ScopedTimer)
+{
+   Histogram histogram {"histogram"};
+
+   {
+      ScopedTimer timer {histogram};
+      std::this_thread::sleep_for(1ms);
+   }
+
+   {
+      ScopedTimer timer {histogram};
+      timer.Stop();
+      timer.Stop();
+   }
+
+   auto snapshot = histogram.GetSnapshot();
+
+   EXPECT_EQ(snapshot.count_, 2u);
+   EXPECT_GE(snapshot.max_, 1ms);
+}
+
+TEST(MetricsTest, Registry)
+{
+   MetricsRegistry registry {};
+
+   Counter&   counterB  = registry.GetCounter("b");
+   Counter&   counterA  = registry.GetCounter("a");
+   Histogram& histogram = registry.GetHistogram("a");
+
+   EXPECT_EQ(&counterA, &registry.GetCounter("a"));
+   EXPECT_EQ(&histogram, &registry.GetHistogram("a"));
+
+   counterA.Increment(2);
+   counterB.Increment(3);
+   histogram.Record(1ms);
+
+   auto counters   = registry.GetCounterSnapshots();
+   auto histograms = registry.GetHistogramSnapshots();
+
+   ASSERT_EQ(counters.size(), 2u);
+   EXPECT_EQ(counters[0].name_, "a");
+   EXPECT_EQ(counters[0].value_, 2u);
+   EXPECT_EQ(counters[1].name_, "b");
+   EXPECT_EQ(counters[1].value_, 3u);
+
+   ASSERT_EQ(histograms.size(), 1u);
+   EXPECT_EQ(histograms[0].name_, "a");
+   EXPECT_EQ(histograms[0].count_, 1u);
+
+   registry.Reset();
+
+   EXPECT_EQ(counterA.value(), 0u);
+   EXPECT_EQ(registry.GetHistogramSnapshots()[0].count_, 0u);
+}
+
+} // namespace util
+} // namespace scwx
@@ -112,5 +112,31 @@ TEST(StreamsTest, LFWithEnd)
    VerifyTokens(tokens);
 }
 
+TEST(StreamsTest, StringViewLineEndings)
+{
+   std::string_view              data {"One\r\r\nTwo\rThree\n\nFour"};
+   std::vector<std::string_view> tokens;
+   std::string_view              t;
+
+   while (scwx::util::getline(data, t))
+   {
+      tokens.push_back(t);
+   }
+
+   EXPECT_EQ(data.empty(), true);
+   EXPECT_EQ(tokens,
+             (std::vector<std::string_view> {
+                "One", "Two", "Three", "", "Four"}));
+}
+
+TEST(StreamsTest, StringViewEmpty)
+{
+   std::string_view data {};
+   std::string_view t {"Line"};
+
+   EXPECT_EQ(scwx::util::getline(data, t), false);
+   EXPECT_EQ(t.empty(), true);
+}
+
 } // namespace util
 } // namespace scwx
@@ -87,5 +87,56 @@ TEST(StringsTest, ParseTokensText)
    EXPECT_EQ(tokens[6], "discarded");
 }
 
+TEST(StringsTest, ParseTokenViewsText)
+{
+   static const std::string line {
+      "Text: lat, lon, fontNumber, \"string, string\", \"hover, hover\", "
+      "discarded"};
+
+   std::vector<std::string_view> tokens =
+      ParseTokenViews(line, {",", ",", ",", ",", ","}, 5);
+
+   ASSERT_EQ(tokens.size(), 6);
+   EXPECT_EQ(tokens[0], "lat");
+   EXPECT_EQ(tokens[1], "lon");
+   EXPECT_EQ(tokens[2], "fontNumber");
+   EXPECT_EQ(tokens[3], "\"string, string\"");
+   EXPECT_EQ(tokens[4], "\"hover, hover\"");
+   EXPECT_EQ(tokens[5], "discarded");
+}
+
+TEST(StringsTest, ParseTokenViewsMatchesParseTokens)
+{
+   static const std::vector<std::string> lines {
+      "Color: 255 128  64",
+      "Line: 2, 0, \"hover, text\"",
+      "  38.5,  -97.25 , 255, 0, 0,  ",
+      "Icon: 38.5, -97.25, 0, 1, 2, \"unterminated, hover",
+      "",
+      "   "};
+
+   for (auto& line : lines)
+   {
+      std::vector<std::string> expected =
+         ParseTokens(line, {",", ",", ",", ",", ","});
+      std::vector<std::string_view> tokens =
+         ParseTokenViews(line, {",", ",", ",", ",", ","});
+
+      ASSERT_EQ(tokens.size(), expected.size()) << line;
+      for (std::size_t i = 0; i < tokens.size(); ++i)
+      {
+         EXPECT_EQ(tokens[i], expected[i]) << line;
+      }
+   }
+}
+
+TEST(StringsTest, TrimWhitespace)
+{
+   EXPECT_EQ(TrimWhitespace("  \ttext with spaces\r\n"), "text with spaces");
+   EXPECT_EQ(TrimWhitespace("text"), "text");
+   EXPECT_TRUE(TrimWhitespace(" \t ").empty());
+   EXPECT_TRUE(TrimWhitespace("").empty());
+}
+
 } // namespace util
 } // namespace scwx
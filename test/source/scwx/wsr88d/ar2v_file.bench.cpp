@@ -0,0 +1,85 @@
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wxbench.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static void Ar2vFileLoadFile(benchmark::State& state, const std::string& path)
+{
+   const std::string filename = bench::TestDataPath(path);
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      Ar2vFile file;
+      benchmark::DoNotOptimize(file.LoadFile(filename));
+   }
+
+   bench::SetFileBytesProcessed(state, path);
+   bench::SetStageCounters(state, "decode.level2");
+}
+
+static void Ar2vFileLoadData(benchmark::State& state, const std::string& path)
+{
+   // Decode from memory, excluding file I/O
+   const std::string data = bench::ReadTestData(path);
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      std::istringstream is {data};
+      Ar2vFile           file;
+      benchmark::DoNotOptimize(file.LoadData(is));
+   }
+
+   bench::SetBytesProcessed(state, data.size());
+   bench::SetStageCounters(state, "decode.level2");
+}
+
+static void Ar2vFileGetElevationScan(benchmark::State&  state,
+                                     const std::string& path)
+{
+   Ar2vFile file;
+   if (!file.LoadFile(bench::TestDataPath(path)))
+   {
+      state.SkipWithError("Could not load file");
+      return;
+   }
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(
+         file.GetElevationScan(rda::DataBlockType::MomentRef,
+                               0.5f,
+                               std::chrono::system_clock::time_point::max()));
+   }
+}
+
+BENCHMARK_CAPTURE(Ar2vFileLoadFile,
+                  KLSX_20210527_1757,
+                  "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Ar2vFileLoadFile,
+                  TSTL_20220213_2357,
+                  "/nexrad/level2/Level2_TSTL_20220213_2357.ar2v")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Ar2vFileLoadFile,
+                  KCLE20021110_221234,
+                  "/nexrad/level2/KCLE20021110_221234")
+   ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Ar2vFileLoadData,
+                  KLSX_20210527_1757,
+                  "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v")
+   ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Ar2vFileGetElevationScan,
+                  KLSX_20210527_1757,
+                  "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v");
+
+} // namespace wsr88d
+} // namespace scwx
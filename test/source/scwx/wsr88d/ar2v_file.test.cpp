@@ -1,5 +1,7 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -22,6 +24,41 @@ TEST_P(Ar2vValidFileTest, ValidFile)
 
    EXPECT_EQ(fileValid, true);
    EXPECT_EQ(file.message_count(), param.second);
+   EXPECT_GT(file.resident_bytes(), 0u);
+}
+
+TEST(Ar2vFile, ElevationScanColumns)
+{
+   Ar2vFile file;
+   bool     fileValid =
+      file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                    "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v");
+   ASSERT_EQ(fileValid, true);
+
+   auto [elevationScan, elevationCut, elevationCuts] =
+      file.GetElevationScan(rda::DataBlockType::MomentRef,
+                            0.5f,
+                            std::chrono::system_clock::time_point::max());
+   ASSERT_NE(elevationScan, nullptr);
+   EXPECT_GT(elevationScan->radial_count(), 0u);
+   EXPECT_GE(elevationScan->size(), elevationScan->radial_count());
+
+   auto radials       = elevationScan->radials();
+   auto azimuthAngles = elevationScan->azimuth_angles();
+   ASSERT_EQ(radials.size(), azimuthAngles.size());
+
+   for (std::size_t i = 0; i < radials.size(); ++i)
+   {
+      if (radials[i] == nullptr)
+      {
+         EXPECT_TRUE(std::isnan(azimuthAngles[i]));
+      }
+      else
+      {
+         EXPECT_EQ(radials[i]->azimuth_number(), i + 1);
+         EXPECT_EQ(radials[i]->azimuth_angle().value(), azimuthAngles[i]);
+      }
+   }
 }
 
 INSTANTIATE_TEST_SUITE_P(
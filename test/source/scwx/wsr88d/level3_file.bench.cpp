@@ -0,0 +1,66 @@
+#include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wxbench.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static void Level3FileLoadFile(benchmark::State& state, const std::string& path)
+{
+   const std::string filename = bench::TestDataPath(path);
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      Level3File file;
+      benchmark::DoNotOptimize(file.LoadFile(filename));
+   }
+
+   bench::SetFileBytesProcessed(state, path);
+   bench::SetStageCounters(state, "decode.level3");
+}
+
+static void Level3FileLoadData(benchmark::State& state, const std::string& path)
+{
+   // Decode from memory, excluding file I/O
+   const std::string data = bench::ReadTestData(path);
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      std::istringstream is {data};
+      Level3File         file;
+      benchmark::DoNotOptimize(file.LoadData(is));
+   }
+
+   bench::SetBytesProcessed(state, data.size());
+   bench::SetStageCounters(state, "decode.level3");
+}
+
+// Radial (N0R), digital radial (DHR), raster (NCR), vector (NVW) and super
+// resolution (N0Z) products
+BENCHMARK_CAPTURE(Level3FileLoadFile,
+                  N0R,
+                  "/nexrad/level3/KLSX_SDUS53_N0RLSX_202105041639");
+BENCHMARK_CAPTURE(Level3FileLoadFile,
+                  DHR,
+                  "/nexrad/level3/KLSX_SDUS53_DHRLSX_202112110215");
+BENCHMARK_CAPTURE(Level3FileLoadFile,
+                  NCR,
+                  "/nexrad/level3/KLSX_SDUS53_NCRLSX_202112110215");
+BENCHMARK_CAPTURE(Level3FileLoadFile,
+                  NVW,
+                  "/nexrad/level3/KLSX_SDUS33_NVWLSX_202112110119");
+BENCHMARK_CAPTURE(Level3FileLoadFile,
+                  N0Z,
+                  "/nexrad/level3/KLSX_SDUS73_N0ZLSX_202105042031");
+
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DHR,
+                  "/nexrad/level3/KLSX_SDUS53_DHRLSX_202112110215");
+
+} // namespace wsr88d
+} // namespace scwx
@@ -27,6 +27,14 @@ TEST_P(Level3ValidFileTest, ValidFile)
    EXPECT_EQ(fileValid, true);
    ASSERT_NE(message, nullptr);
    EXPECT_EQ(message->header().message_code(), param.first);
+   EXPECT_GT(file.resident_bytes(), 0u);
+
+   // Compressed products are measured after decompression
+   auto descriptionBlock = message->description_block();
+   if (descriptionBlock != nullptr && descriptionBlock->IsCompressionEnabled())
+   {
+      EXPECT_GT(file.resident_bytes(), message->header().length_of_message());
+   }
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,38 @@
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+#include <scwx/wxbench.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static void NexradFileFactoryCreate(benchmark::State&  state,
+                                    const std::string& path)
+{
+   const std::string filename = bench::TestDataPath(path);
+
+   bench::ResetStageMetrics();
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(NexradFileFactory::Create(filename));
+   }
+
+   bench::SetFileBytesProcessed(state, path);
+   bench::SetStageCounters(state, "decode.");
+}
+
+BENCHMARK_CAPTURE(NexradFileFactoryCreate,
+                  Level2V06,
+                  "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NexradFileFactoryCreate,
+                  Level2V06Gzip,
+                  "/nexrad/level2/KLSX20130206_175044_V06.gz")
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NexradFileFactoryCreate,
+                  Level3,
+                  "/nexrad/level3/KLSX_SDUS23_N2QLSX_202112110250");
+
+} // namespace wsr88d
+} // namespace scwx
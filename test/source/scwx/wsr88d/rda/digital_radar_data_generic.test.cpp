@@ -0,0 +1,79 @@
+#include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
+#include <scwx/util/arenabuf.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::vector<std::uint16_t> kGates_ {2u, 515u, 65535u, 256u};
+
+// Moment data block following the data block type and name, with 16-bit gates
+static std::shared_ptr<std::vector<char>> MomentData(std::size_t padding)
+{
+   auto data = std::make_shared<std::vector<char>>(padding);
+
+   auto append16 = [&data](std::uint16_t value)
+   {
+      data->push_back(static_cast<char>(value >> 8));
+      data->push_back(static_cast<char>(value & 0xff));
+   };
+
+   data->insert(data->end(), 4, '\0'); // 4-7
+   append16(static_cast<std::uint16_t>(kGates_.size()));
+   append16(2125u); // Range
+   append16(250u);  // Range sample interval
+   append16(0u);    // TOVER
+   append16(16u);   // SNR threshold
+   data->push_back('\0');
+   data->push_back(16);                // Data word size
+   data->insert(data->end(), 8, '\0'); // Scale and offset
+
+   for (std::uint16_t gate : kGates_)
+   {
+      append16(gate);
+   }
+
+   return data;
+}
+
+static void ExpectGates(std::shared_ptr<std::vector<char>> data,
+                        std::size_t                        padding,
+                        bool                               inArena)
+{
+   util::arenabuf buffer {data};
+   std::istream   is {&buffer};
+   is.seekg(static_cast<std::streamoff>(padding), std::ios_base::beg);
+
+   auto block =
+      DigitalRadarDataGeneric::MomentDataBlock::Create("D", "REF", is);
+   ASSERT_NE(block, nullptr);
+
+   std::span<const std::uint16_t> gates = block->data_moments16();
+   EXPECT_TRUE(std::equal(
+      gates.begin(), gates.end(), kGates_.cbegin(), kGates_.cend()));
+
+   const char* gatesBegin = reinterpret_cast<const char*>(gates.data());
+   EXPECT_EQ(gatesBegin >= data->data() &&
+                gatesBegin < data->data() + data->size(),
+             inArena);
+}
+
+TEST(DigitalRadarDataGeneric, MomentGates16InArena)
+{
+   ExpectGates(MomentData(0), 0, true);
+}
+
+TEST(DigitalRadarDataGeneric, MomentGates16Unaligned)
+{
+   // Unaligned gates are copied out of the arena
+   ExpectGates(MomentData(1), 1, false);
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
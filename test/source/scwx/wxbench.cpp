@@ -0,0 +1,22 @@
+#include <scwx/util/logger.hpp>
+
+#include <aws/core/Aws.h>
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+int main(int argc, char** argv)
+{
+   scwx::util::Logger::Initialize();
+   spdlog::set_level(spdlog::level::warn);
+
+   Aws::SDKOptions awsSdkOptions;
+   Aws::InitAPI(awsSdkOptions);
+
+   ::benchmark::Initialize(&argc, argv);
+   ::benchmark::RunSpecifiedBenchmarks();
+   ::benchmark::Shutdown();
+
+   Aws::ShutdownAPI(awsSdkOptions);
+
+   return 0;
+}
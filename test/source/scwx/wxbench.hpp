@@ -0,0 +1,114 @@
+#pragma once
+
+#include <scwx/util/metrics.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace bench
+{
+
+/**
+ * Gets the full path of a file in the test data directory.
+ *
+ * @param [in] path Path relative to the test data directory
+ *
+ * @return Full path
+ */
+inline std::string TestDataPath(const std::string& path)
+{
+   return std::string(SCWX_TEST_DATA_DIR) + path;
+}
+
+/**
+ * Reads a file in the test data directory into memory, so decoding may be
+ * measured separately from file I/O.
+ *
+ * @param [in] path Path relative to the test data directory
+ *
+ * @return File contents
+ */
+inline std::string ReadTestData(const std::string& path)
+{
+   std::ifstream f(TestDataPath(path),
+                   std::ios_base::in | std::ios_base::binary);
+   std::ostringstream ss {};
+   ss << f.rdbuf();
+   return ss.str();
+}
+
+/**
+ * Reports the throughput of a benchmark which processes a file each
+ * iteration.
+ *
+ * @param [in] state Benchmark state
+ * @param [in] bytes Size of the file, in bytes
+ */
+inline void SetBytesProcessed(benchmark::State& state, std::uintmax_t bytes)
+{
+   state.SetBytesProcessed(state.iterations() *
+                           static_cast<std::int64_t>(bytes));
+}
+
+/**
+ * Reports the throughput of a benchmark which reads a file in the test data
+ * directory each iteration.
+ *
+ * @param [in] state Benchmark state
+ * @param [in] path Path relative to the test data directory
+ */
+inline void SetFileBytesProcessed(benchmark::State&  state,
+                                  const std::string& path)
+{
+   std::error_code ec {};
+   auto            bytes = std::filesystem::file_size(TestDataPath(path), ec);
+   if (!ec)
+   {
+      SetBytesProcessed(state, bytes);
+   }
+}
+
+/**
+ * Resets the stage histograms, so the counters reported by SetStageCounters
+ * include only samples recorded during the current benchmark run.
+ */
+inline void ResetStageMetrics()
+{
+   util::MetricsRegistry::Instance().Reset();
+}
+
+/**
+ * Reports the mean and median duration of each stage histogram recorded
+ * during the benchmark run, in seconds.
+ *
+ * @param [in] state Benchmark state
+ * @param [in] prefix Prefix of the histogram names to report, such as
+ * "decode.level2"
+ */
+inline void SetStageCounters(benchmark::State& state, const std::string& prefix)
+{
+   for (auto& snapshot :
+        util::MetricsRegistry::Instance().GetHistogramSnapshots())
+   {
+      if (snapshot.count_ == 0u || !snapshot.name_.starts_with(prefix))
+      {
+         continue;
+      }
+
+      state.counters[snapshot.name_ + ".mean"] =
+         std::chrono::duration<double>(snapshot.mean_).count();
+      state.counters[snapshot.name_ + ".p50"] =
+         std::chrono::duration<double>(snapshot.p50_).count();
+   }
+}
+
+} // namespace bench
+} // namespace scwx
@@ -3,6 +3,7 @@ project(scwx-test CXX)
 
 include(GoogleTest)
 
+find_package(benchmark)
 find_package(Boost)
 find_package(BZip2)
 find_package(GTest)
@@ -16,23 +17,37 @@ set(SRC_AWIPS_TESTS source/scwx/awips/coded_location.test.cpp
 set(SRC_COMMON_TESTS source/scwx/common/color_table.test.cpp
                      source/scwx/common/products.test.cpp)
 set(SRC_GR_TESTS source/scwx/gr/placefile.test.cpp)
-set(SRC_NETWORK_TESTS source/scwx/network/dir_list.test.cpp)
+set(SRC_NETWORK_TESTS source/scwx/network/content_validator.test.cpp
+                      source/scwx/network/dir_list.test.cpp)
 set(SRC_PROVIDER_TESTS source/scwx/provider/aws_level2_data_provider.test.cpp
                        source/scwx/provider/aws_level3_data_provider.test.cpp
+                       source/scwx/provider/nexrad_object_cache.test.cpp
                        source/scwx/provider/warnings_provider.test.cpp)
 set(SRC_QT_CONFIG_TESTS source/scwx/qt/config/county_database.test.cpp
                         source/scwx/qt/config/radar_site.test.cpp)
-set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/settings_manager.test.cpp
+set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/radar_product_cache.test.cpp
+                         source/scwx/qt/manager/settings_manager.test.cpp
                          source/scwx/qt/manager/update_manager.test.cpp)
 set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp)
 set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp
                        source/scwx/qt/model/marker_model.test.cpp)
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
                           source/scwx/qt/settings/settings_variable.test.cpp)
-set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp
+set(SRC_QT_TYPES_TESTS source/scwx/qt/types/text_event_store.test.cpp)
+set(SRC_QT_UTIL_TESTS source/scwx/qt/util/area_index.test.cpp
+                      source/scwx/qt/util/azimuth_index.test.cpp
+                      source/scwx/qt/util/coordinate_cache.test.cpp
+                      source/scwx/qt/util/distance_batch.test.cpp
+                      source/scwx/qt/util/q_file_input_stream.test.cpp
                       source/scwx/qt/util/geographic_lib.test.cpp
-                      source/scwx/qt/util/network.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+                      source/scwx/qt/util/network.test.cpp
+                      source/scwx/qt/util/polar_sweep.test.cpp
+                      source/scwx/qt/util/prepared_area.test.cpp
+                      source/scwx/qt/util/spatial_index.test.cpp
+                      source/scwx/qt/util/triangulate.test.cpp)
+set(SRC_UTIL_TESTS source/scwx/util/arenabuf.test.cpp
+                   source/scwx/util/float.test.cpp
+                   source/scwx/util/metrics.test.cpp
                    source/scwx/util/rangebuf.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/strings.test.cpp
@@ -40,6 +55,17 @@ set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
 set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
                      source/scwx/wsr88d/nexrad_file_factory.test.cpp)
+set(SRC_WSR88D_RDA_TESTS source/scwx/wsr88d/rda/digital_radar_data_generic.test.cpp)
+
+set(SRC_BENCH_MAIN source/scwx/wxbench.cpp
+                   source/scwx/wxbench.hpp)
+set(SRC_AWIPS_BENCHMARKS source/scwx/awips/text_product_file.bench.cpp)
+set(SRC_GR_BENCHMARKS source/scwx/gr/placefile.bench.cpp)
+set(SRC_QT_UTIL_BENCHMARKS source/scwx/qt/util/distance_batch.bench.cpp)
+set(SRC_QT_VIEW_BENCHMARKS source/scwx/qt/view/level2_product_view.bench.cpp)
+set(SRC_WSR88D_BENCHMARKS source/scwx/wsr88d/ar2v_file.bench.cpp
+                          source/scwx/wsr88d/level3_file.bench.cpp
+                          source/scwx/wsr88d/nexrad_file_factory.bench.cpp)
 
 set(CMAKE_FILES test.cmake)
 
@@ -54,9 +80,11 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_QT_MAP_TESTS}
                       ${SRC_QT_MODEL_TESTS}
                       ${SRC_QT_SETTINGS_TESTS}
+                      ${SRC_QT_TYPES_TESTS}
                       ${SRC_QT_UTIL_TESTS}
                       ${SRC_UTIL_TESTS}
                       ${SRC_WSR88D_TESTS}
+                      ${SRC_WSR88D_RDA_TESTS}
                       ${CMAKE_FILES})
 
 source_group("Source Files\\main"         FILES ${SRC_MAIN})
@@ -70,9 +98,11 @@ source_group("Source Files\\qt\\manager"  FILES ${SRC_QT_MANAGER_TESTS})
 source_group("Source Files\\qt\\map"      FILES ${SRC_QT_MAP_TESTS})
 source_group("Source Files\\qt\\model"    FILES ${SRC_QT_MODEL_TESTS})
 source_group("Source Files\\qt\\settings" FILES ${SRC_QT_SETTINGS_TESTS})
+source_group("Source Files\\qt\\types"    FILES ${SRC_QT_TYPES_TESTS})
 source_group("Source Files\\qt\\util"     FILES ${SRC_QT_UTIL_TESTS})
 source_group("Source Files\\util"         FILES ${SRC_UTIL_TESTS})
 source_group("Source Files\\wsr88d"       FILES ${SRC_WSR88D_TESTS})
+source_group("Source Files\\wsr88d\\rda"  FILES ${SRC_WSR88D_RDA_TESTS})
 
 target_include_directories(wxtest PRIVATE ${GTest_INCLUDE_DIRS})
 
@@ -99,3 +129,43 @@ gtest_discover_tests(wxtest)
 target_link_libraries(wxtest GTest::gtest
                              scwx-qt
                              wxdata)
+
+add_executable(wxbench ${SRC_BENCH_MAIN}
+                       ${SRC_AWIPS_BENCHMARKS}
+                       ${SRC_GR_BENCHMARKS}
+                       ${SRC_QT_UTIL_BENCHMARKS}
+                       ${SRC_QT_VIEW_BENCHMARKS}
+                       ${SRC_WSR88D_BENCHMARKS}
+                       ${CMAKE_FILES})
+
+source_group("Source Files\\main"     FILES ${SRC_BENCH_MAIN})
+source_group("Source Files\\awips"    FILES ${SRC_AWIPS_BENCHMARKS})
+source_group("Source Files\\gr"       FILES ${SRC_GR_BENCHMARKS})
+source_group("Source Files\\qt\\util" FILES ${SRC_QT_UTIL_BENCHMARKS})
+source_group("Source Files\\qt\\view" FILES ${SRC_QT_VIEW_BENCHMARKS})
+source_group("Source Files\\wsr88d"   FILES ${SRC_WSR88D_BENCHMARKS})
+
+target_include_directories(wxbench PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/source)
+
+set_target_properties(wxbench PROPERTIES CXX_STANDARD 20
+                                         CXX_STANDARD_REQUIRED ON
+                                         CXX_EXTENSIONS OFF)
+
+if (MSVC)
+    set_target_properties(wxbench PROPERTIES LINK_FLAGS "/ignore:4099")
+endif()
+
+target_compile_definitions(wxbench PRIVATE SCWX_TEST_DATA_DIR="${SCWX_DIR}/test/data")
+
+if (MSVC)
+    # Don't include Windows macros
+    target_compile_options(wxbench PRIVATE -DNOMINMAX)
+
+    # Enable multi-processor compilation
+    target_compile_options(wxbench PRIVATE "/MP")
+endif()
+
+# Benchmarks are run manually, and are not registered as tests
+target_link_libraries(wxbench benchmark::benchmark
+                              scwx-qt
+                              wxdata)
@@ -5,6 +5,7 @@
 #include <execution>
 #include <istream>
 #include <map>
+#include <span>
 #include <string>
 
 #ifdef _WIN32
@@ -125,6 +126,15 @@ public:
                      [](std::uint16_t u) { return ntohs(u); });
    }
 
+   static void SwapSpan(std::span<std::uint16_t> s)
+   {
+      std::transform(std::execution::par_unseq,
+                     s.begin(),
+                     s.end(),
+                     s.begin(),
+                     [](std::uint16_t u) { return ntohs(u); });
+   }
+
 private:
    std::unique_ptr<MessageImpl> p;
 };
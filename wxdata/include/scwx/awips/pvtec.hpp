@@ -5,6 +5,8 @@
 
 #include <chrono>
 #include <memory>
+#include <string>
+#include <string_view>
 
 namespace scwx
 {
@@ -59,7 +61,7 @@ public:
    std::chrono::system_clock::time_point event_begin() const;
    std::chrono::system_clock::time_point event_end() const;
 
-   bool Parse(const std::string& s);
+   bool Parse(std::string_view s);
 
    static ProductType        GetProductType(const std::string& code);
    static const std::string& GetProductTypeCode(ProductType productType);
@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace scwx
 {
@@ -30,6 +31,7 @@ public:
 
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
+   bool LoadData(std::string_view data);
 
 private:
    std::unique_ptr<TextProductFileImpl> p;
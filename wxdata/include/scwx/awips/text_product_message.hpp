@@ -12,18 +12,26 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace scwx
 {
 namespace awips
 {
 
+/**
+ * A VTEC string of a segment header. The H-VTEC string is a view into the
+ * message buffer, and remains valid for the lifetime of the buffer reference
+ * held by the VTEC string. Views copied out of the VTEC string must not
+ * outlive it.
+ */
 struct Vtec
 {
-   PVtec       pVtec_;
-   std::string hVtec_;
+   std::shared_ptr<const std::string> buffer_;
+   PVtec                              pVtec_;
+   std::string_view                   hVtec_;
 
-   Vtec() : pVtec_ {}, hVtec_ {} {}
+   Vtec() : buffer_ {}, pVtec_ {}, hVtec_ {} {}
 
    Vtec(const Vtec&)            = delete;
    Vtec& operator=(const Vtec&) = delete;
@@ -32,15 +40,23 @@ struct Vtec
    Vtec& operator=(Vtec&&) noexcept = default;
 };
 
+/**
+ * The header of a segment. Text fields are views into the message buffer, and
+ * remain valid for the lifetime of the buffer reference held by the header,
+ * including after the header is moved out of its segment. Views copied out of
+ * the header must not outlive it.
+ */
 struct SegmentHeader
 {
-   std::vector<std::string> ugcString_;
-   Ugc                      ugc_;
-   std::vector<Vtec>        vtecString_;
-   std::vector<std::string> ugcNames_;
-   std::string              issuanceDateTime_;
+   std::shared_ptr<const std::string> buffer_;
+   std::vector<std::string_view>      ugcString_;
+   Ugc                                ugc_;
+   std::vector<Vtec>                  vtecString_;
+   std::vector<std::string_view>      ugcNames_;
+   std::string_view                   issuanceDateTime_;
 
    SegmentHeader() :
+       buffer_ {},
        ugcString_ {},
        ugc_ {},
        vtecString_ {},
@@ -56,11 +72,17 @@ struct SegmentHeader
    SegmentHeader& operator=(SegmentHeader&&) noexcept = default;
 };
 
+/**
+ * A segment of a text product. Text fields are views into the message buffer,
+ * which is shared by each segment of the message. Views copied out of the
+ * segment must not outlive it.
+ */
 struct Segment
 {
+   std::shared_ptr<const std::string>     buffer_ {};
    std::shared_ptr<WmoHeader>             wmoHeader_ {};
    std::optional<SegmentHeader>           header_ {};
-   std::vector<std::string>               productContent_ {};
+   std::vector<std::string_view>          productContent_ {};
    std::optional<CodedLocation>           codedLocation_ {};
    std::optional<CodedTimeMotionLocation> codedMotion_ {};
 
@@ -109,7 +131,26 @@ public:
 
    bool Parse(std::istream& is) override;
 
+   /**
+    * @brief Parse a message from the beginning of the data, advancing the data
+    * past the message. The message copies the bytes it consumed into a single
+    * buffer, so the data does not need to outlive the message.
+    */
+   bool Parse(std::string_view& data);
+
+   /**
+    * @brief Parse a message from the beginning of the data, advancing the data
+    * past the message. The data must be a view into the buffer, which the
+    * message shares instead of copying the bytes it consumed.
+    */
+   bool Parse(std::string_view&                         data,
+              const std::shared_ptr<const std::string>& buffer);
+
    static std::shared_ptr<TextProductMessage> Create(std::istream& is);
+   static std::shared_ptr<TextProductMessage> Create(std::string_view& data);
+   static std::shared_ptr<TextProductMessage>
+   Create(std::string_view&                         data,
+          const std::shared_ptr<const std::string>& buffer);
 
 private:
    std::unique_ptr<TextProductMessageImpl> p;
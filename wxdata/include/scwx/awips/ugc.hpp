@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -28,6 +29,7 @@ public:
    std::string              product_expiration() const;
 
    bool Parse(const std::vector<std::string>& ugcString);
+   bool Parse(const std::vector<std::string_view>& ugcString);
 
 private:
    std::unique_ptr<UgcImpl> p;
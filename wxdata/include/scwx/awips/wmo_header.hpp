@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace scwx
 {
@@ -47,9 +48,24 @@ public:
 
    bool Parse(std::istream& is);
 
+   /**
+    * @brief Parse the header from the beginning of the data, advancing the
+    * data past the header.
+    */
+   bool Parse(std::string_view& data);
+
 private:
    std::unique_ptr<WmoHeaderImpl> p;
 };
 
+template<class Key>
+struct WmoHeaderHash;
+
+template<>
+struct WmoHeaderHash<WmoHeader>
+{
+   size_t operator()(const WmoHeader& x) const;
+};
+
 } // namespace awips
 } // namespace scwx
@@ -59,6 +59,8 @@ public:
       std::size_t hotX_ {};
       std::size_t hotY_ {};
       std::string filename_ {};
+
+      bool operator==(const IconFile&) const = default;
    };
 
    struct Font
@@ -78,12 +80,16 @@ public:
       units::length::nautical_miles<double>       threshold_ {};
       std::chrono::sys_time<std::chrono::seconds> startTime_ {};
       std::chrono::sys_time<std::chrono::seconds> endTime_ {};
+
+      bool operator==(const DrawItem&) const = default;
    };
 
    struct IconDrawItem : DrawItem
    {
       IconDrawItem() { itemType_ = ItemType::Icon; }
 
+      bool operator==(const IconDrawItem&) const = default;
+
       boost::gil::rgba8_pixel_t modulate_ {};
       double                    latitude_ {};
       double                    longitude_ {};
@@ -99,6 +105,8 @@ public:
    {
       TextDrawItem() { itemType_ = ItemType::Text; }
 
+      bool operator==(const TextDrawItem&) const = default;
+
       boost::gil::rgba8_pixel_t color_ {};
       double                    latitude_ {};
       double                    longitude_ {};
@@ -113,6 +121,8 @@ public:
    {
       LineDrawItem() { itemType_ = ItemType::Line; }
 
+      bool operator==(const LineDrawItem&) const = default;
+
       boost::gil::rgba8_pixel_t color_ {};
       double                    width_ {};
       std::int32_t              flags_ {};
@@ -124,6 +134,8 @@ public:
          double longitude_ {};
          double x_ {};
          double y_ {};
+
+         bool operator==(const Element&) const = default;
       };
 
       std::vector<Element> elements_ {};
@@ -133,6 +145,8 @@ public:
    {
       TrianglesDrawItem() { itemType_ = ItemType::Triangles; }
 
+      bool operator==(const TrianglesDrawItem&) const = default;
+
       boost::gil::rgba8_pixel_t color_ {};
 
       struct Element
@@ -143,6 +157,8 @@ public:
          double y_ {};
 
          std::optional<boost::gil::rgba8_pixel_t> color_ {};
+
+         bool operator==(const Element&) const = default;
       };
 
       std::vector<Element> elements_ {};
@@ -152,6 +168,8 @@ public:
    {
       ImageDrawItem() { itemType_ = ItemType::Image; }
 
+      bool operator==(const ImageDrawItem&) const = default;
+
       std::string imageFile_ {};
 
       struct Element
@@ -162,6 +180,8 @@ public:
          double y_ {};
          double tu_ {};
          double tv_ {};
+
+         bool operator==(const Element&) const = default;
       };
 
       std::vector<Element> elements_ {};
@@ -171,6 +191,8 @@ public:
    {
       PolygonDrawItem() { itemType_ = ItemType::Polygon; }
 
+      bool operator==(const PolygonDrawItem&) const = default;
+
       boost::gil::rgba8_pixel_t color_ {};
 
       struct Element
@@ -181,6 +203,8 @@ public:
          double y_ {};
 
          std::optional<boost::gil::rgba8_pixel_t> color_ {};
+
+         bool operator==(const Element&) const = default;
       };
 
       std::vector<std::vector<Element>> contours_ {};
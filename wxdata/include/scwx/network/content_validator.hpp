@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpr/cprtypes.h>
+#include <cpr/response.h>
+
+namespace scwx
+{
+namespace network
+{
+
+/**
+ * @brief Content Validator
+ *
+ * Tracks the HTTP validators and digest of the most recently accepted content
+ * of a resource, so that refreshing unchanged content can be detected without
+ * processing the content again. Content is unchanged if the server responds
+ * to a conditional request with 304 Not Modified, or if the content has the
+ * same digest as the accepted content.
+ */
+class ContentValidator
+{
+public:
+   enum class Status
+   {
+      Modified,
+      NotModified,
+      Error
+   };
+
+   struct Validators
+   {
+      std::string               etag_ {};
+      std::string               lastModified_ {};
+      std::vector<std::uint8_t> digest_ {};
+   };
+
+   explicit ContentValidator();
+   ~ContentValidator();
+
+   ContentValidator(const ContentValidator&)            = delete;
+   ContentValidator& operator=(const ContentValidator&) = delete;
+
+   ContentValidator(ContentValidator&&) noexcept;
+   ContentValidator& operator=(ContentValidator&&) noexcept;
+
+   /**
+    * Adds the headers making a request conditional on the content having
+    * changed since it was accepted.
+    *
+    * @param [in,out] header Request header
+    */
+   void AddConditionalHeaders(::cpr::Header& header) const;
+
+   /**
+    * Checks whether content differs from the accepted content.
+    *
+    * @param [in] content Content
+    * @param [out] validators Digest of the content
+    *
+    * @return Modified or NotModified, or Error if the digest could not be
+    * computed
+    */
+   Status CheckContent(const std::string& content,
+                       Validators&        validators) const;
+
+   /**
+    * Checks whether the content of a response differs from the accepted
+    * content.
+    *
+    * @param [in] response HTTP response
+    * @param [out] validators Validators and digest of the response
+    *
+    * @return NotModified for a 304 response, the result of checking the
+    * content for a successful response, and Error otherwise
+    */
+   Status CheckResponse(const ::cpr::Response& response,
+                        Validators&            validators) const;
+
+   /**
+    * Accepts modified content, replacing all validators.
+    *
+    * @param [in] validators Validators returned when checking the content
+    */
+   void Accept(Validators&& validators);
+
+   /**
+    * Refreshes unchanged content. The HTTP validators are replaced if the
+    * server provided new validators, and the digest is unchanged.
+    *
+    * @param [in] validators Validators returned when checking the content
+    */
+   void Refresh(Validators&& validators);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace network
+} // namespace scwx
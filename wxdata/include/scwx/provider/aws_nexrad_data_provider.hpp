@@ -44,7 +44,11 @@ public:
    std::tuple<bool, size_t, size_t>
    ListObjects(std::chrono::system_clock::time_point date) override;
    std::shared_ptr<wsr88d::NexradFile>
-                             LoadObjectByKey(const std::string& key) override;
+   LoadObjectByKey(const std::string& key) override;
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key,
+                   const wsr88d::NexradFileFactory::ElevationScanCallback&
+                      elevationScanCallback) override;
    std::pair<size_t, size_t> Refresh() override;
 
 protected:
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <scwx/wsr88d/nexrad_file.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
 
 #include <chrono>
 #include <memory>
@@ -81,6 +81,21 @@ public:
    virtual std::shared_ptr<wsr88d::NexradFile>
    LoadObjectByKey(const std::string& key) = 0;
 
+   /**
+    * Loads a NEXRAD file object by the given key. For Level 2 data, the
+    * callback is invoked as each elevation scan becomes available, before the
+    * object has been completely loaded.
+    *
+    * @param key NEXRAD data key
+    * @param elevationScanCallback Elevation scan available callback
+    *
+    * @return NEXRAD data
+    */
+   virtual std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key,
+                   const wsr88d::NexradFileFactory::ElevationScanCallback&
+                      elevationScanCallback) = 0;
+
    /**
     * Lists NEXRAD objects for the current date, and adds them to the cache. If
     * no objects have been added to the cache for the current date, the previous
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief NEXRAD Object Cache
+ *
+ * Stores downloaded NEXRAD objects on disk, so they do not need to be
+ * downloaded again after they are evicted from memory, or after a restart.
+ * Each object is stored in a file named by a digest of its bucket and key.
+ * Objects are evicted in least recently used order when the cache exceeds its
+ * maximum size. The order is persisted in an index file in the cache
+ * directory.
+ */
+class NexradObjectCache
+{
+public:
+   explicit NexradObjectCache();
+   ~NexradObjectCache();
+
+   NexradObjectCache(const NexradObjectCache&)            = delete;
+   NexradObjectCache& operator=(const NexradObjectCache&) = delete;
+
+   NexradObjectCache(NexradObjectCache&&) noexcept            = delete;
+   NexradObjectCache& operator=(NexradObjectCache&&) noexcept = delete;
+
+   /**
+    * Gets whether a cache directory has been set.
+    */
+   bool enabled() const;
+
+   std::size_t max_size() const;
+   std::size_t object_count() const;
+   std::size_t size() const;
+
+   /**
+    * Gets the cached file for an object, and marks the object as most recently
+    * used.
+    *
+    * @param [in] bucket Bucket name
+    * @param [in] key Object key
+    *
+    * @return Path to the cached file, or std::nullopt if the object is not
+    * cached
+    */
+   std::optional<std::string> Find(const std::string& bucket,
+                                   const std::string& key);
+
+   /**
+    * Writes the index file, if the least recently used order has changed.
+    */
+   void Flush();
+
+   /**
+    * Removes an object from the cache.
+    *
+    * @param [in] bucket Bucket name
+    * @param [in] key Object key
+    */
+   void Remove(const std::string& bucket, const std::string& key);
+
+   /**
+    * Sets the cache directory, and reads the index file. Files in the
+    * directory which are not present in the index are added as the least
+    * recently used objects. An empty directory disables the cache.
+    *
+    * @param [in] directory Cache directory
+    */
+   void SetDirectory(const std::string& directory);
+
+   /**
+    * Sets the maximum size of the cache, evicting objects if necessary.
+    *
+    * @param [in] maxSize Maximum size, in bytes
+    */
+   void SetMaxSize(std::size_t maxSize);
+
+   /**
+    * Stores an object in the cache.
+    *
+    * @param [in] bucket Bucket name
+    * @param [in] key Object key
+    * @param [in] data Object data
+    *
+    * @return true if the object was stored
+    */
+   bool Store(const std::string&    bucket,
+              const std::string&    key,
+              std::span<const char> data);
+
+   /**
+    * Gets the name of the file an object is stored in.
+    *
+    * @param [in] bucket Bucket name
+    * @param [in] key Object key
+    *
+    * @return Object file name
+    */
+   static std::string GetObjectName(const std::string& bucket,
+                                    const std::string& key);
+
+   static NexradObjectCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
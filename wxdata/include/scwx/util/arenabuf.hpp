@@ -0,0 +1,38 @@
+#pragma once
+
+#include <scwx/util/vectorbuf.hpp>
+
+#include <memory>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Stream buffer over a shared, contiguous block of memory. Parsers
+ * reading from an arenabuf may retain views into the arena instead of copying
+ * data out of the stream, as long as they also retain the arena itself.
+ */
+class arenabuf : public vectorbuf
+{
+public:
+   explicit arenabuf(std::shared_ptr<std::vector<char>> arena);
+   ~arenabuf() = default;
+
+   arenabuf(const arenabuf&)            = delete;
+   arenabuf& operator=(const arenabuf&) = delete;
+
+   const std::shared_ptr<std::vector<char>>& arena() const;
+
+   /**
+    * Returns a pointer to the current read position within the arena.
+    */
+   char* current() const;
+
+private:
+   std::shared_ptr<std::vector<char>> arena_;
+};
+
+} // namespace util
+} // namespace scwx
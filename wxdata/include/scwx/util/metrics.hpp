@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * A monotonically increasing count, safe to increment from any thread.
+ */
+class Counter
+{
+public:
+   explicit Counter(const std::string& name);
+   ~Counter();
+
+   Counter(const Counter&)            = delete;
+   Counter& operator=(const Counter&) = delete;
+
+   const std::string& name() const;
+   std::uint64_t      value() const;
+
+   void Increment(std::uint64_t n = 1)
+   {
+      value_.fetch_add(n, std::memory_order_relaxed);
+   }
+
+   void Reset();
+
+private:
+   const std::string          name_;
+   std::atomic<std::uint64_t> value_ {0};
+};
+
+/**
+ * A distribution of durations, safe to record from any thread. Samples are
+ * counted in logarithmic buckets with four linear sub-buckets each, so
+ * percentiles are estimated to within 25% without storing each sample.
+ */
+class Histogram
+{
+public:
+   struct Snapshot
+   {
+      std::string              name_ {};
+      std::uint64_t            count_ {};
+      std::chrono::nanoseconds total_ {};
+      std::chrono::nanoseconds min_ {};
+      std::chrono::nanoseconds max_ {};
+      std::chrono::nanoseconds mean_ {};
+      std::chrono::nanoseconds p50_ {};
+      std::chrono::nanoseconds p90_ {};
+      std::chrono::nanoseconds p99_ {};
+   };
+
+   explicit Histogram(const std::string& name);
+   ~Histogram();
+
+   Histogram(const Histogram&)            = delete;
+   Histogram& operator=(const Histogram&) = delete;
+
+   const std::string& name() const;
+
+   void     Record(std::chrono::nanoseconds duration);
+   void     Reset();
+   Snapshot GetSnapshot() const;
+
+private:
+   static constexpr std::size_t kBucketCount_ = 252u;
+
+   const std::string                                     name_;
+   std::array<std::atomic<std::uint64_t>, kBucketCount_> buckets_ {};
+   std::atomic<std::uint64_t>                            total_ {0};
+   std::atomic<std::uint64_t>                            min_ {UINT64_MAX};
+   std::atomic<std::uint64_t>                            max_ {0};
+};
+
+/**
+ * Records the lifetime of the timer into a histogram.
+ */
+class ScopedTimer
+{
+public:
+   explicit ScopedTimer(Histogram& histogram);
+   ~ScopedTimer();
+
+   ScopedTimer(const ScopedTimer&)            = delete;
+   ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+   /**
+    * Records the elapsed time now instead of on destruction.
+    */
+   void Stop();
+
+private:
+   Histogram*                            histogram_;
+   std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * Registry of named counters and histograms. Metrics are created on first
+ * use, and remain valid for the lifetime of the program, so hot paths should
+ * look them up once and keep the reference.
+ */
+class MetricsRegistry
+{
+public:
+   struct CounterSnapshot
+   {
+      std::string   name_ {};
+      std::uint64_t value_ {};
+   };
+
+   explicit MetricsRegistry();
+   ~MetricsRegistry();
+
+   MetricsRegistry(const MetricsRegistry&)            = delete;
+   MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+   Counter&   GetCounter(const std::string& name);
+   Histogram& GetHistogram(const std::string& name);
+
+   /**
+    * Returns the current value of each counter, sorted by name.
+    */
+   std::vector<CounterSnapshot> GetCounterSnapshots() const;
+
+   /**
+    * Returns the current distribution of each histogram, sorted by name.
+    */
+   std::vector<Histogram::Snapshot> GetHistogramSnapshots() const;
+
+   /**
+    * Resets all counters and histograms to zero.
+    */
+   void Reset();
+
+   static MetricsRegistry& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
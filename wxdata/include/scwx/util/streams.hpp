@@ -1,6 +1,7 @@
 #pragma once
 
 #include <istream>
+#include <string_view>
 
 namespace scwx
 {
@@ -9,5 +10,18 @@ namespace util
 
 std::istream& getline(std::istream& is, std::string& t);
 
+/**
+ * @brief Read a line from a string view, without copying
+ *
+ * Line endings are handled the same as the stream overload. The line
+ * references the input data, and the data is advanced past the line ending.
+ *
+ * @param [in,out] data Input data
+ * @param [out] line Line view, excluding the line ending
+ *
+ * @return false if the data was empty, otherwise true
+ */
+bool getline(std::string_view& data, std::string_view& line);
+
 } // namespace util
 } // namespace scwx
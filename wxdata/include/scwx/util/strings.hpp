@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <initializer_list>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -39,6 +41,32 @@ std::vector<std::string> ParseTokens(const std::string&       s,
                                      std::vector<std::string> delimiters,
                                      std::size_t              pos = 0);
 
+/**
+ * @brief Parse a list of tokens from a string, without copying
+ *
+ * Behaves as ParseTokens, but returns views into the input string. The input
+ * string must outlive the returned tokens.
+ *
+ * @param [in] s Input string to tokenize
+ * @param [in] delimiters A list of delimiters to use for each token.
+ * @param [in] pos Search begin position. Default is 0.
+ *
+ * @return Tokenized string views
+ */
+std::vector<std::string_view>
+ParseTokenViews(std::string_view                        s,
+                std::initializer_list<std::string_view> delimiters,
+                std::size_t                             pos = 0);
+
+/**
+ * @brief Remove leading and trailing whitespace from a string view
+ *
+ * @param [in] s Input string view
+ *
+ * @return Trimmed string view
+ */
+std::string_view TrimWhitespace(std::string_view s);
+
 std::string ToString(const std::vector<std::string>& v);
 
 template<typename T>
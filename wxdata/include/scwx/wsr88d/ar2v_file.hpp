@@ -5,6 +5,8 @@
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -23,6 +25,15 @@ class Ar2vFileImpl;
 class Ar2vFile : public NexradFile
 {
 public:
+   /**
+    * Invoked from the loading thread each time all radials of an elevation scan
+    * have been loaded, with the elevation cut in degrees. The elevation scan is
+    * available from GetElevationScan() by the time the callback is invoked.
+    * Radials received for an elevation scan after it has been announced are
+    * discarded, so an announced elevation scan is not modified.
+    */
+   typedef std::function<void(float elevationCut)> ElevationScanCallback;
+
    explicit Ar2vFile();
    ~Ar2vFile();
 
@@ -37,6 +48,7 @@ public:
    std::string   icao() const;
 
    std::size_t message_count() const;
+   std::size_t resident_bytes() const override;
 
    std::chrono::system_clock::time_point start_time() const;
    std::chrono::system_clock::time_point end_time() const;
@@ -50,6 +62,8 @@ public:
                     float                                 elevation,
                     std::chrono::system_clock::time_point time) const;
 
+   void SetElevationScanCallback(ElevationScanCallback callback);
+
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -24,6 +25,12 @@ protected:
 public:
    virtual ~NexradFile();
 
+   /**
+    * Gets an estimate of the memory used by the loaded product data, in bytes.
+    * The estimate may grow while data is being loaded.
+    */
+   virtual std::size_t resident_bytes() const = 0;
+
    virtual bool LoadFile(const std::string& filename) = 0;
    virtual bool LoadData(std::istream& is)            = 0;
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/nexrad_file.hpp>
 
+#include <functional>
+
 namespace scwx
 {
 namespace wsr88d
@@ -20,8 +23,18 @@ private:
    NexradFileFactory& operator=(NexradFileFactory&&) noexcept = delete;
 
 public:
+   /**
+    * Invoked as each elevation scan of an Archive II file becomes available,
+    * before the file has been completely loaded.
+    */
+   typedef std::function<void(const std::shared_ptr<Ar2vFile>& file,
+                              float                            elevationCut)>
+      ElevationScanCallback;
+
    static std::shared_ptr<NexradFile> Create(const std::string& filename);
-   static std::shared_ptr<NexradFile> Create(std::istream& is);
+   static std::shared_ptr<NexradFile>
+   Create(std::istream&                is,
+          const ElevationScanCallback& elevationScanCallback = {});
 };
 
 } // namespace wsr88d
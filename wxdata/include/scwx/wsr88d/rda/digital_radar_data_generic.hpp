@@ -2,6 +2,8 @@
 
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
 
+#include <span>
+
 namespace scwx
 {
 namespace wsr88d
@@ -130,6 +132,14 @@ public:
    float                    offset() const;
    const void*              data_moments() const;
 
+   /**
+    * Views of the data moment gates. When parsed from an arena buffer, these
+    * refer directly to the decompressed record data rather than owned storage.
+    * Only the view matching the data word size is populated.
+    */
+   std::span<const std::uint8_t>  data_moments8() const;
+   std::span<const std::uint16_t> data_moments16() const;
+
    static std::shared_ptr<MomentDataBlock>
    Create(const std::string& dataBlockType,
           const std::string& dataName,
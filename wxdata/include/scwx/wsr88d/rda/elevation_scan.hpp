@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+class GenericRadarData;
+
+/**
+ * An elevation scan, with radials addressed by azimuth index. Radial messages
+ * are stored in a flat array, alongside contiguous columns of the values most
+ * frequently accessed while generating a sweep. Slots for radials which have
+ * not been received contain nullptr, with an azimuth angle of NaN.
+ */
+class ElevationScan
+{
+public:
+   explicit ElevationScan();
+   ~ElevationScan();
+
+   ElevationScan(const ElevationScan&)            = delete;
+   ElevationScan& operator=(const ElevationScan&) = delete;
+
+   ElevationScan(ElevationScan&&) noexcept;
+   ElevationScan& operator=(ElevationScan&&) noexcept;
+
+   /**
+    * Gets the number of radial slots, one greater than the highest azimuth
+    * index received.
+    */
+   std::size_t size() const;
+
+   /**
+    * Gets the number of radials received.
+    */
+   std::size_t radial_count() const;
+
+   bool empty() const;
+   bool contains(std::uint16_t azimuthIndex) const;
+
+   /**
+    * Gets the radial at an azimuth index, or nullptr if the radial has not been
+    * received.
+    */
+   const std::shared_ptr<GenericRadarData>&
+   radial(std::uint16_t azimuthIndex) const;
+
+   /**
+    * Gets the first radial received, in azimuth index order.
+    */
+   const std::shared_ptr<GenericRadarData>& front() const;
+
+   /**
+    * Gets the last radial received, in azimuth index order.
+    */
+   const std::shared_ptr<GenericRadarData>& back() const;
+
+   std::span<const std::shared_ptr<GenericRadarData>> radials() const;
+   std::span<const float>                             azimuth_angles() const;
+   std::span<const float>                             elevation_angles() const;
+   std::span<const std::uint16_t> modified_julian_dates() const;
+   std::span<const std::uint32_t> collection_times() const;
+
+   void SetRadial(std::uint16_t                            azimuthIndex,
+                  const std::shared_ptr<GenericRadarData>& radial);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/util/iterator.hpp>
+#include <scwx/wsr88d/rda/elevation_scan.hpp>
 #include <scwx/wsr88d/rda/level2_message.hpp>
 
 #include <units/angle.h>
@@ -31,11 +32,6 @@ typedef util::
    Iterator<DataBlockType, DataBlockType::MomentRef, DataBlockType::MomentCfp>
       MomentDataBlockTypeIterator;
 
-class GenericRadarData;
-
-typedef std::map<std::uint16_t, std::shared_ptr<GenericRadarData>>
-   ElevationScan;
-
 class GenericRadarData : public Level2Message
 {
 public:
@@ -55,6 +51,7 @@ public:
    virtual units::degrees<float> azimuth_angle() const                  = 0;
    virtual std::uint16_t         azimuth_number() const                 = 0;
    virtual std::uint16_t         elevation_number() const               = 0;
+   virtual units::degrees<float> elevation_angle() const                = 0;
    virtual std::uint16_t         volume_coverage_pattern_number() const = 0;
 
    virtual std::shared_ptr<MomentDataBlock>
@@ -139,7 +139,7 @@ std::chrono::system_clock::time_point PVtec::event_end() const
    return p->eventEnd_;
 }
 
-bool PVtec::Parse(const std::string& s)
+bool PVtec::Parse(std::string_view s)
 {
    using namespace std::chrono;
 
@@ -168,15 +168,18 @@ bool PVtec::Parse(const std::string& s)
 
    if (dataValid)
    {
-      p->pVtecString_ = s.substr(0, pVtecLength_);
+      auto field = [&s](std::size_t offset, std::size_t length)
+      { return std::string {s.substr(offset, length)}; };
 
-      p->fixedIdentifier_ = GetProductType(s.substr(pVtecOffsetIdentifier_, 1));
-      p->action_          = GetAction(s.substr(pVtecOffsetAction_, 3));
-      p->officeId_        = s.substr(pVtecOffsetOfficeId_, 4);
-      p->phenomenon_      = GetPhenomenon(s.substr(pVtecOffsetPhenomenon_, 2));
-      p->significance_ = GetSignificance(s.substr(pVtecOffsetSignificance_, 1));
+      p->pVtecString_ = field(0, pVtecLength_);
 
-      std::string eventNumberString = s.substr(pVtecOffsetEventNumber_, 4);
+      p->fixedIdentifier_ = GetProductType(field(pVtecOffsetIdentifier_, 1));
+      p->action_          = GetAction(field(pVtecOffsetAction_, 3));
+      p->officeId_        = field(pVtecOffsetOfficeId_, 4);
+      p->phenomenon_      = GetPhenomenon(field(pVtecOffsetPhenomenon_, 2));
+      p->significance_ = GetSignificance(field(pVtecOffsetSignificance_, 1));
+
+      std::string eventNumberString = field(pVtecOffsetEventNumber_, 4);
 
       try
       {
@@ -194,8 +197,8 @@ bool PVtec::Parse(const std::string& s)
 
       static const std::string dateTimeFormat {"%y%m%dT%H%MZ"};
 
-      std::string sEventBegin = s.substr(pVtecOffsetEventBegin_, 12);
-      std::string sEventEnd   = s.substr(pVtecOffsetEventEnd_, 12);
+      std::string sEventBegin = field(pVtecOffsetEventBegin_, 12);
+      std::string sEventEnd   = field(pVtecOffsetEventEnd_, 12);
 
       std::istringstream ssEventBegin {sEventBegin};
       std::istringstream ssEventEnd {sEventEnd};
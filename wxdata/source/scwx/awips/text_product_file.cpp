@@ -1,7 +1,10 @@
 #include <scwx/awips/text_product_file.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
+#include <unordered_map>
 
 namespace scwx
 {
@@ -14,10 +17,18 @@ static const auto        logger_    = util::Logger::Create(logPrefix_);
 class TextProductFileImpl
 {
 public:
-   explicit TextProductFileImpl() : messages_ {} {};
+   explicit TextProductFileImpl() : messages_ {}, wmoHeaderIndex_ {} {};
    ~TextProductFileImpl() = default;
 
+   bool IsDuplicate(const std::shared_ptr<TextProductMessage>& message) const;
+   bool LoadBuffer(const std::shared_ptr<const std::string>& buffer);
+
    std::vector<std::shared_ptr<TextProductMessage>> messages_;
+
+   // WMO headers of each message indexed by hash, used to detect duplicate
+   // messages
+   std::unordered_multimap<std::size_t, std::shared_ptr<WmoHeader>>
+      wmoHeaderIndex_;
 };
 
 TextProductFile::TextProductFile() : p(std::make_unique<TextProductFileImpl>())
@@ -66,29 +77,38 @@ bool TextProductFile::LoadFile(const std::string& filename)
 }
 
 bool TextProductFile::LoadData(std::istream& is)
+{
+   // Read the remainder of the stream into a single buffer shared by each
+   // message, and parse it in place
+   return p->LoadBuffer(std::make_shared<const std::string>(
+      std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()));
+}
+
+bool TextProductFile::LoadData(std::string_view data)
+{
+   return p->LoadBuffer(std::make_shared<const std::string>(data));
+}
+
+bool TextProductFileImpl::LoadBuffer(
+   const std::shared_ptr<const std::string>& buffer)
 {
    logger_->trace("Loading Data");
 
-   while (!is.eof())
+   std::string_view data {*buffer};
+
+   while (!data.empty())
    {
       std::shared_ptr<TextProductMessage> message =
-         TextProductMessage::Create(is);
-      bool duplicate = false;
+         TextProductMessage::Create(data, buffer);
 
       if (message != nullptr)
       {
-         for (auto m : p->messages_)
+         if (!IsDuplicate(message))
          {
-            if (*m->wmo_header().get() == *message->wmo_header().get())
-            {
-               duplicate = true;
-               break;
-            }
-         }
-
-         if (!duplicate)
-         {
-            p->messages_.push_back(message);
+            std::shared_ptr<WmoHeader> wmoHeader = message->wmo_header();
+            wmoHeaderIndex_.emplace(WmoHeaderHash<WmoHeader> {}(*wmoHeader),
+                                    std::move(wmoHeader));
+            messages_.push_back(message);
          }
       }
       else
@@ -97,7 +117,21 @@ bool TextProductFile::LoadData(std::istream& is)
       }
    }
 
-   return !p->messages_.empty();
+   return !messages_.empty();
+}
+
+bool TextProductFileImpl::IsDuplicate(
+   const std::shared_ptr<TextProductMessage>& message) const
+{
+   const std::shared_ptr<WmoHeader> wmoHeader = message->wmo_header();
+
+   auto [begin, end] =
+      wmoHeaderIndex_.equal_range(WmoHeaderHash<WmoHeader> {}(*wmoHeader));
+
+   return std::any_of(begin,
+                      end,
+                      [&wmoHeader](const auto& entry)
+                      { return *entry.second == *wmoHeader; });
 }
 
 } // namespace awips
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <istream>
+#include <iterator>
 #include <string>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -27,21 +28,29 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 // Look for hhmm (xM|UTC) to key the date/time string
 static constexpr LazyRE2 reDateTimeString = {"^[0-9]{3,4} ([AP]M|UTC)"};
 
+// Parsing functions operate on a view of the remaining message data, which is
+// advanced past each line that is consumed. Lines are returned as views into
+// the message data.
 static void ParseCodedInformation(std::shared_ptr<Segment> segment,
                                   const std::string&       wfo);
-static std::vector<std::string>     ParseProductContent(std::istream& is);
-static void                         SkipBlankLines(std::istream& is);
-static bool                         TryParseEndOfProduct(std::istream& is);
-static std::vector<std::string>     TryParseMndHeader(std::istream& is);
-static std::vector<std::string>     TryParseOverviewBlock(std::istream& is);
-static std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is);
-static std::optional<Vtec>          TryParseVtecString(std::istream& is);
+static std::vector<std::string_view>
+ParseProductContent(std::string_view& data);
+static void SkipBlankLines(std::string_view& data);
+static bool TryParseEndOfProduct(std::string_view& data);
+static std::vector<std::string_view>
+TryParseMndHeader(std::string_view& data);
+static std::vector<std::string_view>
+TryParseOverviewBlock(std::string_view& data);
+static std::optional<SegmentHeader>
+TryParseSegmentHeader(std::string_view& data);
+static std::optional<Vtec> TryParseVtecString(std::string_view& data);
 
 class TextProductMessageImpl
 {
 public:
    explicit TextProductMessageImpl() :
-       messageContent_ {},
+       buffer_ {},
+       message_ {},
        wmoHeader_ {},
        mndHeader_ {},
        overviewBlock_ {},
@@ -50,10 +59,14 @@ public:
    }
    ~TextProductMessageImpl() = default;
 
-   std::string                           messageContent_;
+   void SetBuffer(std::string_view                          message,
+                  const std::shared_ptr<const std::string>& buffer);
+
+   std::shared_ptr<const std::string>    buffer_;
+   std::string_view                      message_;
    std::shared_ptr<WmoHeader>            wmoHeader_;
-   std::vector<std::string>              mndHeader_;
-   std::vector<std::string>              overviewBlock_;
+   std::vector<std::string_view>         mndHeader_;
+   std::vector<std::string_view>         overviewBlock_;
    std::vector<std::shared_ptr<Segment>> segments_;
 };
 
@@ -69,7 +82,31 @@ TextProductMessage::operator=(TextProductMessage&&) noexcept = default;
 
 std::string TextProductMessage::message_content() const
 {
-   return p->messageContent_;
+   if (p->buffer_ == nullptr)
+   {
+      return {};
+   }
+
+   std::string_view rawContent {p->message_};
+
+   if (rawContent.starts_with(common::Characters::SOH))
+   {
+      rawContent.remove_prefix(1);
+   }
+
+   // Trim extra characters from raw message
+   while (!rawContent.empty() &&
+          (rawContent.back() == common::Characters::NUL ||
+           rawContent.back() == common::Characters::ETX))
+   {
+      rawContent.remove_suffix(1);
+   }
+
+   std::string messageContent {rawContent};
+   boost::replace_all(messageContent, "\r\r\n", "\n");
+   boost::trim(messageContent);
+
+   return messageContent;
 }
 
 std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
@@ -79,12 +116,12 @@ std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
 
 std::vector<std::string> TextProductMessage::mnd_header() const
 {
-   return p->mndHeader_;
+   return {p->mndHeader_.cbegin(), p->mndHeader_.cend()};
 }
 
 std::vector<std::string> TextProductMessage::overview_block() const
 {
-   return p->overviewBlock_;
+   return {p->overviewBlock_.cbegin(), p->overviewBlock_.cend()};
 }
 
 size_t TextProductMessage::segment_count() const
@@ -213,16 +250,43 @@ size_t TextProductMessage::data_size() const
 
 bool TextProductMessage::Parse(std::istream& is)
 {
-   bool dataValid = true;
+   // Read the remainder of the stream into a buffer shared by the message, and
+   // return the unused portion to the stream after parsing
+   const std::streampos messageStart = is.tellg();
+   const auto           buffer       = std::make_shared<const std::string>(
+      std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+   std::string_view remaining {*buffer};
+
+   const bool dataValid = Parse(remaining, buffer);
+
+   is.clear();
+   is.seekg(messageStart +
+            static_cast<std::streamoff>(buffer->size() - remaining.size()));
+
+   if (remaining.empty())
+   {
+      is.setstate(std::ios_base::eofbit);
+   }
+
+   return dataValid;
+}
+
+bool TextProductMessage::Parse(std::string_view& data)
+{
+   return Parse(data, nullptr);
+}
 
-   std::streampos messageStart = is.tellg();
+bool TextProductMessage::Parse(std::string_view&                         data,
+                               const std::shared_ptr<const std::string>& buffer)
+{
+   const std::string_view messageData = data;
 
-   p->wmoHeader_ = std::make_shared<WmoHeader>();
-   dataValid     = p->wmoHeader_->Parse(is);
+   p->wmoHeader_  = std::make_shared<WmoHeader>();
+   bool dataValid = p->wmoHeader_->Parse(data);
 
-   for (size_t i = 0; dataValid && !is.eof(); i++)
+   for (size_t i = 0; dataValid && !data.empty(); i++)
    {
-      if (i != 0 && TryParseEndOfProduct(is))
+      if (i != 0 && TryParseEndOfProduct(data))
       {
          break;
       }
@@ -232,32 +296,32 @@ bool TextProductMessage::Parse(std::istream& is)
 
       if (i == 0)
       {
-         if (is.peek() != '\r')
+         if (!data.starts_with('\r'))
          {
-            segment->header_ = TryParseSegmentHeader(is);
+            segment->header_ = TryParseSegmentHeader(data);
          }
 
-         SkipBlankLines(is);
+         SkipBlankLines(data);
 
-         p->mndHeader_ = TryParseMndHeader(is);
-         SkipBlankLines(is);
+         p->mndHeader_ = TryParseMndHeader(data);
+         SkipBlankLines(data);
 
          // Optional overview block appears between MND and segment header
          if (!segment->header_.has_value())
          {
-            p->overviewBlock_ = TryParseOverviewBlock(is);
-            SkipBlankLines(is);
+            p->overviewBlock_ = TryParseOverviewBlock(data);
+            SkipBlankLines(data);
          }
       }
 
       if (!segment->header_.has_value())
       {
-         segment->header_ = TryParseSegmentHeader(is);
-         SkipBlankLines(is);
+         segment->header_ = TryParseSegmentHeader(data);
+         SkipBlankLines(data);
       }
 
-      segment->productContent_ = ParseProductContent(is);
-      SkipBlankLines(is);
+      segment->productContent_ = ParseProductContent(data);
+      SkipBlankLines(data);
 
       ParseCodedInformation(segment, p->wmoHeader_->icao());
 
@@ -269,59 +333,96 @@ bool TextProductMessage::Parse(std::istream& is)
 
    if (dataValid)
    {
-      // Store raw message content
-      if (is.good())
+      p->SetBuffer(messageData.substr(0, messageData.size() - data.size()),
+                   buffer);
+   }
+   else
+   {
+      p->buffer_.reset();
+      p->message_ = {};
+   }
+
+   return dataValid;
+}
+
+void TextProductMessageImpl::SetBuffer(
+   std::string_view message, const std::shared_ptr<const std::string>& buffer)
+{
+   if (buffer != nullptr)
+   {
+      // Views already reference the shared buffer
+      for (auto& segment : segments_)
       {
-         // Read content equal to the message size
-         std::streampos  messageEnd  = is.tellg();
-         std::streamsize messageSize = messageEnd - messageStart;
-         p->messageContent_.resize(messageEnd - messageStart);
-         is.seekg(messageStart);
-         if (is.peek() == common::Characters::SOH)
+         segment->buffer_ = buffer;
+
+         if (segment->header_.has_value())
          {
-            is.seekg(std::streamoff {1}, std::ios_base::cur);
-            messageSize--;
+            segment->header_->buffer_ = buffer;
+
+            for (auto& vtec : segment->header_->vtecString_)
+            {
+               vtec.buffer_ = buffer;
+            }
          }
-         is.read(p->messageContent_.data(), messageSize);
+      }
+
+      buffer_  = buffer;
+      message_ = message;
+      return;
+   }
+
+   // Copy the message into a single buffer shared by each segment, and update
+   // each view to reference the buffer instead of the input data
+   auto copy = std::make_shared<const std::string>(message);
+
+   const char* const inputBegin  = message.data();
+   const char* const bufferBegin = copy->data();
+
+   auto rebase = [&](std::string_view& view)
+   {
+      if (view.empty())
+      {
+         view = {};
       }
       else
       {
-         // Read remaining content in the input stream
-         is.clear();
-         is.seekg(messageStart);
-         if (is.peek() == common::Characters::SOH)
-         {
-            is.seekg(std::streamoff {1}, std::ios_base::cur);
-         }
-
-         constexpr std::istreambuf_iterator<char> eos;
-         p->messageContent_ = {std::istreambuf_iterator<char>(is), eos};
+         view = {bufferBegin + (view.data() - inputBegin), view.size()};
       }
+   };
+
+   std::ranges::for_each(mndHeader_, rebase);
+   std::ranges::for_each(overviewBlock_, rebase);
 
-      // Trim extra characters from raw message
-      while (p->messageContent_.size() > 0 &&
-             (p->messageContent_.back() == common::Characters::NUL ||
-              p->messageContent_.back() == common::Characters::ETX))
+   for (auto& segment : segments_)
+   {
+      segment->buffer_ = copy;
+
+      if (segment->header_.has_value())
       {
-         p->messageContent_.resize(p->messageContent_.size() - 1);
+         segment->header_->buffer_ = copy;
+
+         std::ranges::for_each(segment->header_->ugcString_, rebase);
+         std::ranges::for_each(segment->header_->ugcNames_, rebase);
+         rebase(segment->header_->issuanceDateTime_);
+
+         for (auto& vtec : segment->header_->vtecString_)
+         {
+            vtec.buffer_ = copy;
+            rebase(vtec.hVtec_);
+         }
       }
-      boost::replace_all(p->messageContent_, "\r\r\n", "\n");
-      boost::trim(p->messageContent_);
-      p->messageContent_.shrink_to_fit();
-   }
-   else
-   {
-      p->messageContent_.resize(0);
-      p->messageContent_.shrink_to_fit();
+
+      std::ranges::for_each(segment->productContent_, rebase);
    }
 
-   return dataValid;
+   buffer_  = std::move(copy);
+   message_ = *buffer_;
 }
 
 void ParseCodedInformation(std::shared_ptr<Segment> segment,
                            const std::string&       wfo)
 {
-   typedef std::vector<std::string>::const_iterator StringIterator;
+   typedef std::vector<std::string_view>::const_iterator StringIterator;
 
    static constexpr std::size_t kThreatCategoryTagCount = 4;
    static const std::array<std::string, kThreatCategoryTagCount>
@@ -331,7 +432,7 @@ void ParseCodedInformation(std::shared_ptr<Segment> segment,
                            "TORNADO DAMAGE THREAT..."};
    std::array<std::string, kThreatCategoryTagCount>::const_iterator threatTagIt;
 
-   std::vector<std::string>& productContent = segment->productContent_;
+   std::vector<std::string_view>& productContent = segment->productContent_;
 
    StringIterator codedLocationBegin = productContent.cend();
    StringIterator codedLocationEnd   = productContent.cend();
@@ -386,8 +487,8 @@ void ParseCodedInformation(std::shared_ptr<Segment> segment,
                                            })) != kThreatCategoryTags.cend() &&
                it->length() > threatTagIt->length())
       {
-         const std::string threatCategoryName =
-            it->substr(threatTagIt->length());
+         const std::string threatCategoryName {
+            it->substr(threatTagIt->length())};
 
          ibw::ThreatCategory threatCategory =
             ibw::GetThreatCategory(threatCategoryName);
@@ -412,27 +513,29 @@ void ParseCodedInformation(std::shared_ptr<Segment> segment,
       }
    }
 
+   // Coded information spans only a few lines, which are copied for parsing
    if (codedLocationBegin != productContent.cend())
    {
-      segment->codedLocation_ =
-         CodedLocation::Create({codedLocationBegin, codedLocationEnd}, wfo);
+      const std::vector<std::string> lines {codedLocationBegin,
+                                            codedLocationEnd};
+      segment->codedLocation_ = CodedLocation::Create(lines, wfo);
    }
 
    if (codedMotionBegin != productContent.cend())
    {
-      segment->codedMotion_ = CodedTimeMotionLocation::Create(
-         {codedMotionBegin, codedMotionEnd}, wfo);
+      const std::vector<std::string> lines {codedMotionBegin, codedMotionEnd};
+      segment->codedMotion_ = CodedTimeMotionLocation::Create(lines, wfo);
    }
 }
 
-std::vector<std::string> ParseProductContent(std::istream& is)
+std::vector<std::string_view> ParseProductContent(std::string_view& data)
 {
-   std::vector<std::string> productContent;
-   std::string              line;
+   std::vector<std::string_view> productContent;
+   std::string_view              line;
 
-   while (!is.eof() && is.peek() != common::Characters::ETX)
+   while (!data.empty() && !data.starts_with(common::Characters::ETX))
    {
-      util::getline(is, line);
+      util::getline(data, line);
 
       if (!productContent.empty() || !line.starts_with("$$"))
       {
@@ -454,28 +557,28 @@ std::vector<std::string> ParseProductContent(std::istream& is)
    return productContent;
 }
 
-void SkipBlankLines(std::istream& is)
+void SkipBlankLines(std::string_view& data)
 {
-   std::string line;
+   std::string_view line;
 
-   while (is.peek() == '\r')
+   while (data.starts_with('\r'))
    {
-      util::getline(is, line);
+      util::getline(data, line);
    }
 }
 
-bool TryParseEndOfProduct(std::istream& is)
+bool TryParseEndOfProduct(std::string_view& data)
 {
-   std::string    line;
-   std::streampos isBegin     = is.tellg();
-   bool           endOfStream = false;
+   std::string_view line;
+   std::string_view dataBegin   = data;
+   bool             endOfStream = false;
 
-   if (is.peek() == common::Characters::ETX)
+   if (data.starts_with(common::Characters::ETX))
    {
-      is.get();
+      data.remove_prefix(1);
       endOfStream = true;
    }
-   else if (is.peek() == EOF)
+   else if (data.empty())
    {
       endOfStream = true;
    }
@@ -483,15 +586,15 @@ bool TryParseEndOfProduct(std::istream& is)
    if (!endOfStream)
    {
       // Optional Forecast Identifier
-      util::getline(is, line);
-      SkipBlankLines(is);
+      util::getline(data, line);
+      SkipBlankLines(data);
 
-      if (is.peek() == common::Characters::ETX)
+      if (data.starts_with(common::Characters::ETX))
       {
-         is.get();
+         data.remove_prefix(1);
          endOfStream = true;
       }
-      else if (is.peek() == EOF)
+      else if (data.empty())
       {
          endOfStream = true;
       }
@@ -499,23 +602,22 @@ bool TryParseEndOfProduct(std::istream& is)
 
    if (!endOfStream)
    {
-      // End of Product was not found, so reset the istream to the original
-      // state
-      is.seekg(isBegin, std::ios_base::beg);
+      // End of Product was not found, so reset the data to the original state
+      data = dataBegin;
    }
 
    return endOfStream;
 }
 
-std::vector<std::string> TryParseMndHeader(std::istream& is)
+std::vector<std::string_view> TryParseMndHeader(std::string_view& data)
 {
-   std::vector<std::string> mndHeader;
-   std::string              line;
-   std::streampos           isBegin = is.tellg();
+   std::vector<std::string_view> mndHeader;
+   std::string_view              line;
+   std::string_view              dataBegin = data;
 
-   while (!is.eof() && is.peek() != '\r')
+   while (!data.empty() && !data.starts_with('\r'))
    {
-      util::getline(is, line);
+      util::getline(data, line);
       mndHeader.push_back(line);
    }
 
@@ -528,27 +630,27 @@ std::vector<std::string> TryParseMndHeader(std::istream& is)
 
    if (mndHeader.empty())
    {
-      // MND header was not found, so reset the istream to the original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // MND header was not found, so reset the data to the original state
+      data = dataBegin;
    }
 
    return mndHeader;
 }
 
-std::vector<std::string> TryParseOverviewBlock(std::istream& is)
+std::vector<std::string_view> TryParseOverviewBlock(std::string_view& data)
 {
    // Optional overview block contains text in the following format:
    // ...OVERVIEW HEADLINE... /OPTIONAL/
    // .OVERVIEW WITH GENERAL INFORMATION / OPTIONAL /
    // Key off the block beginning with .
-   std::vector<std::string> overviewBlock;
-   std::string              line;
+   std::vector<std::string_view> overviewBlock;
+   std::string_view              line;
 
-   if (is.peek() == '.')
+   if (data.starts_with('.'))
    {
-      while (!is.eof() && is.peek() != '\r')
+      while (!data.empty() && !data.starts_with('\r'))
       {
-         util::getline(is, line);
+         util::getline(data, line);
          overviewBlock.push_back(line);
       }
    }
@@ -556,7 +658,7 @@ std::vector<std::string> TryParseOverviewBlock(std::istream& is)
    return overviewBlock;
 }
 
-std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
+std::optional<SegmentHeader> TryParseSegmentHeader(std::string_view& data)
 {
    // UGC takes the form SSFNNN-NNN>NNN-SSFNNN-DDHHMM- (NWSI 10-1702)
    // Look for SSF(NNN)?[->] to key the UGC string
@@ -565,10 +667,10 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
    static constexpr LazyRE2 reUgcExpiration = {"[0-9]{6}-$"};
 
    std::optional<SegmentHeader> header = std::nullopt;
-   std::string                  line;
-   std::streampos               isBegin = is.tellg();
+   std::string_view             line;
+   std::string_view             dataBegin = data;
 
-   util::getline(is, line);
+   util::getline(data, line);
 
    if (RE2::PartialMatch(line, *reUgcString))
    {
@@ -576,10 +678,10 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
       header->ugcString_.push_back(line);
 
       // If UGC is multi-line, continue parsing
-      while (!is.eof() && is.peek() != '\r' &&
+      while (!data.empty() && !data.starts_with('\r') &&
              !RE2::PartialMatch(line, *reUgcExpiration))
       {
-         util::getline(is, line);
+         util::getline(data, line);
          header->ugcString_.push_back(line);
       }
 
@@ -590,21 +692,21 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
    if (header.has_value())
    {
       std::optional<Vtec> vtec;
-      while ((vtec = TryParseVtecString(is)) != std::nullopt)
+      while ((vtec = TryParseVtecString(data)) != std::nullopt)
       {
          header->vtecString_.push_back(std::move(*vtec));
       }
 
-      while (!is.eof() && is.peek() != '\r')
+      while (!data.empty() && !data.starts_with('\r'))
       {
-         util::getline(is, line);
+         util::getline(data, line);
          if (!RE2::PartialMatch(line, *reDateTimeString))
          {
             header->ugcNames_.push_back(line);
          }
          else
          {
-            header->issuanceDateTime_.swap(line);
+            header->issuanceDateTime_ = line;
             break;
          }
       }
@@ -612,15 +714,15 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
 
    if (!header.has_value())
    {
-      // We did not find a valid segment header, so we reset the istream to the
+      // We did not find a valid segment header, so we reset the data to the
       // original state
-      is.seekg(isBegin, std::ios_base::beg);
+      data = dataBegin;
    }
 
    return header;
 }
 
-std::optional<Vtec> TryParseVtecString(std::istream& is)
+std::optional<Vtec> TryParseVtecString(std::string_view& data)
 {
    // P-VTEC takes the form /k.aaa.cccc.pp.s.####.yymmddThhnnZB-yymmddThhnnZE/
    // (NWSI 10-1703)
@@ -633,10 +735,10 @@ std::optional<Vtec> TryParseVtecString(std::istream& is)
    static constexpr LazyRE2 reHVtecString = {"^/[A-Z0-9]{5}\\."};
 
    std::optional<Vtec> vtec = std::nullopt;
-   std::string         line;
-   std::streampos      isBegin = is.tellg();
+   std::string_view    line;
+   std::string_view    dataBegin = data;
 
-   util::getline(is, line);
+   util::getline(data, line);
 
    if (RE2::PartialMatch(line, *rePVtecString))
    {
@@ -645,19 +747,19 @@ std::optional<Vtec> TryParseVtecString(std::istream& is)
       vtec      = Vtec();
       vtecValid = vtec->pVtec_.Parse(line);
 
-      isBegin = is.tellg();
+      dataBegin = data;
 
-      util::getline(is, line);
+      util::getline(data, line);
 
       if (RE2::PartialMatch(line, *reHVtecString))
       {
-         vtec->hVtec_.swap(line);
+         vtec->hVtec_ = line;
       }
       else
       {
-         // H-VTEC was not found, so reset the istream to the beginning of
-         // the line
-         is.seekg(isBegin, std::ios_base::beg);
+         // H-VTEC was not found, so reset the data to the beginning of the
+         // line
+         data = dataBegin;
       }
 
       if (!vtecValid)
@@ -667,8 +769,8 @@ std::optional<Vtec> TryParseVtecString(std::istream& is)
    }
    else
    {
-      // P-VTEC was not found, so reset the istream to the original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // P-VTEC was not found, so reset the data to the original state
+      data = dataBegin;
    }
 
    return vtec;
@@ -687,5 +789,34 @@ std::shared_ptr<TextProductMessage> TextProductMessage::Create(std::istream& is)
    return message;
 }
 
+std::shared_ptr<TextProductMessage>
+TextProductMessage::Create(std::string_view& data)
+{
+   std::shared_ptr<TextProductMessage> message =
+      std::make_shared<TextProductMessage>();
+
+   if (!message->Parse(data))
+   {
+      message.reset();
+   }
+
+   return message;
+}
+
+std::shared_ptr<TextProductMessage>
+TextProductMessage::Create(std::string_view&                         data,
+                           const std::shared_ptr<const std::string>& buffer)
+{
+   std::shared_ptr<TextProductMessage> message =
+      std::make_shared<TextProductMessage>();
+
+   if (!message->Parse(data, buffer))
+   {
+      message.reset();
+   }
+
+   return message;
+}
+
 } // namespace awips
 } // namespace scwx
@@ -100,6 +100,12 @@ std::string Ugc::product_expiration() const
 }
 
 bool Ugc::Parse(const std::vector<std::string>& ugcString)
+{
+   return Parse(std::vector<std::string_view> {ugcString.cbegin(),
+                                               ugcString.cend()});
+}
+
+bool Ugc::Parse(const std::vector<std::string_view>& ugcString)
 {
    bool dataValid = false;
 
@@ -109,15 +115,9 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
    static constexpr LazyRE2 reSpecificFipsId = {"[0-9]{3}"};
    static constexpr LazyRE2 reProductExpiration = {"[0-9]{6}"};
 
-   std::stringstream ugcStream;
-   for (auto& line : ugcString)
-   {
-      ugcStream << line;
-   }
-
    // Concatenate UGC lines into a single string
    std::string ugc {};
-   for (const std::string& line : ugcString)
+   for (const std::string_view& line : ugcString)
    {
       ugc += line;
    }
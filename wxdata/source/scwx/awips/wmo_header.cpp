@@ -2,9 +2,12 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/streams.hpp>
 
+#include <algorithm>
 #include <istream>
-#include <sstream>
 #include <string>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
 
 #ifdef _WIN32
 #   include <WinSock2.h>
@@ -39,6 +42,10 @@ public:
 
    bool operator==(const WmoHeaderImpl& o) const;
 
+   bool ParseLines(std::string_view sequenceLine,
+                   std::string_view wmoLine,
+                   std::string_view awipsLine);
+
    std::string sequenceNumber_;
    std::string dataType_;
    std::string geographicDesignator_;
@@ -74,6 +81,21 @@ bool WmoHeaderImpl::operator==(const WmoHeaderImpl& o) const
            productDesignator_ == o.productDesignator_);
 }
 
+size_t WmoHeaderHash<WmoHeader>::operator()(const WmoHeader& x) const
+{
+   size_t seed = 0;
+   boost::hash_combine(seed, x.sequence_number());
+   boost::hash_combine(seed, x.data_type());
+   boost::hash_combine(seed, x.geographic_designator());
+   boost::hash_combine(seed, x.bulletin_id());
+   boost::hash_combine(seed, x.icao());
+   boost::hash_combine(seed, x.date_time());
+   boost::hash_combine(seed, x.bbb_indicator());
+   boost::hash_combine(seed, x.product_category());
+   boost::hash_combine(seed, x.product_designator());
+   return seed;
+}
+
 std::string WmoHeader::sequence_number() const
 {
    return p->sequenceNumber_;
@@ -121,8 +143,6 @@ std::string WmoHeader::product_designator() const
 
 bool WmoHeader::Parse(std::istream& is)
 {
-   bool headerValid = true;
-
    std::string sohLine;
    std::string sequenceLine;
    std::string wmoLine;
@@ -140,82 +160,115 @@ bool WmoHeader::Parse(std::istream& is)
    if (is.eof())
    {
       logger_->trace("Reached end of file");
-      headerValid = false;
+      return false;
    }
-   else
+
+   return p->ParseLines(sequenceLine, wmoLine, awipsLine);
+}
+
+bool WmoHeader::Parse(std::string_view& data)
+{
+   std::string_view sohLine {};
+   std::string_view sequenceLine {};
+   std::string_view wmoLine {};
+   std::string_view awipsLine {};
+
+   if (data.starts_with('\x01'))
    {
-      // Remove delimiters from the end of the line
-      while (sequenceLine.ends_with(' '))
-      {
-         sequenceLine.erase(sequenceLine.length() - 1);
-      }
+      util::getline(data, sohLine);
+      util::getline(data, sequenceLine);
+   }
+
+   util::getline(data, wmoLine);
+
+   if (!util::getline(data, awipsLine))
+   {
+      logger_->trace("Reached end of file");
+      return false;
+   }
+
+   return p->ParseLines(sequenceLine, wmoLine, awipsLine);
+}
+
+bool WmoHeaderImpl::ParseLines(std::string_view sequenceLine,
+                               std::string_view wmoLine,
+                               std::string_view awipsLine)
+{
+   bool headerValid = true;
+
+   // Remove delimiters from the end of the line
+   while (sequenceLine.ends_with(' '))
+   {
+      sequenceLine.remove_suffix(1);
    }
 
    // Transmission Header:
    // [SOH]
    // nnn
 
-   if (headerValid && !sequenceLine.empty())
+   if (!sequenceLine.empty())
    {
-      p->sequenceNumber_ = sequenceLine;
+      sequenceNumber_ = sequenceLine;
    }
 
    // WMO Abbreviated Heading Line:
    // T1T2A1A2ii CCCC YYGGgg (BBB)
 
-   if (headerValid)
+   static constexpr std::string_view kWhitespace_ = " \t\v\f";
+
+   std::vector<std::string_view> wmoTokenList;
+
+   for (std::size_t pos = wmoLine.find_first_not_of(kWhitespace_);
+        pos != std::string_view::npos;
+        pos = wmoLine.find_first_not_of(kWhitespace_, pos))
    {
-      std::string              token;
-      std::istringstream       wmoTokens(wmoLine);
-      std::vector<std::string> wmoTokenList;
+      std::size_t end = std::min(wmoLine.find_first_of(kWhitespace_, pos),
+                                 wmoLine.size());
+      wmoTokenList.push_back(wmoLine.substr(pos, end - pos));
+      pos = end;
+   }
 
-      while (wmoTokens >> token)
-      {
-         wmoTokenList.push_back(token);
-      }
+   if (wmoTokenList.size() < 3 || wmoTokenList.size() > 4)
+   {
+      logger_->warn("Invalid number of WMO tokens");
+      headerValid = false;
+   }
+   else if (wmoTokenList[0].size() != 6)
+   {
+      logger_->warn("WMO identifier malformed");
+      headerValid = false;
+   }
+   else if (wmoTokenList[1].size() != 4)
+   {
+      logger_->warn("ICAO malformed");
+      headerValid = false;
+   }
+   else if (wmoTokenList[2].size() != 6)
+   {
+      logger_->warn("Date/time malformed");
+      headerValid = false;
+   }
+   else if (wmoTokenList.size() == 4 && wmoTokenList[3].size() != 3)
+   {
+      // BBB indicator is optional
+      logger_->warn("BBB indicator malformed");
+      headerValid = false;
+   }
+   else
+   {
+      dataType_             = wmoTokenList[0].substr(0, 2);
+      geographicDesignator_ = wmoTokenList[0].substr(2, 2);
+      bulletinId_           = wmoTokenList[0].substr(4, 2);
+      icao_                 = wmoTokenList[1];
+      dateTime_             = wmoTokenList[2];
 
-      if (wmoTokenList.size() < 3 || wmoTokenList.size() > 4)
-      {
-         logger_->warn("Invalid number of WMO tokens");
-         headerValid = false;
-      }
-      else if (wmoTokenList[0].size() != 6)
-      {
-         logger_->warn("WMO identifier malformed");
-         headerValid = false;
-      }
-      else if (wmoTokenList[1].size() != 4)
-      {
-         logger_->warn("ICAO malformed");
-         headerValid = false;
-      }
-      else if (wmoTokenList[2].size() != 6)
+      if (wmoTokenList.size() == 4)
       {
-         logger_->warn("Date/time malformed");
-         headerValid = false;
-      }
-      else if (wmoTokenList.size() == 4 && wmoTokenList[3].size() != 3)
-      {
-         // BBB indicator is optional
-         logger_->warn("BBB indicator malformed");
-         headerValid = false;
+         bbbIndicator_ = wmoTokenList[3];
       }
       else
       {
-         p->dataType_             = wmoTokenList[0].substr(0, 2);
-         p->geographicDesignator_ = wmoTokenList[0].substr(2, 2);
-         p->bulletinId_           = wmoTokenList[0].substr(4, 2);
-         p->icao_                 = wmoTokenList[1];
-         p->dateTime_             = wmoTokenList[2];
-
-         if (wmoTokenList.size() == 4)
-         {
-            p->bbbIndicator_ = wmoTokenList[3];
-         }
-         else
-         {
-            p->bbbIndicator_ = "";
-         }
+         bbbIndicator_ = "";
       }
    }
 
@@ -231,8 +284,8 @@ bool WmoHeader::Parse(std::istream& is)
       }
       else
       {
-         p->productCategory_   = awipsLine.substr(0, 3);
-         p->productDesignator_ = awipsLine.substr(3, 3);
+         productCategory_   = awipsLine.substr(0, 3);
+         productDesignator_ = awipsLine.substr(3, 3);
       }
    }
 
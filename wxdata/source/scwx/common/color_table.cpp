@@ -4,6 +4,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <optional>
@@ -105,51 +106,38 @@ boost::gil::rgba8_pixel_t ColorTable::rf_color() const
 boost::gil::rgba8_pixel_t ColorTable::Color(float value) const
 {
    boost::gil::rgba8_pixel_t color;
-   bool                      found = false;
 
    value = value * p->scale_ + p->offset_;
 
-   auto prev = p->colorMap_.cbegin();
-   for (auto it = p->colorMap_.cbegin(); it != p->colorMap_.cend(); ++it)
-   {
-      if (value < it->first)
-      {
-         if (it == p->colorMap_.cbegin())
-         {
-            color = it->second.first;
-         }
-         else
-         {
-            // Interpolate
-            float key1 = prev->first;
-            float key2 = it->first;
-
-            boost::gil::rgba8_pixel_t color1 = prev->second.first;
-            boost::gil::rgba8_pixel_t color2 = (prev->second.second) ?
-                                                  prev->second.second.value() :
-                                                  it->second.first;
-
-            float t = (value - key1) / (key2 - key1);
-            color[0] =
-               RoundChannel<uint8_t>(std::lerp(color1[0], color2[0], t));
-            color[1] =
-               RoundChannel<uint8_t>(std::lerp(color1[1], color2[1], t));
-            color[2] =
-               RoundChannel<uint8_t>(std::lerp(color1[2], color2[2], t));
-            color[3] =
-               RoundChannel<uint8_t>(std::lerp(color1[3], color2[3], t));
-         }
+   // Find the first key greater than the value
+   auto it = p->colorMap_.upper_bound(value);
 
-         found = true;
-         break;
-      }
-
-      prev = it;
+   if (it == p->colorMap_.cend())
+   {
+      color = std::prev(it)->second.first;
    }
-
-   if (!found)
+   else if (it == p->colorMap_.cbegin())
+   {
+      color = it->second.first;
+   }
+   else
    {
-      color = prev->second.first;
+      // Interpolate
+      auto prev = std::prev(it);
+
+      float key1 = prev->first;
+      float key2 = it->first;
+
+      boost::gil::rgba8_pixel_t color1 = prev->second.first;
+      boost::gil::rgba8_pixel_t color2 = (prev->second.second) ?
+                                            prev->second.second.value() :
+                                            it->second.first;
+
+      float t  = (value - key1) / (key2 - key1);
+      color[0] = RoundChannel<uint8_t>(std::lerp(color1[0], color2[0], t));
+      color[1] = RoundChannel<uint8_t>(std::lerp(color1[1], color2[1], t));
+      color[2] = RoundChannel<uint8_t>(std::lerp(color1[2], color2[2], t));
+      color[3] = RoundChannel<uint8_t>(std::lerp(color1[3], color2[3], t));
    }
 
    return color;
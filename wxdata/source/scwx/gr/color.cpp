@@ -9,16 +9,42 @@ namespace scwx
 namespace gr
 {
 
+template<typename T>
+static boost::gil::rgba8_pixel_t
+ParseColorImpl(const std::vector<T>& tokenList,
+               std::size_t           startIndex,
+               ColorMode             colorMode,
+               bool                  hasAlpha);
 template<typename T>
 T RoundChannel(double value);
 template<typename T>
-T StringToDecimal(const std::string& str);
+T StringToDecimal(std::string_view str);
+static double StringToDouble(std::string_view str);
 
 boost::gil::rgba8_pixel_t ParseColor(const std::vector<std::string>& tokenList,
                                      std::size_t                     startIndex,
                                      ColorMode                       colorMode,
                                      bool                            hasAlpha)
 {
+   return ParseColorImpl(tokenList, startIndex, colorMode, hasAlpha);
+}
+
+boost::gil::rgba8_pixel_t
+ParseColor(const std::vector<std::string_view>& tokenList,
+           std::size_t                          startIndex,
+           ColorMode                            colorMode,
+           bool                                 hasAlpha)
+{
+   return ParseColorImpl(tokenList, startIndex, colorMode, hasAlpha);
+}
+
+template<typename T>
+static boost::gil::rgba8_pixel_t
+ParseColorImpl(const std::vector<T>& tokenList,
+               std::size_t           startIndex,
+               ColorMode             colorMode,
+               bool                  hasAlpha)
+{
 
    std::uint8_t r {};
    std::uint8_t g {};
@@ -47,9 +73,9 @@ boost::gil::rgba8_pixel_t ParseColor(const std::vector<std::string>& tokenList,
 
       if (tokenList.size() >= startIndex + 3)
       {
-         h = std::stod(tokenList[startIndex + 0]);
-         s = std::stod(tokenList[startIndex + 1]);
-         l = std::stod(tokenList[startIndex + 2]);
+         h = StringToDouble(tokenList[startIndex + 0]);
+         s = StringToDouble(tokenList[startIndex + 1]);
+         l = StringToDouble(tokenList[startIndex + 2]);
       }
 
       double dr;
@@ -75,12 +101,19 @@ T RoundChannel(double value)
 }
 
 template<typename T>
-T StringToDecimal(const std::string& str)
+T StringToDecimal(std::string_view str)
 {
-   return static_cast<T>(std::clamp<int>(std::stoi(str),
+   // Numeric tokens are short enough to fit within the small string buffer,
+   // so the copy does not allocate
+   return static_cast<T>(std::clamp<int>(std::stoi(std::string {str}),
                                          std::numeric_limits<T>::min(),
                                          std::numeric_limits<T>::max()));
 }
 
+static double StringToDouble(std::string_view str)
+{
+   return std::stod(std::string {str});
+}
+
 } // namespace gr
 } // namespace scwx
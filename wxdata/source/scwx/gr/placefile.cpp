@@ -11,11 +11,17 @@
 #include <scwx/gr/placefile.hpp>
 #include <scwx/gr/color.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/streams.hpp>
 #include <scwx/util/strings.hpp>
 
+#include <array>
+#include <cctype>
+#include <execution>
 #include <fstream>
+#include <iterator>
+#include <optional>
+#include <span>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
 
 #include <boost/algorithm/string.hpp>
@@ -34,15 +40,42 @@ namespace gr
 static const std::string logPrefix_ {"scwx::gr::placefile"};
 static const auto        logger_ = util::Logger::Create(logPrefix_);
 
-enum class DrawingStatement
+enum class Keyword
 {
-   Standard,
+   Title,
+   Threshold,
+   TimeRange,
+   HSLuv,
+   Color,
+   ModulateIcon,
+   Refresh,
+   RefreshSeconds,
+   Place,
+   IconFile,
+   Icon,
+   Font,
+   Text,
+   Object,
+   End,
    Line,
    Triangles,
    Image,
-   Polygon
+   Polygon,
+   Unknown
 };
 
+struct KeywordInfo
+{
+   std::string_view key_;
+   Keyword          keyword_;
+};
+
+static KeywordInfo   FindKeyword(std::string_view line);
+static bool          IsBlockKeyword(Keyword keyword);
+static double        StringToDouble(std::string_view s);
+static int           StringToInt(std::string_view s);
+static unsigned long StringToUnsigned(std::string_view s);
+
 class Placefile::Impl
 {
 public:
@@ -55,35 +88,74 @@ public:
       double y_ {};
    };
 
-   void ParseLocation(const std::string& latitudeToken,
-                      const std::string& longitudeToken,
-                      double&            latitude,
-                      double&            longitude,
-                      double&            x,
-                      double&            y);
-   void ProcessElement(const std::string& line);
-   void ProcessElementEnd();
-   void ProcessLine(const std::string& line);
+   // Parsing state applied to draw statements
+   struct State
+   {
+      units::length::nautical_miles<double> threshold_ {999.0_nmi};
+      boost::gil::rgba8_pixel_t             color_ {255, 255, 255, 255};
+      boost::gil::rgba8_pixel_t             iconModulate_ {255, 255, 255, 255};
+      ColorMode                             colorMode_ {ColorMode::RGBA};
+      std::chrono::sys_time<std::chrono::seconds> startTime_ {};
+      std::chrono::sys_time<std::chrono::seconds> endTime_ {};
+      std::vector<Object>                         objectStack_ {};
+   };
+
+   // Draw statement, along with the lines of its block, which is parsed
+   // independently of other draw statements
+   struct Statement
+   {
+      Keyword          keyword_ {Keyword::Unknown};
+      std::string_view line_ {};
+      std::size_t      keySize_ {};
+      std::size_t      stateIndex_ {};
+      std::size_t      firstElement_ {};
+      std::size_t      elementCount_ {};
+      bool             ended_ {false};
+   };
 
-   static void ProcessEscapeCharacters(std::string& s);
-   static void TrimQuotes(std::string& s);
+   static std::vector<std::string_view> SplitLines(std::string_view buffer);
+
+   void ProcessLine(const std::vector<std::string_view>& lines,
+                    std::size_t                          lineIndex);
+   void ProcessStatements(const std::vector<std::string_view>& lines);
+   std::shared_ptr<DrawItem>
+   ProcessStatement(const Statement&                     statement,
+                    const std::vector<std::string_view>& lines) const;
+   std::shared_ptr<DrawItem> ProcessDrawStatement(const Statement& statement,
+                                                  const State&     state) const;
+
+   static void
+   ProcessElement(Keyword                                keyword,
+                  const std::shared_ptr<DrawItem>&       di,
+                  std::string_view                       line,
+                  const State&                           state,
+                  std::vector<PolygonDrawItem::Element>& polygonContour);
+   static void
+   ProcessElementEnd(Keyword                                keyword,
+                     const std::shared_ptr<DrawItem>&       di,
+                     std::vector<PolygonDrawItem::Element>& polygonContour);
+
+   static void ParseLocation(std::string_view latitudeToken,
+                             std::string_view longitudeToken,
+                             const State&     state,
+                             double&          latitude,
+                             double&          longitude,
+                             double&          x,
+                             double&          y);
+
+   static void             ProcessEscapeCharacters(std::string& s);
+   static std::string_view TrimQuotes(std::string_view s);
 
    std::string          name_ {};
    std::string          title_ {};
    std::chrono::seconds refresh_ {-1};
 
    // Parsing state
-   units::length::nautical_miles<double> threshold_ {999.0_nmi};
-   boost::gil::rgba8_pixel_t             color_ {255, 255, 255, 255};
-   boost::gil::rgba8_pixel_t             iconModulate_ {255, 255, 255, 255};
-   ColorMode                             colorMode_ {ColorMode::RGBA};
-   std::chrono::sys_time<std::chrono::seconds> startTime_ {};
-   std::chrono::sys_time<std::chrono::seconds> endTime_ {};
-
-   std::vector<Object>       objectStack_ {};
-   DrawingStatement          currentStatement_ {DrawingStatement::Standard};
-   std::shared_ptr<DrawItem> currentDrawItem_ {nullptr};
-   std::vector<PolygonDrawItem::Element> currentPolygonContour_ {};
+   State                      state_ {};
+   bool                       stateChanged_ {true};
+   std::vector<State>         states_ {};
+   std::vector<Statement>     statements_ {};
+   std::optional<std::size_t> currentBlock_ {};
 
    // References
    std::unordered_map<std::size_t, std::shared_ptr<IconFile>> iconFiles_ {};
@@ -174,9 +246,45 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
 
    placefile->p->name_ = name;
 
-   std::string line;
-   while (scwx::util::getline(is, line))
+   // Buffer the placefile, so lines and tokens can reference it without being
+   // copied
+   const std::string buffer {std::istreambuf_iterator<char> {is},
+                             std::istreambuf_iterator<char> {}};
+
+   const std::vector<std::string_view> lines = Impl::SplitLines(buffer);
+
+   // Apply state statements in order, and record each draw statement with the
+   // state it is drawn with
+   for (std::size_t i = 0; i < lines.size(); ++i)
    {
+      placefile->p->ProcessLine(lines, i);
+   }
+
+   // Draw statements are independent of each other, and can be parsed in
+   // parallel
+   placefile->p->ProcessStatements(lines);
+
+   return placefile;
+}
+
+std::vector<std::string_view>
+Placefile::Impl::SplitLines(std::string_view buffer)
+{
+   std::vector<std::string_view> lines {};
+
+   std::size_t pos = 0;
+   while (pos < buffer.size())
+   {
+      // Lines may end with LF, CR or CRLF
+      std::size_t end = buffer.find_first_of("\r\n", pos);
+      if (end == std::string_view::npos)
+      {
+         end = buffer.size();
+      }
+
+      std::string_view line = buffer.substr(pos, end - pos);
+      pos                   = end + 1;
+
       // Find position of comment (;)
       bool inQuotes = false;
       for (std::size_t i = 0; i < line.size(); ++i)
@@ -184,7 +292,7 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
          if (!inQuotes && line[i] == ';')
          {
             // Remove comment
-            line.erase(i);
+            line = line.substr(0, i);
             break;
          }
          else if (line[i] == '"')
@@ -195,501 +303,603 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
       }
 
       // Remove extra spacing from line
-      boost::trim(line);
+      line = util::TrimWhitespace(line);
 
-      if (line.size() >= 1)
+      if (!line.empty())
       {
-         try
-         {
-            switch (placefile->p->currentStatement_)
-            {
-            case DrawingStatement::Standard:
-               placefile->p->ProcessLine(line);
-               break;
-
-            case DrawingStatement::Line:
-            case DrawingStatement::Triangles:
-            case DrawingStatement::Image:
-            case DrawingStatement::Polygon:
-               if (boost::istarts_with(line, "End:"))
-               {
-                  placefile->p->ProcessElementEnd();
-
-                  placefile->p->currentStatement_ = DrawingStatement::Standard;
-                  placefile->p->currentDrawItem_  = nullptr;
-               }
-               else if (placefile->p->currentDrawItem_ != nullptr)
-               {
-                  placefile->p->ProcessElement(line);
-               }
-               break;
-            }
-         }
-         catch (const std::exception&)
-         {
-            logger_->warn("Could not parse line: {}", line);
-         }
+         lines.push_back(line);
       }
    }
 
-   return placefile;
+   return lines;
 }
 
-void Placefile::Impl::ProcessLine(const std::string& line)
+void Placefile::Impl::ProcessLine(const std::vector<std::string_view>& lines,
+                                  std::size_t lineIndex)
 {
-   static const std::string titleKey_ {"Title:"};
-   static const std::string thresholdKey_ {"Threshold:"};
-   static const std::string timeRangeKey_ {"TimeRange:"};
-   static const std::string hsluvKey_ {"HSLuv:"};
-   static const std::string colorKey_ {"Color:"};
-   static const std::string refreshKey_ {"Refresh:"};
-   static const std::string refreshSecondsKey_ {"RefreshSeconds:"};
-   static const std::string placeKey_ {"Place:"};
-   static const std::string iconFileKey_ {"IconFile:"};
-   static const std::string iconKey_ {"Icon:"};
-   static const std::string fontKey_ {"Font:"};
-   static const std::string textKey_ {"Text:"};
-   static const std::string objectKey_ {"Object:"};
-   static const std::string endKey_ {"End:"};
-   static const std::string lineKey_ {"Line:"};
-   static const std::string trianglesKey_ {"Triangles:"};
-   static const std::string imageKey_ {"Image:"};
-   static const std::string polygonKey_ {"Polygon:"};
-
-   static const std::string scwxModulateIconKey_ {"scwx-ModulateIcon:"};
-
-   currentStatement_ = DrawingStatement::Standard;
+   const std::string_view line = lines[lineIndex];
+
+   if (currentBlock_.has_value())
+   {
+      Statement& block = statements_[*currentBlock_];
+
+      if (boost::istarts_with(line, "End:"))
+      {
+         block.ended_ = true;
+         currentBlock_.reset();
+      }
+      else
+      {
+         // Block elements are parsed with the block
+         ++block.elementCount_;
+      }
+
+      return;
+   }
+
+   const KeywordInfo keyword = FindKeyword(line);
+   const std::size_t keySize = keyword.key_.size();
 
    // When tokenizing, add one additional delimiter to discard unexpected
    // parameters (where appropriate)
 
-   if (boost::istarts_with(line, titleKey_))
+   try
    {
-      // Title: title
-      title_ = line.substr(titleKey_.size());
-      boost::trim(title_);
-   }
-   else if (boost::istarts_with(line, thresholdKey_))
-   {
-      // Threshold: nautical_miles
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, thresholdKey_.size());
+      switch (keyword.keyword_)
+      {
+      case Keyword::Title:
+      {
+         // Title: title
+         title_ = util::TrimWhitespace(line.substr(keySize));
+         break;
+      }
 
-      if (tokenList.size() >= 1)
+      case Keyword::Threshold:
       {
-         threshold_ =
-            units::length::nautical_miles<double>(std::stod(tokenList[0]));
+         // Threshold: nautical_miles
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" "}, keySize);
+
+         if (tokenList.size() >= 1)
+         {
+            state_.threshold_ = units::length::nautical_miles<double>(
+               StringToDouble(tokenList[0]));
+            stateChanged_ = true;
+         }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, timeRangeKey_))
-   {
-      // TimeRange: start_time end_time
-      //   (YYYY-MM-DDThh:mm:ss)
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " "}, timeRangeKey_.size());
 
-      if (tokenList.size() >= 2)
+      case Keyword::TimeRange:
       {
-         using namespace std::chrono;
+         // TimeRange: start_time end_time
+         //   (YYYY-MM-DDThh:mm:ss)
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" ", " "}, keySize);
+
+         if (tokenList.size() >= 2)
+         {
+            using namespace std::chrono;
 
 #if (__cpp_lib_chrono < 201907L)
-         using namespace date;
+            using namespace date;
 #endif
 
-         static const std::string dateTimeFormat {"%Y-%m-%dT%H:%M:%S"};
+            static const std::string dateTimeFormat {"%Y-%m-%dT%H:%M:%S"};
 
-         std::istringstream ssStartTime {tokenList[0]};
-         std::istringstream ssEndTime {tokenList[1]};
+            std::istringstream ssStartTime {std::string {tokenList[0]}};
+            std::istringstream ssEndTime {std::string {tokenList[1]}};
 
-         std::chrono::sys_time<seconds> startTime;
-         std::chrono::sys_time<seconds> endTime;
+            std::chrono::sys_time<seconds> startTime;
+            std::chrono::sys_time<seconds> endTime;
 
-         ssStartTime >> parse(dateTimeFormat, startTime);
-         ssEndTime >> parse(dateTimeFormat, endTime);
+            ssStartTime >> parse(dateTimeFormat, startTime);
+            ssEndTime >> parse(dateTimeFormat, endTime);
 
-         if (!ssStartTime.fail() && !ssEndTime.fail())
-         {
-            startTime_ = startTime;
-            endTime_   = endTime;
+            if (!ssStartTime.fail() && !ssEndTime.fail())
+            {
+               state_.startTime_ = startTime;
+               state_.endTime_   = endTime;
+            }
+            else
+            {
+               state_.startTime_ = {};
+               state_.endTime_   = {};
+
+               logger_->warn("TimeRange statement parse error: {}", line);
+            }
+
+            stateChanged_ = true;
          }
          else
          {
-            startTime_ = {};
-            endTime_   = {};
-
-            logger_->warn("TimeRange statement parse error: {}", line);
+            logger_->warn("TimeRange statement malformed: {}", line);
          }
+         break;
       }
-      else
+
+      case Keyword::HSLuv:
       {
-         logger_->warn("TimeRange statement malformed: {}", line);
+         // HSLuv: value
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" "}, keySize);
+
+         if (tokenList.size() >= 1)
+         {
+            if (boost::iequals(tokenList[0], "true"))
+            {
+               state_.colorMode_ = ColorMode::HSLuv;
+            }
+            else
+            {
+               state_.colorMode_ = ColorMode::RGBA;
+            }
+
+            stateChanged_ = true;
+         }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, hsluvKey_))
-   {
-      // HSLuv: value
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, hsluvKey_.size());
 
-      if (tokenList.size() >= 1)
+      case Keyword::Color:
       {
-         if (boost::iequals(tokenList[0], "true"))
+         // Color: red green blue [alpha]
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" ", " ", " ", " "}, keySize);
+
+         if (tokenList.size() >= 3)
          {
-            colorMode_ = ColorMode::HSLuv;
+            state_.color_ = ParseColor(tokenList, 0, state_.colorMode_);
+            stateChanged_ = true;
          }
-         else
+         break;
+      }
+
+      case Keyword::ModulateIcon:
+      {
+         // Supercell Wx Extension
+         // scwx-ModulateIcon: red green blue [alpha]
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" ", " ", " ", " "}, keySize);
+
+         if (tokenList.size() >= 3)
          {
-            colorMode_ = ColorMode::RGBA;
+            state_.iconModulate_ = ParseColor(tokenList, 0, state_.colorMode_);
+            stateChanged_        = true;
          }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, colorKey_))
-   {
-      // Color: red green blue [alpha]
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " ", " ", " "}, colorKey_.size());
 
-      if (tokenList.size() >= 3)
+      case Keyword::Refresh:
       {
-         color_ = ParseColor(tokenList, 0, colorMode_);
+         // Refresh: minutes
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" "}, keySize);
+
+         if (tokenList.size() >= 1)
+         {
+            refresh_ = std::chrono::minutes {StringToInt(tokenList[0])};
+         }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, scwxModulateIconKey_))
-   {
-      // Supercell Wx Extension
-      // scwx-ModulateIcon: red green blue [alpha]
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {" ", " ", " ", " "}, scwxModulateIconKey_.size());
 
-      if (tokenList.size() >= 3)
+      case Keyword::RefreshSeconds:
       {
-         iconModulate_ = ParseColor(tokenList, 0, colorMode_);
+         // RefreshSeconds: seconds
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {" "}, keySize);
+
+         if (tokenList.size() >= 1)
+         {
+            refresh_ = std::chrono::seconds {StringToInt(tokenList[0])};
+         }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, refreshKey_))
-   {
-      // Refresh: minutes
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshKey_.size());
 
-      if (tokenList.size() >= 1)
+      case Keyword::IconFile:
       {
-         refresh_ = std::chrono::minutes {std::stoi(tokenList[0])};
+         // IconFile: fileNumber, iconWidth, iconHeight, hotX, hotY, fileName
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {",", ",", ",", ",", ","}, keySize);
+
+         if (tokenList.size() >= 6)
+         {
+            std::shared_ptr<IconFile> iconFile = std::make_shared<IconFile>();
+
+            iconFile->fileNumber_ = StringToUnsigned(tokenList[0]);
+            iconFile->iconWidth_  = StringToUnsigned(tokenList[1]);
+            iconFile->iconHeight_ = StringToUnsigned(tokenList[2]);
+            iconFile->hotX_       = StringToUnsigned(tokenList[3]);
+            iconFile->hotY_       = StringToUnsigned(tokenList[4]);
+            iconFile->filename_   = TrimQuotes(tokenList[5]);
+
+            iconFiles_.insert_or_assign(iconFile->fileNumber_, iconFile);
+         }
+         else
+         {
+            logger_->warn("IconFile statement malformed: {}", line);
+         }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, refreshSecondsKey_))
-   {
-      // RefreshSeconds: seconds
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshSecondsKey_.size());
 
-      if (tokenList.size() >= 1)
+      case Keyword::Font:
       {
-         refresh_ = std::chrono::seconds {std::stoi(tokenList[0])};
+         // Font: fontNumber, pixels, flags, "face"
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {",", ",", ",", ","}, keySize);
+
+         if (tokenList.size() >= 4)
+         {
+            std::shared_ptr<Font> font = std::make_shared<Font>();
+
+            font->fontNumber_ = StringToUnsigned(tokenList[0]);
+            font->pixels_     = StringToUnsigned(tokenList[1]);
+            font->flags_      = StringToInt(tokenList[2]);
+            font->face_       = TrimQuotes(tokenList[3]);
+
+            fonts_.insert_or_assign(font->fontNumber_, font);
+         }
+         else
+         {
+            logger_->warn("Font statement malformed: {}", line);
+         }
+         break;
       }
-   }
-   else if (boost::istarts_with(line, placeKey_))
-   {
-      // Place: latitude, longitude, string with spaces
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, placeKey_.size());
 
-      if (tokenList.size() >= 3)
+      case Keyword::Object:
       {
-         std::shared_ptr<TextDrawItem> di = std::make_shared<TextDrawItem>();
+         // Object: lat, lon
+         //    ...
+         // End:
+         std::vector<std::string_view> tokenList =
+            util::ParseTokenViews(line, {",", ","}, keySize);
 
-         di->threshold_ = threshold_;
-         di->color_     = color_;
-         di->startTime_ = startTime_;
-         di->endTime_   = endTime_;
+         double latitude {};
+         double longitude {};
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
-                       di->latitude_,
-                       di->longitude_,
-                       di->x_,
-                       di->y_);
+         if (tokenList.size() >= 2)
+         {
+            latitude  = StringToDouble(tokenList[0]);
+            longitude = StringToDouble(tokenList[1]);
+         }
+         else
+         {
+            logger_->warn("Object statement malformed: {}", line);
+         }
 
-         ProcessEscapeCharacters(tokenList[2]);
-         di->text_.swap(tokenList[2]);
+         state_.objectStack_.emplace_back(Object {latitude, longitude});
+         stateChanged_ = true;
+         break;
+      }
 
-         drawItems_.emplace_back(std::move(di));
+      case Keyword::End:
+      {
+         // Object End
+         if (!state_.objectStack_.empty())
+         {
+            state_.objectStack_.pop_back();
+            stateChanged_ = true;
+         }
+         break;
       }
-      else
+
+      case Keyword::Place:
+      case Keyword::Icon:
+      case Keyword::Text:
+      case Keyword::Line:
+      case Keyword::Triangles:
+      case Keyword::Image:
+      case Keyword::Polygon:
       {
-         logger_->warn("Place statement malformed: {}", line);
+         // Draw statements share a copy of the state until it changes
+         if (stateChanged_)
+         {
+            states_.push_back(state_);
+            stateChanged_ = false;
+         }
+
+         statements_.push_back({keyword.keyword_,
+                                line,
+                                keySize,
+                                states_.size() - 1,
+                                lineIndex + 1});
+
+         if (IsBlockKeyword(keyword.keyword_))
+         {
+            currentBlock_ = statements_.size() - 1;
+         }
+         break;
+      }
+
+      case Keyword::Unknown:
+      default:
+         logger_->trace("Unknown statement: {}", line);
+         break;
       }
    }
-   else if (boost::istarts_with(line, iconFileKey_))
+   catch (const std::exception&)
    {
-      // IconFile: fileNumber, iconWidth, iconHeight, hotX, hotY, fileName
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {",", ",", ",", ",", ","}, iconFileKey_.size());
+      logger_->warn("Could not parse line: {}", line);
+   }
+}
 
-      if (tokenList.size() >= 6)
-      {
-         std::shared_ptr<IconFile> iconFile = std::make_shared<IconFile>();
+void Placefile::Impl::ProcessStatements(
+   const std::vector<std::string_view>& lines)
+{
+   std::vector<std::shared_ptr<DrawItem>> drawItems(statements_.size());
+
+   std::transform(std::execution::par,
+                  statements_.cbegin(),
+                  statements_.cend(),
+                  drawItems.begin(),
+                  [this, &lines](const Statement& statement)
+                  { return ProcessStatement(statement, lines); });
+
+   // Keep draw items in statement order, skipping malformed statements
+   drawItems_.reserve(drawItems_.size() + drawItems.size());
+   std::copy_if(std::make_move_iterator(drawItems.begin()),
+                std::make_move_iterator(drawItems.end()),
+                std::back_inserter(drawItems_),
+                [](const auto& di) { return di != nullptr; });
+
+   // Statements reference the placefile buffer, and are no longer valid
+   statements_.clear();
+   states_.clear();
+   currentBlock_.reset();
+}
 
-         iconFile->fileNumber_ = std::stoul(tokenList[0]);
-         iconFile->iconWidth_  = std::stoul(tokenList[1]);
-         iconFile->iconHeight_ = std::stoul(tokenList[2]);
-         iconFile->hotX_       = std::stoul(tokenList[3]);
-         iconFile->hotY_       = std::stoul(tokenList[4]);
+std::shared_ptr<Placefile::DrawItem> Placefile::Impl::ProcessStatement(
+   const Statement& statement, const std::vector<std::string_view>& lines) const
+{
+   const State& state = states_[statement.stateIndex_];
 
-         TrimQuotes(tokenList[5]);
-         iconFile->filename_.swap(tokenList[5]);
+   std::shared_ptr<DrawItem> di = nullptr;
 
-         iconFiles_.insert_or_assign(iconFile->fileNumber_, iconFile);
+   try
+   {
+      di = ProcessDrawStatement(statement, state);
+   }
+   catch (const std::exception&)
+   {
+      logger_->warn("Could not parse line: {}", statement.line_);
+   }
+
+   if (di == nullptr || !IsBlockKeyword(statement.keyword_))
+   {
+      return di;
+   }
+
+   std::vector<PolygonDrawItem::Element> polygonContour {};
+
+   for (std::size_t i = statement.firstElement_;
+        i < statement.firstElement_ + statement.elementCount_;
+        ++i)
+   {
+      try
+      {
+         ProcessElement(
+            statement.keyword_, di, lines[i], state, polygonContour);
       }
-      else
+      catch (const std::exception&)
       {
-         logger_->warn("IconFile statement malformed: {}", line);
+         logger_->warn("Could not parse line: {}", lines[i]);
       }
    }
-   else if (boost::istarts_with(line, iconKey_))
+
+   if (statement.ended_)
    {
-      // Icon: lat, lon, angle, fileNumber, iconNumber, hoverText
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, iconKey_.size());
+      ProcessElementEnd(statement.keyword_, di, polygonContour);
+   }
 
-      std::shared_ptr<IconDrawItem> di = nullptr;
+   return di;
+}
 
-      if (tokenList.size() >= 5)
+std::shared_ptr<Placefile::DrawItem>
+Placefile::Impl::ProcessDrawStatement(const Statement& statement,
+                                      const State&     state) const
+{
+   const std::string_view line    = statement.line_;
+   const std::size_t      keySize = statement.keySize_;
+
+   switch (statement.keyword_)
+   {
+   case Keyword::Place:
+   {
+      // Place: latitude, longitude, string with spaces
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ","}, keySize);
+
+      if (tokenList.size() >= 3)
       {
-         di = std::make_shared<IconDrawItem>();
+         std::shared_ptr<TextDrawItem> di = std::make_shared<TextDrawItem>();
 
-         di->threshold_ = threshold_;
-         di->startTime_ = startTime_;
-         di->endTime_   = endTime_;
-         di->modulate_  = iconModulate_;
+         di->threshold_ = state.threshold_;
+         di->color_     = state.color_;
+         di->startTime_ = state.startTime_;
+         di->endTime_   = state.endTime_;
 
          ParseLocation(tokenList[0],
                        tokenList[1],
+                       state,
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         di->angle_ = units::angle::degrees<double>(std::stod(tokenList[2]));
+         di->text_ = tokenList[2];
+         ProcessEscapeCharacters(di->text_);
 
-         di->fileNumber_ = std::stoul(tokenList[3]);
-         di->iconNumber_ = std::stoul(tokenList[4]);
-      }
-      if (tokenList.size() >= 6)
-      {
-         ProcessEscapeCharacters(tokenList[5]);
-         TrimQuotes(tokenList[5]);
-         di->hoverText_.swap(tokenList[5]);
+         return di;
       }
 
-      if (di != nullptr)
-      {
-         drawItems_.emplace_back(std::move(di));
-      }
-      else
-      {
-         logger_->warn("Icon statement malformed: {}", line);
-      }
+      logger_->warn("Place statement malformed: {}", line);
+      return nullptr;
    }
-   else if (boost::istarts_with(line, fontKey_))
+
+   case Keyword::Icon:
    {
-      // Font: fontNumber, pixels, flags, "face"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","}, fontKey_.size());
+      // Icon: lat, lon, angle, fileNumber, iconNumber, hoverText
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ",", ",", ",", ","}, keySize);
 
-      if (tokenList.size() >= 4)
+      if (tokenList.size() >= 5)
       {
-         std::shared_ptr<Font> font = std::make_shared<Font>();
+         std::shared_ptr<IconDrawItem> di = std::make_shared<IconDrawItem>();
+
+         di->threshold_ = state.threshold_;
+         di->startTime_ = state.startTime_;
+         di->endTime_   = state.endTime_;
+         di->modulate_  = state.iconModulate_;
+
+         ParseLocation(tokenList[0],
+                       tokenList[1],
+                       state,
+                       di->latitude_,
+                       di->longitude_,
+                       di->x_,
+                       di->y_);
 
-         font->fontNumber_ = std::stoul(tokenList[0]);
-         font->pixels_     = std::stoul(tokenList[1]);
-         font->flags_      = std::stoi(tokenList[2]);
+         di->angle_ =
+            units::angle::degrees<double>(StringToDouble(tokenList[2]));
 
-         TrimQuotes(tokenList[3]);
-         font->face_.swap(tokenList[3]);
+         di->fileNumber_ = StringToUnsigned(tokenList[3]);
+         di->iconNumber_ = StringToUnsigned(tokenList[4]);
 
-         fonts_.insert_or_assign(font->fontNumber_, font);
-      }
-      else
-      {
-         logger_->warn("Font statement malformed: {}", line);
+         if (tokenList.size() >= 6)
+         {
+            di->hoverText_ = TrimQuotes(tokenList[5]);
+            ProcessEscapeCharacters(di->hoverText_);
+         }
+
+         return di;
       }
+
+      logger_->warn("Icon statement malformed: {}", line);
+      return nullptr;
    }
-   else if (boost::istarts_with(line, textKey_))
+
+   case Keyword::Text:
    {
       // Text: lat, lon, fontNumber, "string", "hover"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, textKey_.size());
-
-      std::shared_ptr<TextDrawItem> di = nullptr;
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ",", ",", ",", ","}, keySize);
 
       if (tokenList.size() >= 4)
       {
-         di = std::make_shared<TextDrawItem>();
+         std::shared_ptr<TextDrawItem> di = std::make_shared<TextDrawItem>();
 
-         di->threshold_ = threshold_;
-         di->color_     = color_;
-         di->startTime_ = startTime_;
-         di->endTime_   = endTime_;
+         di->threshold_ = state.threshold_;
+         di->color_     = state.color_;
+         di->startTime_ = state.startTime_;
+         di->endTime_   = state.endTime_;
 
          ParseLocation(tokenList[0],
                        tokenList[1],
+                       state,
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         di->fontNumber_ = std::stoul(tokenList[2]);
+         di->fontNumber_ = StringToUnsigned(tokenList[2]);
 
-         ProcessEscapeCharacters(tokenList[3]);
-         TrimQuotes(tokenList[3]);
-         di->text_.swap(tokenList[3]);
-      }
-      if (tokenList.size() >= 5)
-      {
-         ProcessEscapeCharacters(tokenList[4]);
-         TrimQuotes(tokenList[4]);
-         di->hoverText_.swap(tokenList[4]);
-      }
+         di->text_ = TrimQuotes(tokenList[3]);
+         ProcessEscapeCharacters(di->text_);
 
-      if (di != nullptr)
-      {
-         drawItems_.emplace_back(std::move(di));
-      }
-      else
-      {
-         logger_->warn("Text statement malformed: {}", line);
-      }
-   }
-   else if (boost::istarts_with(line, objectKey_))
-   {
-      // Object: lat, lon
-      //    ...
-      // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, objectKey_.size());
-
-      double latitude {};
-      double longitude {};
+         if (tokenList.size() >= 5)
+         {
+            di->hoverText_ = TrimQuotes(tokenList[4]);
+            ProcessEscapeCharacters(di->hoverText_);
+         }
 
-      if (tokenList.size() >= 2)
-      {
-         latitude  = std::stod(tokenList[0]);
-         longitude = std::stod(tokenList[1]);
-      }
-      else
-      {
-         logger_->warn("Object statement malformed: {}", line);
+         return di;
       }
 
-      objectStack_.emplace_back(Object {latitude, longitude});
+      logger_->warn("Text statement malformed: {}", line);
+      return nullptr;
    }
-   else if (boost::istarts_with(line, endKey_))
-   {
-      // Object End
-      if (!objectStack_.empty())
-      {
-         objectStack_.pop_back();
-      }
-   }
-   else if (boost::istarts_with(line, lineKey_))
+
+   case Keyword::Line:
    {
       // Line: width, flags [, hover_text]
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, lineKey_.size());
-
-      currentStatement_ = DrawingStatement::Line;
-
-      std::shared_ptr<LineDrawItem> di = nullptr;
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ","}, keySize);
 
       if (tokenList.size() >= 2)
       {
-         di = std::make_shared<LineDrawItem>();
+         std::shared_ptr<LineDrawItem> di = std::make_shared<LineDrawItem>();
 
-         di->threshold_ = threshold_;
-         di->color_     = color_;
-         di->startTime_ = startTime_;
-         di->endTime_   = endTime_;
+         di->threshold_ = state.threshold_;
+         di->color_     = state.color_;
+         di->startTime_ = state.startTime_;
+         di->endTime_   = state.endTime_;
 
-         di->width_ = std::stoul(tokenList[0]);
+         di->width_ = static_cast<double>(StringToUnsigned(tokenList[0]));
 
          if (!tokenList[1].empty())
          {
-            di->flags_ = std::stoul(tokenList[1]);
+            di->flags_ =
+               static_cast<std::int32_t>(StringToUnsigned(tokenList[1]));
          }
-      }
-      if (tokenList.size() >= 3)
-      {
-         ProcessEscapeCharacters(tokenList[2]);
-         TrimQuotes(tokenList[2]);
-         di->hoverText_.swap(tokenList[2]);
-      }
 
-      if (di != nullptr)
-      {
-         currentDrawItem_ = di;
-         drawItems_.emplace_back(std::move(di));
-      }
-      else
-      {
-         logger_->warn("Line statement malformed: {}", line);
+         if (tokenList.size() >= 3)
+         {
+            di->hoverText_ = TrimQuotes(tokenList[2]);
+            ProcessEscapeCharacters(di->hoverText_);
+         }
+
+         return di;
       }
+
+      logger_->warn("Line statement malformed: {}", line);
+      return nullptr;
    }
-   else if (boost::istarts_with(line, trianglesKey_))
+
+   case Keyword::Triangles:
    {
       // Triangles:
       //    lat, lon [, r, g, b [,a]]
       //    ...
       // End:
-      currentStatement_ = DrawingStatement::Triangles;
-
       std::shared_ptr<TrianglesDrawItem> di =
          std::make_shared<TrianglesDrawItem>();
 
-      di->threshold_ = threshold_;
-      di->color_     = color_;
-      di->startTime_ = startTime_;
-      di->endTime_   = endTime_;
+      di->threshold_ = state.threshold_;
+      di->color_     = state.color_;
+      di->startTime_ = state.startTime_;
+      di->endTime_   = state.endTime_;
 
-      currentDrawItem_ = di;
-      drawItems_.emplace_back(std::move(di));
+      return di;
    }
-   else if (boost::istarts_with(line, imageKey_))
+
+   case Keyword::Image:
    {
       // Image: image_file
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, imageKey_.size());
-
-      currentStatement_ = DrawingStatement::Image;
-
-      std::shared_ptr<ImageDrawItem> di = nullptr;
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {" "}, keySize);
 
       if (tokenList.size() >= 1)
       {
-         di = std::make_shared<ImageDrawItem>();
+         std::shared_ptr<ImageDrawItem> di = std::make_shared<ImageDrawItem>();
 
-         di->threshold_ = threshold_;
-         di->startTime_ = startTime_;
-         di->endTime_   = endTime_;
+         di->threshold_ = state.threshold_;
+         di->startTime_ = state.startTime_;
+         di->endTime_   = state.endTime_;
 
-         TrimQuotes(tokenList[0]);
-         di->imageFile_.swap(tokenList[0]);
+         di->imageFile_ = TrimQuotes(tokenList[0]);
 
-         currentDrawItem_ = di;
-         drawItems_.emplace_back(std::move(di));
-      }
-      else
-      {
-         logger_->warn("Image statement malformed: {}", line);
+         return di;
       }
+
+      logger_->warn("Image statement malformed: {}", line);
+      return nullptr;
    }
-   else if (boost::istarts_with(line, polygonKey_))
+
+   case Keyword::Polygon:
    {
       // Polygon:
       //    lat1, lon1 [, r, g, b [,a]] ; start of the first contour
@@ -701,33 +911,36 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    ...
       //    lat2, lon2                  ; and repeating it ends the contour
       // End:
-      currentStatement_ = DrawingStatement::Polygon;
-
       std::shared_ptr<PolygonDrawItem> di = std::make_shared<PolygonDrawItem>();
 
-      di->threshold_ = threshold_;
-      di->color_     = color_;
-      di->startTime_ = startTime_;
-      di->endTime_   = endTime_;
+      di->threshold_ = state.threshold_;
+      di->color_     = state.color_;
+      di->startTime_ = state.startTime_;
+      di->endTime_   = state.endTime_;
 
-      currentDrawItem_ = di;
-      drawItems_.emplace_back(std::move(di));
+      return di;
    }
-   else
-   {
-      logger_->trace("Unknown statement: {}", line);
+
+   default:
+      return nullptr;
    }
 }
 
-void Placefile::Impl::ProcessElement(const std::string& line)
+void Placefile::Impl::ProcessElement(
+   Keyword                                keyword,
+   const std::shared_ptr<DrawItem>&       di,
+   std::string_view                       line,
+   const State&                           state,
+   std::vector<PolygonDrawItem::Element>& polygonContour)
 {
-   if (currentStatement_ == DrawingStatement::Line)
+   if (keyword == Keyword::Line)
    {
       // Line: width, flags [, hover_text]
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList = util::ParseTokens(line, {",", ","});
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ","});
 
       if (tokenList.size() >= 2)
       {
@@ -735,45 +948,47 @@ void Placefile::Impl::ProcessElement(const std::string& line)
 
          ParseLocation(tokenList[0],
                        tokenList[1],
+                       state,
                        element.latitude_,
                        element.longitude_,
                        element.x_,
                        element.y_);
 
-         std::static_pointer_cast<LineDrawItem>(currentDrawItem_)
-            ->elements_.emplace_back(std::move(element));
+         std::static_pointer_cast<LineDrawItem>(di)->elements_.emplace_back(
+            std::move(element));
       }
       else
       {
          logger_->warn("Line sub-statement malformed: {}", line);
       }
    }
-   else if (currentStatement_ == DrawingStatement::Triangles)
+   else if (keyword == Keyword::Triangles)
    {
       // Triangles:
       //    lat, lon [, r, g, b [,a]]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ",", ",", ",", ",", ","});
 
       TrianglesDrawItem::Element element;
 
       if (tokenList.size() >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ = ParseColor(tokenList, 2, state.colorMode_);
       }
 
       if (tokenList.size() >= 2)
       {
          ParseLocation(tokenList[0],
                        tokenList[1],
+                       state,
                        element.latitude_,
                        element.longitude_,
                        element.x_,
                        element.y_);
 
-         std::static_pointer_cast<TrianglesDrawItem>(currentDrawItem_)
+         std::static_pointer_cast<TrianglesDrawItem>(di)
             ->elements_.emplace_back(std::move(element));
       }
       else
@@ -781,14 +996,14 @@ void Placefile::Impl::ProcessElement(const std::string& line)
          logger_->warn("Triangles sub-statement malformed: {}", line);
       }
    }
-   else if (currentStatement_ == DrawingStatement::Image)
+   else if (keyword == Keyword::Image)
    {
       // Image: image_file
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","});
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ",", ",", ","});
 
       ImageDrawItem::Element element;
 
@@ -796,17 +1011,18 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       {
          ParseLocation(tokenList[0],
                        tokenList[1],
+                       state,
                        element.latitude_,
                        element.longitude_,
                        element.x_,
                        element.y_);
 
-         element.tu_ = std::stod(tokenList[2]);
+         element.tu_ = StringToDouble(tokenList[2]);
       }
 
       if (tokenList.size() >= 4)
       {
-         element.tv_ = std::stod(tokenList[3]);
+         element.tv_ = StringToDouble(tokenList[3]);
       }
       else
       {
@@ -815,15 +1031,15 @@ void Placefile::Impl::ProcessElement(const std::string& line)
 
       if (tokenList.size() >= 3)
       {
-         std::static_pointer_cast<ImageDrawItem>(currentDrawItem_)
-            ->elements_.emplace_back(std::move(element));
+         std::static_pointer_cast<ImageDrawItem>(di)->elements_.emplace_back(
+            std::move(element));
       }
       else
       {
          logger_->warn("Image sub-statement malformed: {}", line);
       }
    }
-   else if (currentStatement_ == DrawingStatement::Polygon)
+   else if (keyword == Keyword::Polygon)
    {
       // Polygon:
       //    lat1, lon1 [, r, g, b [,a]] ; start of the first contour
@@ -835,31 +1051,32 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    ...
       //    lat2, lon2                  ; and repeating it ends the contour
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      std::vector<std::string_view> tokenList =
+         util::ParseTokenViews(line, {",", ",", ",", ",", ",", ","});
 
       PolygonDrawItem::Element element;
 
       if (tokenList.size() >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ = ParseColor(tokenList, 2, state.colorMode_);
       }
 
       if (tokenList.size() >= 2)
       {
          ParseLocation(tokenList[0],
                        tokenList[1],
+                       state,
                        element.latitude_,
                        element.longitude_,
                        element.x_,
                        element.y_);
 
-         currentPolygonContour_.emplace_back(std::move(element));
+         polygonContour.emplace_back(std::move(element));
 
-         if (currentPolygonContour_.size() >= 2)
+         if (polygonContour.size() >= 2)
          {
-            auto& first = currentPolygonContour_.front();
-            auto& last  = currentPolygonContour_.back();
+            auto& first = polygonContour.front();
+            auto& last  = polygonContour.back();
 
             // Repeating the first point closes the contour
             if (first.latitude_ == last.latitude_ &&
@@ -868,12 +1085,11 @@ void Placefile::Impl::ProcessElement(const std::string& line)
                 first.y_ == last.y_)
             {
                auto& contours =
-                  std::static_pointer_cast<PolygonDrawItem>(currentDrawItem_)
-                     ->contours_;
+                  std::static_pointer_cast<PolygonDrawItem>(di)->contours_;
 
                auto& newContour = contours.emplace_back(
                   std::vector<PolygonDrawItem::Element> {});
-               newContour.swap(currentPolygonContour_);
+               newContour.swap(polygonContour);
             }
          }
       }
@@ -884,84 +1100,181 @@ void Placefile::Impl::ProcessElement(const std::string& line)
    }
 }
 
-void Placefile::Impl::ProcessElementEnd()
+void Placefile::Impl::ProcessElementEnd(
+   Keyword                                keyword,
+   const std::shared_ptr<DrawItem>&       di,
+   std::vector<PolygonDrawItem::Element>& polygonContour)
 {
-   if (currentStatement_ == DrawingStatement::Polygon)
+   if (keyword == Keyword::Polygon)
    {
-      auto di = std::static_pointer_cast<PolygonDrawItem>(currentDrawItem_);
+      auto polygon = std::static_pointer_cast<PolygonDrawItem>(di);
 
       // Complete the current contour when ending the Polygon statement
-      if (!currentPolygonContour_.empty())
+      if (!polygonContour.empty())
       {
-         auto& contours = di->contours_;
+         auto& contours = polygon->contours_;
 
          auto& newContour =
             contours.emplace_back(std::vector<PolygonDrawItem::Element> {});
-         newContour.swap(currentPolygonContour_);
+         newContour.swap(polygonContour);
       }
 
-      if (!di->contours_.empty())
+      if (!polygon->contours_.empty())
       {
          std::vector<common::Coordinate> coordinates {};
-         std::transform(di->contours_[0].cbegin(),
-                        di->contours_[0].cend(),
+         std::transform(polygon->contours_[0].cbegin(),
+                        polygon->contours_[0].cend(),
                         std::back_inserter(coordinates),
                         [](auto& element) {
                            return common::Coordinate {element.latitude_,
                                                       element.longitude_};
                         });
-         di->center_ = GetCentroid(coordinates);
+         polygon->center_ = GetCentroid(coordinates);
       }
    }
 }
 
-void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
-                                    const std::string& longitudeToken,
-                                    double&            latitude,
-                                    double&            longitude,
-                                    double&            x,
-                                    double&            y)
+void Placefile::Impl::ParseLocation(std::string_view latitudeToken,
+                                    std::string_view longitudeToken,
+                                    const State&     state,
+                                    double&          latitude,
+                                    double&          longitude,
+                                    double&          x,
+                                    double&          y)
 {
-   if (objectStack_.empty())
+   const std::vector<Object>& objectStack = state.objectStack_;
+
+   if (objectStack.empty())
    {
       // If an Object statement is not currently open, parse latitude and
       // longitude tokens as-is
-      latitude  = std::stod(latitudeToken);
-      longitude = std::stod(longitudeToken);
+      latitude  = StringToDouble(latitudeToken);
+      longitude = StringToDouble(longitudeToken);
    }
    else
    {
       // If an Object statement is open, the latitude and longitude are from the
       // outermost Object
-      latitude  = objectStack_[0].x_;
-      longitude = objectStack_[0].y_;
+      latitude  = objectStack[0].x_;
+      longitude = objectStack[0].y_;
 
       // The latitude and longitude tokens are interpreted as x, y offsets
-      x = std::stod(latitudeToken);
-      y = std::stod(longitudeToken);
+      x = StringToDouble(latitudeToken);
+      y = StringToDouble(longitudeToken);
 
       // If there are inner Object statements open, treat these as x, y offsets
-      for (std::size_t i = 1; i < objectStack_.size(); i++)
+      for (std::size_t i = 1; i < objectStack.size(); i++)
       {
-         x += objectStack_[i].x_;
-         y += objectStack_[i].y_;
+         x += objectStack[i].x_;
+         y += objectStack[i].y_;
       }
    }
 }
 
 void Placefile::Impl::ProcessEscapeCharacters(std::string& s)
 {
-   boost::replace_all(s, "\\r", "\r");
-   boost::replace_all(s, "\\n", "\n");
+   if (s.find('\\') != std::string::npos)
+   {
+      boost::replace_all(s, "\\r", "\r");
+      boost::replace_all(s, "\\n", "\n");
+   }
 }
 
-void Placefile::Impl::TrimQuotes(std::string& s)
+std::string_view Placefile::Impl::TrimQuotes(std::string_view s)
 {
    if (s.size() >= 2 && s.front() == '"' && s.back() == '"')
    {
-      s.erase(s.size() - 1);
-      s.erase(0, 1);
+      s.remove_suffix(1);
+      s.remove_prefix(1);
+   }
+
+   return s;
+}
+
+static KeywordInfo FindKeyword(std::string_view line)
+{
+   static constexpr std::array<KeywordInfo, 1> kCKeywords_ {
+      {{"Color:", Keyword::Color}}};
+   static constexpr std::array<KeywordInfo, 1> kEKeywords_ {
+      {{"End:", Keyword::End}}};
+   static constexpr std::array<KeywordInfo, 1> kFKeywords_ {
+      {{"Font:", Keyword::Font}}};
+   static constexpr std::array<KeywordInfo, 1> kHKeywords_ {
+      {{"HSLuv:", Keyword::HSLuv}}};
+   static constexpr std::array<KeywordInfo, 3> kIKeywords_ {
+      {{"IconFile:", Keyword::IconFile},
+       {"Icon:", Keyword::Icon},
+       {"Image:", Keyword::Image}}};
+   static constexpr std::array<KeywordInfo, 1> kLKeywords_ {
+      {{"Line:", Keyword::Line}}};
+   static constexpr std::array<KeywordInfo, 1> kOKeywords_ {
+      {{"Object:", Keyword::Object}}};
+   static constexpr std::array<KeywordInfo, 2> kPKeywords_ {
+      {{"Place:", Keyword::Place}, {"Polygon:", Keyword::Polygon}}};
+   static constexpr std::array<KeywordInfo, 2> kRKeywords_ {
+      {{"Refresh:", Keyword::Refresh},
+       {"RefreshSeconds:", Keyword::RefreshSeconds}}};
+   static constexpr std::array<KeywordInfo, 1> kSKeywords_ {
+      {{"scwx-ModulateIcon:", Keyword::ModulateIcon}}};
+   static constexpr std::array<KeywordInfo, 5> kTKeywords_ {
+      {{"Text:", Keyword::Text},
+       {"Title:", Keyword::Title},
+       {"Threshold:", Keyword::Threshold},
+       {"TimeRange:", Keyword::TimeRange},
+       {"Triangles:", Keyword::Triangles}}};
+
+   std::span<const KeywordInfo> keywords {};
+
+   // Only compare against keywords beginning with the same character
+   switch (std::tolower(static_cast<unsigned char>(line.front())))
+   {
+   case 'c': keywords = kCKeywords_; break;
+   case 'e': keywords = kEKeywords_; break;
+   case 'f': keywords = kFKeywords_; break;
+   case 'h': keywords = kHKeywords_; break;
+   case 'i': keywords = kIKeywords_; break;
+   case 'l': keywords = kLKeywords_; break;
+   case 'o': keywords = kOKeywords_; break;
+   case 'p': keywords = kPKeywords_; break;
+   case 'r': keywords = kRKeywords_; break;
+   case 's': keywords = kSKeywords_; break;
+   case 't': keywords = kTKeywords_; break;
+   default: break;
+   }
+
+   for (auto& keyword : keywords)
+   {
+      if (boost::istarts_with(line, keyword.key_))
+      {
+         return keyword;
+      }
    }
+
+   return {{}, Keyword::Unknown};
+}
+
+static bool IsBlockKeyword(Keyword keyword)
+{
+   return keyword == Keyword::Line || keyword == Keyword::Triangles ||
+          keyword == Keyword::Image || keyword == Keyword::Polygon;
+}
+
+// Numeric tokens are short enough to fit within the small string buffer, so
+// the copies below do not allocate
+
+static double StringToDouble(std::string_view s)
+{
+   return std::stod(std::string {s});
+}
+
+static int StringToInt(std::string_view s)
+{
+   return std::stoi(std::string {s});
+}
+
+static unsigned long StringToUnsigned(std::string_view s)
+{
+   return std::stoul(std::string {s});
 }
 
 } // namespace gr
@@ -0,0 +1,110 @@
+#include <scwx/network/content_validator.hpp>
+#include <scwx/util/digest.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <sstream>
+
+#include <cpr/status_codes.h>
+
+namespace scwx
+{
+namespace network
+{
+
+static const std::string logPrefix_ = "scwx::network::content_validator";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+class ContentValidator::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   Validators validators_ {};
+};
+
+ContentValidator::ContentValidator() : p(std::make_unique<Impl>()) {}
+ContentValidator::~ContentValidator() = default;
+
+ContentValidator::ContentValidator(ContentValidator&&) noexcept = default;
+ContentValidator&
+ContentValidator::operator=(ContentValidator&&) noexcept = default;
+
+void ContentValidator::AddConditionalHeaders(::cpr::Header& header) const
+{
+   if (!p->validators_.etag_.empty())
+   {
+      header.insert_or_assign("If-None-Match", p->validators_.etag_);
+   }
+   if (!p->validators_.lastModified_.empty())
+   {
+      header.insert_or_assign("If-Modified-Since",
+                              p->validators_.lastModified_);
+   }
+}
+
+ContentValidator::Status
+ContentValidator::CheckContent(const std::string& content,
+                               Validators&        validators) const
+{
+   std::istringstream is {content};
+
+   if (!util::ComputeDigest(EVP_sha256(), is, validators.digest_))
+   {
+      logger_->warn("Could not compute content digest");
+      validators.digest_.clear();
+      return Status::Error;
+   }
+
+   return (validators.digest_ == p->validators_.digest_) ? Status::NotModified :
+                                                           Status::Modified;
+}
+
+ContentValidator::Status
+ContentValidator::CheckResponse(const ::cpr::Response& response,
+                                Validators&            validators) const
+{
+   const bool notModified =
+      (response.status_code == ::cpr::status::HTTP_NOT_MODIFIED);
+
+   if (!notModified && !::cpr::status::is_success(response.status_code))
+   {
+      return Status::Error;
+   }
+
+   auto etagIt = response.header.find("ETag");
+   if (etagIt != response.header.cend())
+   {
+      validators.etag_ = etagIt->second;
+   }
+
+   auto lastModifiedIt = response.header.find("Last-Modified");
+   if (lastModifiedIt != response.header.cend())
+   {
+      validators.lastModified_ = lastModifiedIt->second;
+   }
+
+   if (notModified)
+   {
+      return Status::NotModified;
+   }
+
+   return CheckContent(response.text, validators);
+}
+
+void ContentValidator::Accept(Validators&& validators)
+{
+   p->validators_ = std::move(validators);
+}
+
+void ContentValidator::Refresh(Validators&& validators)
+{
+   if (!validators.etag_.empty() || !validators.lastModified_.empty())
+   {
+      p->validators_.etag_         = std::move(validators.etag_);
+      p->validators_.lastModified_ = std::move(validators.lastModified_);
+   }
+}
+
+} // namespace network
+} // namespace scwx
@@ -1,12 +1,18 @@
 #define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
 
 #include <scwx/provider/aws_nexrad_data_provider.hpp>
+#include <scwx/provider/nexrad_object_cache.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
 #include <shared_mutex>
 
 #include <aws/core/auth/AWSCredentials.h>
@@ -24,6 +30,13 @@ static const std::string logPrefix_ =
    "scwx::provider::aws_nexrad_data_provider";
 static const auto logger_ = util::Logger::Create(logPrefix_);
 
+static auto& downloadHistogram_ =
+   util::MetricsRegistry::Instance().GetHistogram("download.nexrad");
+static auto& downloadBytesCounter_ =
+   util::MetricsRegistry::Instance().GetCounter("download.nexrad.bytes");
+static auto& cacheHitCounter_ =
+   util::MetricsRegistry::Instance().GetCounter("download.nexrad.cache_hits");
+
 // Keep at least today, yesterday, and three more dates (archived volume scan
 // list size)
 static const size_t kMinDatesBeforePruning_ = 6;
@@ -303,20 +316,74 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
 
 std::shared_ptr<wsr88d::NexradFile>
 AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
+{
+   return LoadObjectByKey(key, {});
+}
+
+std::shared_ptr<wsr88d::NexradFile> AwsNexradDataProvider::LoadObjectByKey(
+   const std::string&                                      key,
+   const wsr88d::NexradFileFactory::ElevationScanCallback& scanCallback)
 {
    std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
 
+   auto& objectCache  = NexradObjectCache::Instance();
+   auto  cachedObject = objectCache.Find(p->bucketName_, key);
+
+   if (cachedObject.has_value())
+   {
+      std::ifstream is {*cachedObject, std::ios_base::binary};
+
+      if (is.good())
+      {
+         nexradFile = wsr88d::NexradFileFactory::Create(is, scanCallback);
+      }
+
+      if (nexradFile != nullptr)
+      {
+         logger_->debug("Loaded object from cache: {}", key);
+         cacheHitCounter_.Increment();
+         return nexradFile;
+      }
+
+      // The cached object could not be loaded, download it again
+      logger_->warn("Invalid cached object: {}", key);
+      objectCache.Remove(p->bucketName_, key);
+   }
+
    Aws::S3::Model::GetObjectRequest request;
    request.SetBucket(p->bucketName_);
    request.SetKey(key);
 
-   auto outcome = p->client_->GetObject(request);
+   // The object body is fully received before GetObject returns
+   util::ScopedTimer downloadTimer {downloadHistogram_};
+   auto              outcome = p->client_->GetObject(request);
+   downloadTimer.Stop();
 
    if (outcome.IsSuccess())
    {
+      downloadBytesCounter_.Increment(static_cast<std::uint64_t>(
+         std::max<long long>(outcome.GetResult().GetContentLength(), 0)));
+
       auto& body = outcome.GetResultWithOwnership().GetBody();
 
-      nexradFile = wsr88d::NexradFileFactory::Create(body);
+      if (objectCache.enabled())
+      {
+         // Read the object into memory, to both store and load it
+         auto data = std::make_shared<std::vector<char>>(
+            std::istreambuf_iterator<char>(body),
+            std::istreambuf_iterator<char>());
+
+         objectCache.Store(p->bucketName_, key, *data);
+
+         util::arenabuf buffer {data};
+         std::istream   is {&buffer};
+
+         nexradFile = wsr88d::NexradFileFactory::Create(is, scanCallback);
+      }
+      else
+      {
+         nexradFile = wsr88d::NexradFileFactory::Create(body, scanCallback);
+      }
    }
    else
    {
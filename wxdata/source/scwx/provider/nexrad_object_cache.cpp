@@ -0,0 +1,478 @@
+#include <scwx/provider/nexrad_object_cache.hpp>
+#include <scwx/util/digest.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ = "scwx::provider::nexrad_object_cache";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static const std::string kIndexFilename_ {"index"};
+static const std::string kIndexHeader_ {"scwx-nexrad-object-cache 1"};
+static const std::string kTemporaryExtension_ {".tmp"};
+
+static constexpr std::size_t kObjectNameLength_ = 64u;
+
+class NexradObjectCache::Impl
+{
+public:
+   struct Entry
+   {
+      std::string name_;
+      std::size_t size_;
+      std::string object_;
+   };
+
+   typedef std::list<Entry> EntryList;
+
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static bool IsObjectName(const std::string& name);
+
+   void AddEntry(const std::string& name,
+                 std::size_t        size,
+                 const std::string& object,
+                 bool               mostRecent);
+   void EraseEntry(EntryList::iterator it);
+   void EvictOverSize();
+   void ReadIndex();
+   void WriteIndex();
+
+   mutable std::mutex mutex_ {};
+
+   std::filesystem::path directory_ {};
+   std::size_t           maxSize_ {0};
+   std::size_t           size_ {0};
+
+   // Most recently used objects are at the front of the list
+   EntryList                                            entries_ {};
+   std::unordered_map<std::string, EntryList::iterator> entryMap_ {};
+   bool                                                 indexDirty_ {false};
+
+   std::atomic<std::uint64_t> temporaryFileCounter_ {0};
+};
+
+NexradObjectCache::NexradObjectCache() : p(std::make_unique<Impl>()) {}
+NexradObjectCache::~NexradObjectCache()
+{
+   Flush();
+}
+
+bool NexradObjectCache::enabled() const
+{
+   std::unique_lock lock {p->mutex_};
+   return !p->directory_.empty();
+}
+
+std::size_t NexradObjectCache::max_size() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->maxSize_;
+}
+
+std::size_t NexradObjectCache::object_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->entries_.size();
+}
+
+std::size_t NexradObjectCache::size() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->size_;
+}
+
+bool NexradObjectCache::Impl::IsObjectName(const std::string& name)
+{
+   return name.size() == kObjectNameLength_ &&
+          std::all_of(name.cbegin(),
+                      name.cend(),
+                      [](char c)
+                      {
+                         return (c >= '0' && c <= '9') ||
+                                (c >= 'a' && c <= 'f');
+                      });
+}
+
+void NexradObjectCache::Impl::AddEntry(const std::string& name,
+                                       std::size_t        size,
+                                       const std::string& object,
+                                       bool               mostRecent)
+{
+   auto it = entryMap_.find(name);
+   if (it != entryMap_.end())
+   {
+      EraseEntry(it->second);
+   }
+
+   auto entryIt = entries_.insert(mostRecent ? entries_.begin() :
+                                               entries_.end(),
+                                  {name, size, object});
+   entryMap_.emplace(name, entryIt);
+   size_ += size;
+}
+
+void NexradObjectCache::Impl::EraseEntry(EntryList::iterator it)
+{
+   size_ -= std::min(size_, it->size_);
+   entryMap_.erase(it->name_);
+   entries_.erase(it);
+}
+
+void NexradObjectCache::Impl::EvictOverSize()
+{
+   std::size_t evictedCount = 0;
+
+   while (size_ > maxSize_ && !entries_.empty())
+   {
+      auto it = std::prev(entries_.end());
+
+      std::error_code error {};
+      std::filesystem::remove(directory_ / it->name_, error);
+      if (error)
+      {
+         logger_->warn("Could not remove {}: {}", it->name_, error.message());
+      }
+
+      EraseEntry(it);
+      ++evictedCount;
+   }
+
+   if (evictedCount > 0)
+   {
+      logger_->debug("Evicted {} objects", evictedCount);
+      indexDirty_ = true;
+   }
+}
+
+void NexradObjectCache::Impl::ReadIndex()
+{
+   std::error_code error {};
+
+   std::ifstream indexFile {directory_ / kIndexFilename_};
+   std::string   line {};
+
+   if (indexFile.good() && std::getline(indexFile, line) &&
+       line == kIndexHeader_)
+   {
+      while (std::getline(indexFile, line))
+      {
+         std::istringstream lineStream {line};
+         std::string        name {};
+         std::size_t        size {};
+         std::string        object {};
+
+         if (!(lineStream >> name >> size))
+         {
+            continue;
+         }
+
+         // The object may be empty, if it was not known when it was indexed
+         std::getline(lineStream >> std::ws, object);
+
+         // Only add entries whose files are intact
+         if (IsObjectName(name) &&
+             std::filesystem::file_size(directory_ / name, error) == size &&
+             !error)
+         {
+            AddEntry(name, size, object, false);
+         }
+      }
+   }
+   else if (indexFile.good())
+   {
+      logger_->warn("Invalid index file, rebuilding");
+   }
+
+   // Add any files not in the index as the least recently used objects, newest
+   // first
+   std::vector<std::pair<std::filesystem::file_time_type, Entry>> unindexed {};
+
+   for (auto& directoryEntry :
+        std::filesystem::directory_iterator(directory_, error))
+   {
+      const std::string name = directoryEntry.path().filename().string();
+
+      if (!directoryEntry.is_regular_file(error))
+      {
+         continue;
+      }
+
+      if (name.ends_with(kTemporaryExtension_))
+      {
+         // Remove incomplete files from a previous session
+         std::filesystem::remove(directoryEntry.path(), error);
+      }
+      else if (IsObjectName(name) && !entryMap_.contains(name))
+      {
+         unindexed.push_back(
+            {directoryEntry.last_write_time(error),
+             {name, static_cast<std::size_t>(directoryEntry.file_size(error)),
+              {}}});
+      }
+   }
+
+   std::sort(unindexed.begin(),
+             unindexed.end(),
+             [](auto& a, auto& b) { return a.first > b.first; });
+
+   for (auto& [time, entry] : unindexed)
+   {
+      AddEntry(entry.name_, entry.size_, entry.object_, false);
+   }
+
+   logger_->debug("Loaded {} objects ({} unindexed), {} bytes",
+                  entries_.size(),
+                  unindexed.size(),
+                  size_);
+
+   indexDirty_ = true;
+}
+
+void NexradObjectCache::Impl::WriteIndex()
+{
+   const std::filesystem::path indexPath = directory_ / kIndexFilename_;
+   const std::filesystem::path temporaryPath =
+      directory_ / (kIndexFilename_ + kTemporaryExtension_);
+
+   {
+      std::ofstream indexFile {temporaryPath, std::ios_base::trunc};
+
+      indexFile << kIndexHeader_ << '\n';
+      for (auto& entry : entries_)
+      {
+         indexFile << entry.name_ << ' ' << entry.size_ << ' ' << entry.object_
+                   << '\n';
+      }
+
+      if (!indexFile.good())
+      {
+         logger_->warn("Could not write index file");
+         return;
+      }
+   }
+
+   std::error_code error {};
+   std::filesystem::rename(temporaryPath, indexPath, error);
+   if (error)
+   {
+      logger_->warn("Could not replace index file: {}", error.message());
+      return;
+   }
+
+   indexDirty_ = false;
+}
+
+std::optional<std::string> NexradObjectCache::Find(const std::string& bucket,
+                                                   const std::string& key)
+{
+   const std::string name = GetObjectName(bucket, key);
+
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->entryMap_.find(name);
+   if (name.empty() || p->directory_.empty() || it == p->entryMap_.end())
+   {
+      return std::nullopt;
+   }
+
+   // Mark the object as most recently used
+   p->entries_.splice(p->entries_.begin(), p->entries_, it->second);
+   p->indexDirty_ = true;
+
+   return (p->directory_ / name).string();
+}
+
+void NexradObjectCache::Flush()
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (!p->directory_.empty() && p->indexDirty_)
+   {
+      p->WriteIndex();
+   }
+}
+
+void NexradObjectCache::Remove(const std::string& bucket,
+                               const std::string& key)
+{
+   const std::string name = GetObjectName(bucket, key);
+
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->entryMap_.find(name);
+   if (name.empty() || p->directory_.empty() || it == p->entryMap_.end())
+   {
+      return;
+   }
+
+   std::error_code error {};
+   std::filesystem::remove(p->directory_ / name, error);
+
+   p->EraseEntry(it->second);
+   p->WriteIndex();
+}
+
+void NexradObjectCache::SetDirectory(const std::string& directory)
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (!p->directory_.empty() && p->indexDirty_)
+   {
+      p->WriteIndex();
+   }
+
+   p->entries_.clear();
+   p->entryMap_.clear();
+   p->size_       = 0;
+   p->indexDirty_ = false;
+   p->directory_  = directory;
+
+   if (p->directory_.empty())
+   {
+      return;
+   }
+
+   std::error_code error {};
+   std::filesystem::create_directories(p->directory_, error);
+   if (error)
+   {
+      logger_->warn("Could not create cache directory: {}", error.message());
+      p->directory_.clear();
+      return;
+   }
+
+   logger_->debug("Cache directory: {}", directory);
+
+   p->ReadIndex();
+   p->EvictOverSize();
+   p->WriteIndex();
+}
+
+void NexradObjectCache::SetMaxSize(std::size_t maxSize)
+{
+   std::unique_lock lock {p->mutex_};
+
+   p->maxSize_ = maxSize;
+
+   if (!p->directory_.empty())
+   {
+      p->EvictOverSize();
+      if (p->indexDirty_)
+      {
+         p->WriteIndex();
+      }
+   }
+}
+
+bool NexradObjectCache::Store(const std::string&    bucket,
+                              const std::string&    key,
+                              std::span<const char> data)
+{
+   const std::string name = GetObjectName(bucket, key);
+
+   std::unique_lock lock {p->mutex_};
+
+   const std::filesystem::path directory = p->directory_;
+   if (name.empty() || directory.empty() || data.size() > p->maxSize_)
+   {
+      return false;
+   }
+
+   lock.unlock();
+
+   // Write the object to a temporary file without holding the lock, so the
+   // cache may be used by other threads
+   const std::filesystem::path temporaryPath =
+      directory / fmt::format("{}.{}{}",
+                              name,
+                              p->temporaryFileCounter_.fetch_add(1),
+                              kTemporaryExtension_);
+
+   {
+      std::ofstream objectFile {temporaryPath,
+                                std::ios_base::binary | std::ios_base::trunc};
+      objectFile.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+      if (!objectFile.good())
+      {
+         logger_->warn("Could not write object: {}", key);
+         objectFile.close();
+
+         std::error_code error {};
+         std::filesystem::remove(temporaryPath, error);
+         return false;
+      }
+   }
+
+   lock.lock();
+
+   std::error_code error {};
+
+   if (p->directory_ != directory)
+   {
+      // The cache directory changed while the object was being written
+      std::filesystem::remove(temporaryPath, error);
+      return false;
+   }
+
+   std::filesystem::rename(temporaryPath, directory / name, error);
+   if (error)
+   {
+      logger_->warn("Could not store object: {}", error.message());
+      std::filesystem::remove(temporaryPath, error);
+      return false;
+   }
+
+   p->AddEntry(name, data.size(), fmt::format("{}/{}", bucket, key), true);
+   p->EvictOverSize();
+   p->WriteIndex();
+
+   return true;
+}
+
+std::string NexradObjectCache::GetObjectName(const std::string& bucket,
+                                             const std::string& key)
+{
+   std::istringstream        is {fmt::format("{}/{}", bucket, key)};
+   std::vector<std::uint8_t> digest {};
+
+   if (!util::ComputeDigest(EVP_sha256(), is, digest))
+   {
+      return {};
+   }
+
+   std::string name {};
+   name.reserve(digest.size() * 2);
+   for (std::uint8_t byte : digest)
+   {
+      name += fmt::format("{:02x}", byte);
+   }
+
+   return name;
+}
+
+NexradObjectCache& NexradObjectCache::Instance()
+{
+   static NexradObjectCache instance_ {};
+   return instance_;
+}
+
+} // namespace provider
+} // namespace scwx
@@ -1,9 +1,12 @@
 #include <scwx/provider/warnings_provider.hpp>
+#include <scwx/common/characters.hpp>
 #include <scwx/network/dir_list.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <optional>
 #include <ranges>
 #include <shared_mutex>
+#include <tuple>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -11,6 +14,7 @@
 
 #define LIBXML_HTML_ENABLED
 #include <cpr/cpr.h>
+#include <fmt/format.h>
 #include <libxml/HTMLparser.h>
 #include <re2/re2.h>
 
@@ -30,6 +34,14 @@ namespace provider
 static const std::string logPrefix_ = "scwx::provider::warnings_provider";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+struct ContentRange
+{
+   std::optional<std::size_t> start_ {};
+   std::optional<std::size_t> length_ {};
+};
+
+static ContentRange ParseContentRange(const std::string& contentRange);
+
 class WarningsProvider::Impl
 {
 public:
@@ -39,6 +51,11 @@ public:
       std::chrono::system_clock::time_point lastModified_ {};
       size_t                                size_ {};
       bool                                  updated_ {};
+
+      // Bytes of the file that have been loaded, ending with a complete
+      // message. Warnings files are only appended to, so only the remainder
+      // of the file is requested.
+      size_t offset_ {};
    };
 
    typedef std::map<std::string, FileInfoRecord> WarningFileMap;
@@ -119,8 +136,9 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
       if (!ssFilename.fail())
       {
          // Determine if the record should be marked updated
-         bool updated = true;
-         auto it      = p->files_.find(record.filename_);
+         bool   updated = true;
+         size_t offset  = 0;
+         auto   it      = p->files_.find(record.filename_);
          if (it != p->files_.cend())
          {
             auto& existingRecord = it->second;
@@ -128,6 +146,7 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
             updated = existingRecord.updated_ ||
                       record.size_ != existingRecord.size_ ||
                       record.mtime_ != existingRecord.lastModified_;
+            offset  = existingRecord.offset_;
          }
 
          // Update object counts, but only if newer than threshold
@@ -145,7 +164,7 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
             std::piecewise_construct,
             std::forward_as_tuple(record.filename_),
             std::forward_as_tuple(
-               startTime, record.mtime_, record.size_, updated));
+               startTime, record.mtime_, record.size_, updated, offset));
       }
    }
 
@@ -162,7 +181,8 @@ WarningsProvider::LoadUpdatedFiles(
 
    std::vector<std::shared_ptr<awips::TextProductFile>> updatedFiles;
 
-   std::vector<std::pair<std::string, cpr::AsyncResponse>> asyncResponses;
+   std::vector<std::tuple<std::string, size_t, cpr::AsyncResponse>>
+      asyncResponses;
 
    std::unique_lock lock(p->filesMutex_);
 
@@ -172,10 +192,23 @@ WarningsProvider::LoadUpdatedFiles(
       // If file is updated, and time is later than the threshold
       if (record.second.updated_ && newerThan < record.second.startTime_)
       {
-         // Retrieve warning file
+         const size_t offset = record.second.offset_;
+
+         // Retrieve the remainder of the warning file. The range applies to
+         // the encoded content, so the content must not be encoded.
+         cpr::Header header {};
+         if (offset > 0)
+         {
+            header.emplace("Range", fmt::format("bytes={}-", offset));
+         }
+
          asyncResponses.emplace_back(
             record.first,
-            cpr::GetAsync(cpr::Url {p->baseUrl_ + "/" + record.first}));
+            offset,
+            cpr::GetAsync(
+               cpr::Url {p->baseUrl_ + "/" + record.first},
+               header,
+               cpr::AcceptEncoding {{cpr::AcceptEncodingMethods::identity}}));
 
          // Clear updated flag
          record.second.updated_ = false;
@@ -185,26 +218,135 @@ WarningsProvider::LoadUpdatedFiles(
    lock.unlock();
 
    // Wait for warning files to load
-   for (auto& asyncResponse : asyncResponses)
+   for (auto& [filename, offset, asyncResponse] : asyncResponses)
    {
-      cpr::Response response = asyncResponse.second.get();
-      if (response.status_code == cpr::status::HTTP_OK)
+      cpr::Response response = asyncResponse.get();
+
+      // Offset of the response body within the file
+      size_t      dataOffset = offset;
+      std::string data {};
+      bool        reload     = false;
+
+      if (response.status_code == cpr::status::HTTP_PARTIAL_CONTENT)
+      {
+         ContentRange contentRange =
+            ParseContentRange(response.header["Content-Range"]);
+
+         if (contentRange.start_ != offset)
+         {
+            logger_->warn("Unexpected range for file: {}", filename);
+            reload = true;
+         }
+         else
+         {
+            data = std::move(response.text);
+         }
+      }
+      else if (response.status_code == cpr::status::HTTP_OK)
+      {
+         if (response.text.size() >= offset)
+         {
+            // The range was not applied, skip previously loaded data
+            data = response.text.substr(offset);
+         }
+         else
+         {
+            // The file was replaced with a shorter file
+            logger_->debug("File truncated: {}", filename);
+            dataOffset = 0;
+            data       = std::move(response.text);
+         }
+      }
+      else if (response.status_code ==
+               cpr::status::HTTP_REQUESTED_RANGE_NOT_SATISFIABLE)
       {
-         logger_->debug("Loading file: {}", asyncResponse.first);
+         ContentRange contentRange =
+            ParseContentRange(response.header["Content-Range"]);
+
+         // No data has been appended, unless the file was replaced with a
+         // shorter file
+         if (contentRange.length_.value_or(offset) < offset)
+         {
+            logger_->debug("File truncated: {}", filename);
+            reload = true;
+         }
+      }
+      else
+      {
+         logger_->warn("Could not load file: {} ({})",
+                       filename,
+                       response.status_code);
+      }
+
+      // Only load complete messages, the remainder will be requested again
+      // once the file has been updated
+      const size_t messageEnd = data.rfind(common::Characters::ETX);
+
+      if (!reload && messageEnd != std::string::npos)
+      {
+         data.resize(messageEnd + 1);
+         dataOffset += data.size();
+
+         logger_->debug("Loading file: {} ({} bytes)", filename, data.size());
 
          // Load file
          std::shared_ptr<awips::TextProductFile> textProductFile {
             std::make_shared<awips::TextProductFile>()};
-         std::istringstream responseBody {response.text};
-         if (textProductFile->LoadData(responseBody))
+         if (textProductFile->LoadData(data))
          {
             updatedFiles.push_back(textProductFile);
          }
       }
+
+      lock.lock();
+
+      auto it = p->files_.find(filename);
+      if (it != p->files_.end())
+      {
+         if (reload)
+         {
+            // The file cannot be loaded incrementally, reload the entire file
+            it->second.offset_  = 0;
+            it->second.updated_ = true;
+         }
+         else if (messageEnd != std::string::npos)
+         {
+            it->second.offset_ = dataOffset;
+         }
+      }
+
+      lock.unlock();
    }
 
    return updatedFiles;
 }
 
+static ContentRange ParseContentRange(const std::string& contentRange)
+{
+   // Content-Range: bytes <start>-<end>/<length>
+   // Content-Range: bytes <start>-<end>/*
+   // Content-Range: bytes */<length>
+   static constexpr LazyRE2 reContentRange = {
+      R"(bytes (?:(\d+)-\d+|\*)/(\d+|\*))"};
+
+   ContentRange result {};
+   std::string  start {};
+   std::string  length {};
+
+   if (RE2::FullMatch(contentRange, *reContentRange, &start, &length))
+   {
+      if (!start.empty())
+      {
+         result.start_ = std::stoull(start);
+      }
+      if (length != "*")
+      {
+         result.length_ = std::stoull(length);
+      }
+   }
+
+   return result;
+}
+
 } // namespace provider
 } // namespace scwx
@@ -0,0 +1,25 @@
+#include <scwx/util/arenabuf.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+arenabuf::arenabuf(std::shared_ptr<std::vector<char>> arena) :
+    vectorbuf(*arena), arena_ {std::move(arena)}
+{
+   update_read_pointers(arena_->size());
+}
+
+const std::shared_ptr<std::vector<char>>& arenabuf::arena() const
+{
+   return arena_;
+}
+
+char* arenabuf::current() const
+{
+   return gptr();
+}
+
+} // namespace util
+} // namespace scwx
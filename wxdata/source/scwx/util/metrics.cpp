@@ -0,0 +1,304 @@
+#include <scwx/util/metrics.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+namespace scwx
+{
+namespace util
+{
+
+static constexpr std::size_t kSubBucketBits_  = 2u;
+static constexpr std::size_t kSubBucketCount_ = 1u << kSubBucketBits_;
+
+static std::size_t   BucketIndex(std::uint64_t value);
+static std::uint64_t BucketMidpoint(std::size_t index);
+
+Counter::Counter(const std::string& name) : name_ {name} {}
+Counter::~Counter() = default;
+
+const std::string& Counter::name() const
+{
+   return name_;
+}
+
+std::uint64_t Counter::value() const
+{
+   return value_.load(std::memory_order_relaxed);
+}
+
+void Counter::Reset()
+{
+   value_.store(0, std::memory_order_relaxed);
+}
+
+Histogram::Histogram(const std::string& name) : name_ {name} {}
+Histogram::~Histogram() = default;
+
+const std::string& Histogram::name() const
+{
+   return name_;
+}
+
+void Histogram::Record(std::chrono::nanoseconds duration)
+{
+   const std::uint64_t value =
+      static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count(), 0));
+
+   buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+   total_.fetch_add(value, std::memory_order_relaxed);
+
+   std::uint64_t min = min_.load(std::memory_order_relaxed);
+   while (value < min &&
+          !min_.compare_exchange_weak(min, value, std::memory_order_relaxed))
+   {
+   }
+
+   std::uint64_t max = max_.load(std::memory_order_relaxed);
+   while (value > max &&
+          !max_.compare_exchange_weak(max, value, std::memory_order_relaxed))
+   {
+   }
+}
+
+void Histogram::Reset()
+{
+   for (auto& bucket : buckets_)
+   {
+      bucket.store(0, std::memory_order_relaxed);
+   }
+
+   total_.store(0, std::memory_order_relaxed);
+   min_.store(UINT64_MAX, std::memory_order_relaxed);
+   max_.store(0, std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::GetSnapshot() const
+{
+   Snapshot snapshot {};
+   snapshot.name_ = name_;
+
+   // Samples recorded while taking the snapshot may be partially included
+   std::array<std::uint64_t, kBucketCount_> buckets {};
+   std::uint64_t                            count = 0;
+   for (std::size_t i = 0; i < kBucketCount_; ++i)
+   {
+      buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+      count += buckets[i];
+   }
+
+   if (count == 0)
+   {
+      return snapshot;
+   }
+
+   const std::uint64_t min = min_.load(std::memory_order_relaxed);
+   const std::uint64_t max =
+      std::max(max_.load(std::memory_order_relaxed), min);
+
+   snapshot.count_ = count;
+   snapshot.total_ = std::chrono::nanoseconds {
+      static_cast<std::int64_t>(total_.load(std::memory_order_relaxed))};
+   snapshot.min_  = std::chrono::nanoseconds {static_cast<std::int64_t>(min)};
+   snapshot.max_  = std::chrono::nanoseconds {static_cast<std::int64_t>(max)};
+   snapshot.mean_ = snapshot.total_ / count;
+
+   auto percentile = [&](double fraction)
+   {
+      // Rank of the sample at the requested percentile, starting at 1
+      const std::uint64_t rank = std::max<std::uint64_t>(
+         static_cast<std::uint64_t>(
+            std::ceil(fraction * static_cast<double>(count))),
+         1);
+
+      std::uint64_t cumulative = 0;
+      std::size_t   i          = 0;
+      for (; i < kBucketCount_ - 1; ++i)
+      {
+         cumulative += buckets[i];
+         if (cumulative >= rank)
+         {
+            break;
+         }
+      }
+
+      // The bucket midpoint is an estimate, which cannot exceed the bounds
+      const std::uint64_t value = std::clamp(BucketMidpoint(i), min, max);
+      return std::chrono::nanoseconds {static_cast<std::int64_t>(value)};
+   };
+
+   snapshot.p50_ = percentile(0.50);
+   snapshot.p90_ = percentile(0.90);
+   snapshot.p99_ = percentile(0.99);
+
+   return snapshot;
+}
+
+static std::size_t BucketIndex(std::uint64_t value)
+{
+   // Values smaller than the sub-bucket count are stored exactly
+   if (value < kSubBucketCount_)
+   {
+      return static_cast<std::size_t>(value);
+   }
+
+   // Each power of two is divided into linear sub-buckets
+   const std::size_t exponent =
+      static_cast<std::size_t>(std::bit_width(value)) - 1u;
+   const std::size_t subBucket = static_cast<std::size_t>(
+      (value >> (exponent - kSubBucketBits_)) & (kSubBucketCount_ - 1u));
+
+   return (exponent - kSubBucketBits_ + 1u) * kSubBucketCount_ + subBucket;
+}
+
+static std::uint64_t BucketMidpoint(std::size_t index)
+{
+   if (index < kSubBucketCount_)
+   {
+      return index;
+   }
+
+   const std::size_t exponent =
+      index / kSubBucketCount_ + kSubBucketBits_ - 1u;
+   const std::size_t subBucket = index % kSubBucketCount_;
+   const std::size_t shift     = exponent - kSubBucketBits_;
+
+   const std::uint64_t lower = (kSubBucketCount_ + subBucket) << shift;
+   const std::uint64_t width = std::uint64_t {1} << shift;
+
+   return lower + width / 2u;
+}
+
+ScopedTimer::ScopedTimer(Histogram& histogram) :
+    histogram_ {&histogram}, start_ {std::chrono::steady_clock::now()}
+{
+}
+
+ScopedTimer::~ScopedTimer()
+{
+   Stop();
+}
+
+void ScopedTimer::Stop()
+{
+   if (histogram_ != nullptr)
+   {
+      histogram_->Record(std::chrono::steady_clock::now() - start_);
+      histogram_ = nullptr;
+   }
+}
+
+class MetricsRegistry::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   // Metrics are never removed, so references remain valid after the lock is
+   // released
+   mutable std::shared_mutex                         mutex_ {};
+   std::map<std::string, std::unique_ptr<Counter>>   counters_ {};
+   std::map<std::string, std::unique_ptr<Histogram>> histograms_ {};
+};
+
+MetricsRegistry::MetricsRegistry() : p(std::make_unique<Impl>()) {}
+MetricsRegistry::~MetricsRegistry() = default;
+
+Counter& MetricsRegistry::GetCounter(const std::string& name)
+{
+   {
+      std::shared_lock lock {p->mutex_};
+      auto             it = p->counters_.find(name);
+      if (it != p->counters_.end())
+      {
+         return *it->second;
+      }
+   }
+
+   std::unique_lock lock {p->mutex_};
+   auto&            counter = p->counters_[name];
+   if (counter == nullptr)
+   {
+      counter = std::make_unique<Counter>(name);
+   }
+   return *counter;
+}
+
+Histogram& MetricsRegistry::GetHistogram(const std::string& name)
+{
+   {
+      std::shared_lock lock {p->mutex_};
+      auto             it = p->histograms_.find(name);
+      if (it != p->histograms_.end())
+      {
+         return *it->second;
+      }
+   }
+
+   std::unique_lock lock {p->mutex_};
+   auto&            histogram = p->histograms_[name];
+   if (histogram == nullptr)
+   {
+      histogram = std::make_unique<Histogram>(name);
+   }
+   return *histogram;
+}
+
+std::vector<MetricsRegistry::CounterSnapshot>
+MetricsRegistry::GetCounterSnapshots() const
+{
+   std::shared_lock lock {p->mutex_};
+
+   std::vector<CounterSnapshot> snapshots {};
+   snapshots.reserve(p->counters_.size());
+
+   for (auto& counter : p->counters_)
+   {
+      snapshots.push_back({counter.first, counter.second->value()});
+   }
+
+   return snapshots;
+}
+
+std::vector<Histogram::Snapshot> MetricsRegistry::GetHistogramSnapshots() const
+{
+   std::shared_lock lock {p->mutex_};
+
+   std::vector<Histogram::Snapshot> snapshots {};
+   snapshots.reserve(p->histograms_.size());
+
+   for (auto& histogram : p->histograms_)
+   {
+      snapshots.push_back(histogram.second->GetSnapshot());
+   }
+
+   return snapshots;
+}
+
+void MetricsRegistry::Reset()
+{
+   std::shared_lock lock {p->mutex_};
+
+   for (auto& counter : p->counters_)
+   {
+      counter.second->Reset();
+   }
+
+   for (auto& histogram : p->histograms_)
+   {
+      histogram.second->Reset();
+   }
+}
+
+MetricsRegistry& MetricsRegistry::Instance()
+{
+   static MetricsRegistry instance_ {};
+   return instance_;
+}
+
+} // namespace util
+} // namespace scwx
@@ -42,5 +42,40 @@ std::istream& getline(std::istream& is, std::string& t)
    }
 }
 
+bool getline(std::string_view& data, std::string_view& line)
+{
+   if (data.empty())
+   {
+      line = {};
+      return false;
+   }
+
+   const std::size_t end = data.find_first_of("\r\n");
+   if (end == std::string_view::npos)
+   {
+      line = data;
+      data = {};
+      return true;
+   }
+
+   line = data.substr(0, end);
+
+   std::size_t next = end + 1;
+   if (data[end] == '\r')
+   {
+      while (next < data.size() && data[next] == '\r')
+      {
+         ++next;
+      }
+      if (next < data.size() && data[next] == '\n')
+      {
+         ++next;
+      }
+   }
+
+   data.remove_prefix(next);
+   return true;
+}
+
 } // namespace util
 } // namespace scwx
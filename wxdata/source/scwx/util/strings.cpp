@@ -138,6 +138,86 @@ std::vector<std::string> ParseTokens(const std::string&       s,
    return tokens;
 }
 
+std::vector<std::string_view>
+ParseTokenViews(std::string_view                        s,
+                std::initializer_list<std::string_view> delimiters,
+                std::size_t                             pos)
+{
+   std::vector<std::string_view> tokens {};
+   std::size_t                   findPos {};
+
+   tokens.reserve(delimiters.size() + 1);
+
+   // Iterate through each delimiter
+   for (auto it = delimiters.begin();
+        it != delimiters.end() && pos != std::string_view::npos;
+        ++it)
+   {
+      // Skip leading spaces
+      while (pos < s.size() && std::isspace(s[pos]))
+      {
+         ++pos;
+      }
+
+      if (pos < s.size() && s[pos] == '"')
+      {
+         // Do not search for a delimeter within a quoted string
+         findPos = s.find('"', pos + 1);
+
+         // Increment search start to one after quotation mark
+         if (findPos != std::string_view::npos)
+         {
+            ++findPos;
+         }
+      }
+      else
+      {
+         // Search starting at the current position
+         findPos = pos;
+      }
+
+      // Search for delimiter
+      std::size_t nextPos = s.find_first_of(*it, findPos);
+
+      // If the delimiter was not found, stop processing tokens
+      if (nextPos == std::string_view::npos)
+      {
+         break;
+      }
+
+      // Add the current substring as a token
+      tokens.push_back(TrimWhitespace(s.substr(pos, nextPos - pos)));
+
+      // Increment nextPos until the next non-space character
+      while (++nextPos < s.size() && std::isspace(s[nextPos])) {}
+
+      // Store new position value
+      pos = nextPos;
+   }
+
+   // Add the remainder of the string as a token
+   if (pos < s.size())
+   {
+      tokens.push_back(TrimWhitespace(s.substr(pos)));
+   }
+
+   return tokens;
+}
+
+std::string_view TrimWhitespace(std::string_view s)
+{
+   static constexpr std::string_view kWhitespace_ {" \t\n\v\f\r"};
+
+   const std::size_t first = s.find_first_not_of(kWhitespace_);
+   if (first == std::string_view::npos)
+   {
+      return {};
+   }
+
+   const std::size_t last = s.find_last_not_of(kWhitespace_);
+   return s.substr(first, last - first + 1);
+}
+
 std::string ToString(const std::vector<std::string>& v)
 {
    std::string value {};
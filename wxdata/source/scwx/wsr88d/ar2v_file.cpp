@@ -2,12 +2,21 @@
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
 #include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <execution>
 #include <fstream>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
 #include <sstream>
+#include <thread>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -21,6 +30,8 @@
 
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/bzip2.hpp>
 
@@ -40,17 +51,39 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static auto& decompressHistogram_ =
+   util::MetricsRegistry::Instance().GetHistogram("decode.level2.decompress");
+static auto& parseHistogram_ =
+   util::MetricsRegistry::Instance().GetHistogram("decode.level2.parse");
+
+static constexpr float kElevationScaleFactor_ = 8.0f / 0.043945f;
+
+struct LdmRecord
+{
+   std::size_t       index_ {};
+   std::vector<char> compressedData_ {};
+
+   std::vector<std::shared_ptr<rda::Level2Message>> messages_ {};
+};
+
 class Ar2vFileImpl
 {
 public:
    explicit Ar2vFileImpl() {};
    ~Ar2vFileImpl() = default;
 
-   std::size_t DecompressLDMRecords(std::istream& is);
+   std::size_t ReadLDMRecords(std::istream& is);
    void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
    void        IndexFile();
-   void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   void        IndexCompletedElevationScans();
+   void        ProcessLDMRecords();
+   void        ProcessLDMRecord(LdmRecord& record);
+
+   std::optional<float> IndexElevationScan(std::uint16_t elevationIndex);
+
+   static std::vector<std::shared_ptr<rda::Level2Message>>
+   ParseLDMRecord(std::istream& is);
+
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
 
    std::string   tapeFilename_ {};
@@ -61,6 +94,18 @@ public:
 
    std::size_t messageCount_ {0};
 
+   // Decompressed record data, referenced in place by parsed radar data
+   std::atomic<std::size_t> residentBytes_ {0};
+
+   Ar2vFile::ElevationScanCallback elevationScanCallback_ {};
+
+   // Elevation scans may be indexed and accessed while loading is in progress
+   mutable std::shared_mutex dataMutex_ {};
+
+   std::optional<std::uint16_t> currentElevationIndex_ {};
+   std::vector<std::uint16_t>   completedElevations_ {};
+   std::set<std::uint16_t>      indexedElevations_ {};
+
    std::shared_ptr<rda::VolumeCoveragePatternData>              vcpData_ {};
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData_ {};
 
@@ -70,7 +115,7 @@ public:
                               std::shared_ptr<rda::ElevationScan>>>>
       index_ {};
 
-   std::list<std::stringstream> rawRecords_ {};
+   std::vector<LdmRecord> ldmRecords_ {};
 };
 
 Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
@@ -96,9 +141,15 @@ std::string Ar2vFile::icao() const
 
 std::size_t Ar2vFile::message_count() const
 {
+   std::shared_lock lock {p->dataMutex_};
    return p->messageCount_;
 }
 
+std::size_t Ar2vFile::resident_bytes() const
+{
+   return p->residentBytes_.load(std::memory_order_relaxed);
+}
+
 std::chrono::system_clock::time_point Ar2vFile::start_time() const
 {
    return util::TimePoint(p->julianDate_, p->milliseconds_);
@@ -108,10 +159,12 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 {
    std::chrono::system_clock::time_point endTime {};
 
+   std::shared_lock lock {p->dataMutex_};
+
    if (p->radarData_.size() > 0)
    {
       std::shared_ptr<rda::GenericRadarData> lastRadial =
-         p->radarData_.crbegin()->second->crbegin()->second;
+         p->radarData_.crbegin()->second->back();
 
       endTime = util::TimePoint(lastRadial->modified_julian_date(),
                                 lastRadial->collection_time());
@@ -123,11 +176,13 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
 Ar2vFile::radar_data() const
 {
+   std::shared_lock lock {p->dataMutex_};
    return p->radarData_;
 }
 
 std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
 {
+   std::shared_lock lock {p->dataMutex_};
    return p->vcpData_;
 }
 
@@ -138,7 +193,7 @@ Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
 {
    logger_->debug("GetElevationScan: {} degrees", elevation);
 
-   constexpr float scaleFactor = 8.0f / 0.043945f;
+   constexpr float scaleFactor = kElevationScaleFactor_;
 
    std::shared_ptr<rda::ElevationScan> elevationScan = nullptr;
    float                               elevationCut  = 0.0f;
@@ -147,6 +202,8 @@ Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
    std::uint16_t codedElevation =
       static_cast<std::uint16_t>(std::lroundf(elevation * scaleFactor));
 
+   std::shared_lock lock {p->dataMutex_};
+
    if (p->index_.contains(dataBlockType))
    {
       auto& scans = p->index_.at(dataBlockType);
@@ -201,6 +258,11 @@ Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
    return std::tie(elevationScan, elevationCut, elevationCuts);
 }
 
+void Ar2vFile::SetElevationScanCallback(ElevationScanCallback callback)
+{
+   p->elevationScanCallback_ = std::move(callback);
+}
+
 bool Ar2vFile::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
@@ -259,14 +321,28 @@ bool Ar2vFile::LoadData(std::istream& is)
       logger_->debug("Time:      {}", p->milliseconds_);
       logger_->debug("ICAO:      {}", p->icao_);
 
-      size_t decompressedRecords = p->DecompressLDMRecords(is);
-      if (decompressedRecords == 0)
+      std::size_t ldmRecords = p->ReadLDMRecords(is);
+      if (ldmRecords == 0)
       {
-         p->ParseLDMRecord(is);
+         auto messages = p->ParseLDMRecord(is);
+
+         // Uncompressed radar data is copied out of the stream into each
+         // message, so each message is resident
+         std::size_t messageBytes = 0;
+
+         std::unique_lock lock {p->dataMutex_};
+         for (auto& message : messages)
+         {
+            messageBytes +=
+               rda::Level2MessageHeader::SIZE + message->data_size();
+            p->HandleMessage(message);
+         }
+
+         p->residentBytes_.fetch_add(messageBytes, std::memory_order_relaxed);
       }
       else
       {
-         p->ParseLDMRecords();
+         p->ProcessLDMRecords();
       }
    }
 
@@ -275,12 +351,14 @@ bool Ar2vFile::LoadData(std::istream& is)
    return dataValid;
 }
 
-std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
+std::size_t Ar2vFileImpl::ReadLDMRecords(std::istream& is)
 {
-   logger_->debug("Decompressing LDM Records");
+   logger_->debug("Reading LDM Records");
 
    std::size_t numRecords = 0;
 
+   // Only read the control words and compressed record data here, so that
+   // decompression and parsing can be performed on each record independently
    while (is.peek() != EOF)
    {
       std::streampos startPosition = is.tellg();
@@ -300,59 +378,124 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
          break;
       }
 
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      util::rangebuf r(is.rdbuf(), recordSize);
-      in.push(boost::iostreams::bzip2_decompressor());
-      in.push(r);
+      LdmRecord& record = ldmRecords_.emplace_back();
+      record.index_     = numRecords;
+      record.compressedData_.resize(recordSize);
 
-      try
-      {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-         logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+      is.read(record.compressedData_.data(),
+              static_cast<std::streamsize>(recordSize));
 
-         rawRecords_.push_back(std::move(ss));
-      }
-      catch (const boost::iostreams::bzip2_error& ex)
+      if (static_cast<std::size_t>(is.gcount()) < recordSize)
       {
-         logger_->warn(
-            "Error decompressing record {}: {}", numRecords, ex.what());
-
-         is.seekg(startPosition + std::streampos(recordSize),
-                  std::ios_base::beg);
+         logger_->warn("LDM record {} truncated: {}/{} bytes",
+                       numRecords,
+                       is.gcount(),
+                       recordSize);
+         record.compressedData_.resize(static_cast<std::size_t>(is.gcount()));
       }
 
       ++numRecords;
    }
 
-   logger_->debug("Decompressed {} LDM Records", numRecords);
+   logger_->debug("Read {} LDM Records", numRecords);
 
    return numRecords;
 }
 
-void Ar2vFileImpl::ParseLDMRecords()
+void Ar2vFileImpl::ProcessLDMRecords()
 {
-   logger_->debug("Parsing LDM Records");
+   logger_->debug("Processing LDM Records");
 
-   std::size_t count = 0;
+   // Records are processed in chunks, so that elevation scans can be made
+   // available as soon as their radials are complete
+   const auto chunkSize = static_cast<std::ptrdiff_t>(
+      std::max(std::thread::hardware_concurrency(), 1u));
 
-   for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
+   auto chunkBegin = ldmRecords_.begin();
+   while (chunkBegin != ldmRecords_.end())
    {
-      std::stringstream& ss = *it;
+      auto chunkEnd =
+         chunkBegin + std::min(chunkSize, ldmRecords_.end() - chunkBegin);
 
-      logger_->trace("Record {}", count++);
+      // Decompress and parse each record in parallel
+      std::for_each(std::execution::par,
+                    chunkBegin,
+                    chunkEnd,
+                    [this](LdmRecord& record) { ProcessLDMRecord(record); });
 
-      ParseLDMRecord(ss);
+      // Merge the parsed messages in record order
+      {
+         std::unique_lock lock {dataMutex_};
+
+         for (auto it = chunkBegin; it != chunkEnd; ++it)
+         {
+            for (auto& message : it->messages_)
+            {
+               HandleMessage(message);
+            }
+            it->messages_.clear();
+         }
+      }
+
+      IndexCompletedElevationScans();
+
+      chunkBegin = chunkEnd;
    }
 
-   rawRecords_.clear();
+   ldmRecords_.clear();
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+void Ar2vFileImpl::ProcessLDMRecord(LdmRecord& record)
+{
+   logger_->trace("Record {}", record.index_);
+
+   boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+   in.push(boost::iostreams::bzip2_decompressor());
+   in.push(boost::iostreams::array_source(record.compressedData_.data(),
+                                          record.compressedData_.size()));
+
+   // Decompress directly into the arena. Parsed radar data references gate
+   // data in place, and keeps the arena alive for as long as it is needed.
+   auto arena = std::make_shared<std::vector<char>>();
+
+   util::ScopedTimer decompressTimer {decompressHistogram_};
+
+   try
+   {
+      std::streamsize bytesCopied =
+         boost::iostreams::copy(in, boost::iostreams::back_inserter(*arena));
+      logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+   }
+   catch (const boost::iostreams::bzip2_error& ex)
+   {
+      logger_->warn(
+         "Error decompressing record {}: {}", record.index_, ex.what());
+      arena->clear();
+   }
+
+   decompressTimer.Stop();
+
+   residentBytes_.fetch_add(arena->capacity(), std::memory_order_relaxed);
+
+   // Compressed data is no longer required
+   record.compressedData_.clear();
+   record.compressedData_.shrink_to_fit();
+
+   util::arenabuf arenaBuffer {arena};
+   std::istream   is {&arenaBuffer};
+
+   util::ScopedTimer parseTimer {parseHistogram_};
+   record.messages_ = ParseLDMRecord(is);
+}
+
+std::vector<std::shared_ptr<rda::Level2Message>>
+Ar2vFileImpl::ParseLDMRecord(std::istream& is)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
 
+   std::vector<std::shared_ptr<rda::Level2Message>> messages {};
+
    auto ctx = rda::Level2MessageFactory::CreateContext();
 
    while (!is.eof() && !is.fail())
@@ -401,7 +544,7 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
 
          if (msgInfo.messageValid)
          {
-            HandleMessage(msgInfo.message);
+            messages.push_back(std::move(msgInfo.message));
          }
       }
 
@@ -409,6 +552,8 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
       is.seekg(messageStart + static_cast<std::streampos>(messageSize),
                std::ios_base::beg);
    }
+
+   return messages;
 }
 
 void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
@@ -439,75 +584,151 @@ void Ar2vFileImpl::ProcessRadarData(
    std::uint16_t azimuthIndex   = message->azimuth_number() - 1;
    std::uint16_t elevationIndex = message->elevation_number() - 1;
 
+   // Elevation scans are transmitted in order. Once a radial from a new
+   // elevation is received, the previous elevation scan is complete.
+   if (currentElevationIndex_.has_value() &&
+       currentElevationIndex_.value() != elevationIndex)
+   {
+      completedElevations_.push_back(currentElevationIndex_.value());
+   }
+   currentElevationIndex_ = elevationIndex;
+
+   // An indexed elevation scan may already be in use by readers, and must not
+   // be modified. Discard radials received after the scan was completed.
+   if (indexedElevations_.contains(elevationIndex))
+   {
+      logger_->warn("Discarding radial {} of completed elevation {}",
+                    azimuthIndex,
+                    elevationIndex);
+      return;
+   }
+
    if (radarData_[elevationIndex] == nullptr)
    {
       radarData_[elevationIndex] = std::make_shared<rda::ElevationScan>();
    }
 
-   (*radarData_[elevationIndex])[azimuthIndex] = message;
+   radarData_[elevationIndex]->SetRadial(azimuthIndex, message);
 }
 
-void Ar2vFileImpl::IndexFile()
+void Ar2vFileImpl::IndexCompletedElevationScans()
 {
-   logger_->debug("Indexing file");
+   std::vector<float> elevationCuts {};
 
-   for (auto& elevationCut : radarData_)
    {
-      std::uint16_t     elevationAngle {};
-      rda::WaveformType waveformType = rda::WaveformType::Unknown;
+      std::unique_lock lock {dataMutex_};
 
-      std::shared_ptr<rda::GenericRadarData>& radial0 =
-         (*elevationCut.second)[0];
-
-      if (radial0 == nullptr)
+      for (std::uint16_t elevationIndex : completedElevations_)
       {
-         logger_->warn("Empty radial data");
-         continue;
+         std::optional<float> elevationCut =
+            IndexElevationScan(elevationIndex);
+
+         if (elevationCut.has_value())
+         {
+            elevationCuts.push_back(elevationCut.value());
+         }
       }
 
-      std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
+      completedElevations_.clear();
+   }
 
-      if (vcpData_ != nullptr)
-      {
-         elevationAngle = vcpData_->elevation_angle_raw(elevationCut.first);
-         waveformType   = vcpData_->waveform_type(elevationCut.first);
-      }
-      else if ((digitalRadarData0 =
-                   std::dynamic_pointer_cast<rda::DigitalRadarData>(radial0)) !=
-               nullptr)
-      {
-         elevationAngle = digitalRadarData0->elevation_angle_raw();
-      }
-      else
+   // Invoke the callback without holding the lock, so the receiver may
+   // immediately query the new elevation scan
+   if (elevationScanCallback_ != nullptr)
+   {
+      for (float elevationCut : elevationCuts)
       {
-         // Return here, because we should only have a single message type
-         logger_->warn("Cannot index file without VCP data");
-         return;
+         elevationScanCallback_(elevationCut);
       }
+   }
+}
+
+void Ar2vFileImpl::IndexFile()
+{
+   logger_->debug("Indexing file");
+
+   {
+      std::unique_lock lock {dataMutex_};
 
-      for (rda::DataBlockType dataBlockType :
-           rda::MomentDataBlockTypeIterator())
+      // All remaining elevation scans are complete
+      for (auto& elevationCut : radarData_)
       {
-         if (dataBlockType == rda::DataBlockType::MomentRef &&
-             waveformType ==
-                rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
+         if (!indexedElevations_.contains(elevationCut.first))
          {
-            // Reflectivity data is contained within both surveillance and
-            // doppler modes.  Surveillance mode produces a better image.
-            continue;
+            completedElevations_.push_back(elevationCut.first);
          }
+      }
+   }
 
-         auto momentData = radial0->moment_data_block(dataBlockType);
+   IndexCompletedElevationScans();
+}
 
-         if (momentData != nullptr)
-         {
-            auto time = util::TimePoint(radial0->modified_julian_date(),
-                                        radial0->collection_time());
+std::optional<float>
+Ar2vFileImpl::IndexElevationScan(std::uint16_t elevationIndex)
+{
+   auto elevationCut = radarData_.find(elevationIndex);
+   if (elevationCut == radarData_.cend() ||
+       indexedElevations_.contains(elevationIndex))
+   {
+      return std::nullopt;
+   }
 
-            index_[dataBlockType][elevationAngle][time] = elevationCut.second;
-         }
+   indexedElevations_.insert(elevationIndex);
+
+   std::uint16_t     elevationAngle {};
+   rda::WaveformType waveformType = rda::WaveformType::Unknown;
+
+   const std::shared_ptr<rda::GenericRadarData>& radial0 =
+      elevationCut->second->radial(0);
+
+   if (radial0 == nullptr)
+   {
+      logger_->warn("Empty radial data");
+      return std::nullopt;
+   }
+
+   std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
+
+   if (vcpData_ != nullptr)
+   {
+      elevationAngle = vcpData_->elevation_angle_raw(elevationCut->first);
+      waveformType   = vcpData_->waveform_type(elevationCut->first);
+   }
+   else if ((digitalRadarData0 =
+                std::dynamic_pointer_cast<rda::DigitalRadarData>(radial0)) !=
+            nullptr)
+   {
+      elevationAngle = digitalRadarData0->elevation_angle_raw();
+   }
+   else
+   {
+      logger_->warn("Cannot index file without VCP data");
+      return std::nullopt;
+   }
+
+   for (rda::DataBlockType dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      if (dataBlockType == rda::DataBlockType::MomentRef &&
+          waveformType ==
+             rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
+      {
+         // Reflectivity data is contained within both surveillance and
+         // doppler modes.  Surveillance mode produces a better image.
+         continue;
+      }
+
+      auto momentData = radial0->moment_data_block(dataBlockType);
+
+      if (momentData != nullptr)
+      {
+         auto time = util::TimePoint(radial0->modified_julian_date(),
+                                     radial0->collection_time());
+
+         index_[dataBlockType][elevationAngle][time] = elevationCut->second;
       }
    }
+
+   return elevationAngle / kElevationScaleFactor_;
 }
 
 } // namespace wsr88d
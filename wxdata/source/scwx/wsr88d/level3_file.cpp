@@ -1,7 +1,9 @@
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/wsr88d/rpg/ccb_header.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
 #include <scwx/wsr88d/rpg/level3_message_factory.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 
 #include <fstream>
 #include <sstream>
@@ -37,6 +39,11 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::level3_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static auto& decompressHistogram_ =
+   util::MetricsRegistry::Instance().GetHistogram("decode.level3.decompress");
+static auto& parseHistogram_ =
+   util::MetricsRegistry::Instance().GetHistogram("decode.level3.parse");
+
 class Level3FileImpl
 {
 public:
@@ -44,13 +51,16 @@ public:
        wmoHeader_ {}, ccbHeader_ {}, innerHeader_ {}, message_ {} {};
    ~Level3FileImpl() = default;
 
-   bool DecompressFile(std::istream& is, std::stringstream& ss);
-   bool LoadFileData(std::istream& is);
+   bool        DecompressFile(std::istream& is, std::stringstream& ss);
+   bool        LoadFileData(std::istream& is);
+   std::size_t MessageResidentBytes() const;
 
    std::shared_ptr<awips::WmoHeader>   wmoHeader_;
    std::shared_ptr<rpg::CcbHeader>     ccbHeader_;
    std::shared_ptr<awips::WmoHeader>   innerHeader_;
    std::shared_ptr<rpg::Level3Message> message_;
+
+   std::size_t residentBytes_ {0};
 };
 
 Level3File::Level3File() : p(std::make_unique<Level3FileImpl>()) {}
@@ -69,6 +79,11 @@ std::shared_ptr<rpg::Level3Message> Level3File::message() const
    return p->message_;
 }
 
+std::size_t Level3File::resident_bytes() const
+{
+   return p->residentBytes_;
+}
+
 bool Level3File::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
@@ -128,6 +143,8 @@ bool Level3File::LoadData(std::istream& is)
 
 bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
 {
+   util::ScopedTimer decompressTimer {decompressHistogram_};
+
    bool dataValid = true;
 
    std::streampos  dataStart          = is.tellg();
@@ -164,6 +181,8 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
          dataValid = false;
       }
 
+   decompressTimer.Stop();
+
    if (dataValid)
    {
       logger_->trace("Input data consumed = {} bytes", totalBytesCopied);
@@ -184,10 +203,55 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
 
 bool Level3FileImpl::LoadFileData(std::istream& is)
 {
-   message_ = rpg::Level3MessageFactory::Create(is);
+   util::ScopedTimer parseTimer {parseHistogram_};
+
+   message_       = rpg::Level3MessageFactory::Create(is);
+   residentBytes_ = MessageResidentBytes();
 
    return (message_ != nullptr);
 }
 
+std::size_t Level3FileImpl::MessageResidentBytes() const
+{
+   if (message_ == nullptr)
+   {
+      return 0u;
+   }
+
+   auto graphicMessage =
+      std::dynamic_pointer_cast<rpg::GraphicProductMessage>(message_);
+
+   if (graphicMessage == nullptr)
+   {
+      // Other messages are not compressed, and parsed data is approximately
+      // the size of the message
+      return message_->header().length_of_message();
+   }
+
+   // The message length of a compressed product is the compressed length, so
+   // the parsed product data is measured using the length of each block after
+   // decompression
+   std::size_t residentBytes =
+      rpg::Level3MessageHeader::SIZE + rpg::ProductDescriptionBlock::SIZE;
+
+   if (auto symbologyBlock = graphicMessage->symbology_block();
+       symbologyBlock != nullptr)
+   {
+      residentBytes += symbologyBlock->data_size();
+   }
+   if (auto graphicBlock = graphicMessage->graphic_block();
+       graphicBlock != nullptr)
+   {
+      residentBytes += graphicBlock->data_size();
+   }
+   if (auto tabularBlock = graphicMessage->tabular_block();
+       tabularBlock != nullptr)
+   {
+      residentBytes += tabularBlock->data_size();
+   }
+
+   return residentBytes;
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -60,7 +60,9 @@ NexradFileFactory::Create(const std::string& filename)
    return nexradFile;
 }
 
-std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
+std::shared_ptr<NexradFile>
+NexradFileFactory::Create(std::istream&                is,
+                          const ElevationScanCallback& elevationScanCallback)
 {
    std::shared_ptr<NexradFile> message = nullptr;
 
@@ -116,7 +118,23 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
    {
       if (buffer.starts_with("AR2V") || buffer.starts_with("ARCHIVE2"))
       {
-         message = std::make_shared<Ar2vFile>();
+         auto ar2vFile = std::make_shared<Ar2vFile>();
+
+         if (elevationScanCallback != nullptr)
+         {
+            std::weak_ptr<Ar2vFile> ar2vFileRef = ar2vFile;
+            ar2vFile->SetElevationScanCallback(
+               [=](float elevationCut)
+               {
+                  auto file = ar2vFileRef.lock();
+                  if (file != nullptr)
+                  {
+                     elevationScanCallback(file, elevationCut);
+                  }
+               });
+         }
+
+         message = ar2vFile;
       }
       else
       {
@@ -1,6 +1,10 @@
 #include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
+#include <scwx/util/arenabuf.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <cstring>
+#include <new>
+
 namespace scwx
 {
 namespace wsr88d
@@ -63,8 +67,14 @@ public:
    float         scale_ {0.0f};
    float         offset_ {0.0f};
 
-   std::vector<std::uint8_t>  momentGates8_ {};
-   std::vector<std::uint16_t> momentGates16_ {};
+   std::span<const std::uint8_t>  momentGates8_ {};
+   std::span<const std::uint16_t> momentGates16_ {};
+
+   // Backing storage for the moment gate views. Only one of these is used,
+   // depending on whether the message was parsed from an arena buffer.
+   std::shared_ptr<const std::vector<char>> arena_ {};
+   std::vector<std::uint8_t>                ownedGates8_ {};
+   std::vector<std::uint16_t>               ownedGates16_ {};
 };
 
 DigitalRadarDataGeneric::MomentDataBlock::MomentDataBlock(
@@ -156,6 +166,18 @@ const void* DigitalRadarDataGeneric::MomentDataBlock::data_moments() const
    return dataMoments;
 }
 
+std::span<const std::uint8_t>
+DigitalRadarDataGeneric::MomentDataBlock::data_moments8() const
+{
+   return p->momentGates8_;
+}
+
+std::span<const std::uint16_t>
+DigitalRadarDataGeneric::MomentDataBlock::data_moments16() const
+{
+   return p->momentGates16_;
+}
+
 std::shared_ptr<DigitalRadarDataGeneric::MomentDataBlock>
 DigitalRadarDataGeneric::MomentDataBlock::Create(
    const std::string& dataBlockType,
@@ -199,18 +221,70 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
 
    if (p->numberOfDataMomentGates_ <= 1840)
    {
+      const std::size_t dataSize =
+         static_cast<std::size_t>(p->numberOfDataMomentGates_) *
+         (p->dataWordSize_ / 8);
+
+      // If the stream is backed by an arena, reference the gates in place
+      util::arenabuf* arena   = dynamic_cast<util::arenabuf*>(is.rdbuf());
+      char*           gates   = nullptr;
+      bool            inArena = false;
+
+      if (arena != nullptr && is.good() &&
+          static_cast<std::size_t>(arena->in_avail()) >= dataSize)
+      {
+         gates = arena->current();
+         inArena =
+            (p->dataWordSize_ != 16 ||
+             reinterpret_cast<std::uintptr_t>(gates) % alignof(std::uint16_t) ==
+                0);
+      }
+
       if (p->dataWordSize_ == 8)
       {
-         p->momentGates8_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
-                 p->numberOfDataMomentGates_);
+         if (inArena)
+         {
+            p->arena_        = arena->arena();
+            p->momentGates8_ = {reinterpret_cast<std::uint8_t*>(gates),
+                                p->numberOfDataMomentGates_};
+            is.seekg(dataSize, std::ios_base::cur);
+         }
+         else
+         {
+            p->ownedGates8_.resize(p->numberOfDataMomentGates_);
+            is.read(reinterpret_cast<char*>(p->ownedGates8_.data()),
+                    p->numberOfDataMomentGates_);
+            p->momentGates8_ = p->ownedGates8_;
+         }
       }
       else if (p->dataWordSize_ == 16)
       {
-         p->momentGates16_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates16_.data()),
-                 p->numberOfDataMomentGates_ * 2);
-         awips::Message::SwapVector(p->momentGates16_);
+         if (inArena)
+         {
+            // Start the lifetime of the gates as an array of std::uint16_t
+            // within the arena storage, as std::start_lifetime_as_array
+            // would. std::memmove implicitly creates the array, and preserves
+            // the bytes of each gate. The gates were checked to be aligned.
+            std::uint16_t* data16 = std::launder(static_cast<std::uint16_t*>(
+               std::memmove(gates, gates, dataSize)));
+
+            // Swap byte order in place, the arena is exclusive to this parse
+            std::span<std::uint16_t> gates16 {data16,
+                                              p->numberOfDataMomentGates_};
+            awips::Message::SwapSpan(gates16);
+
+            p->arena_         = arena->arena();
+            p->momentGates16_ = gates16;
+            is.seekg(dataSize, std::ios_base::cur);
+         }
+         else
+         {
+            p->ownedGates16_.resize(p->numberOfDataMomentGates_);
+            is.read(reinterpret_cast<char*>(p->ownedGates16_.data()),
+                    p->numberOfDataMomentGates_ * 2);
+            awips::Message::SwapVector(p->ownedGates16_);
+            p->momentGates16_ = p->ownedGates16_;
+         }
       }
       else
       {
@@ -0,0 +1,165 @@
+#include <scwx/wsr88d/rda/elevation_scan.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::shared_ptr<GenericRadarData> kNullRadial_ {nullptr};
+
+class ElevationScan::Impl
+{
+public:
+   explicit Impl()
+   {
+      radials_.reserve(common::MAX_0_5_DEGREE_RADIALS);
+      azimuthAngles_.reserve(common::MAX_0_5_DEGREE_RADIALS);
+      elevationAngles_.reserve(common::MAX_0_5_DEGREE_RADIALS);
+      modifiedJulianDates_.reserve(common::MAX_0_5_DEGREE_RADIALS);
+      collectionTimes_.reserve(common::MAX_0_5_DEGREE_RADIALS);
+   }
+   ~Impl() = default;
+
+   void Resize(std::size_t size);
+
+   std::vector<std::shared_ptr<GenericRadarData>> radials_ {};
+   std::vector<float>                             azimuthAngles_ {};
+   std::vector<float>                             elevationAngles_ {};
+   std::vector<std::uint16_t>                     modifiedJulianDates_ {};
+   std::vector<std::uint32_t>                     collectionTimes_ {};
+
+   std::size_t radialCount_ {0};
+   std::size_t firstRadial_ {std::numeric_limits<std::size_t>::max()};
+};
+
+ElevationScan::ElevationScan() : p(std::make_unique<Impl>()) {}
+ElevationScan::~ElevationScan() = default;
+
+ElevationScan::ElevationScan(ElevationScan&&) noexcept            = default;
+ElevationScan& ElevationScan::operator=(ElevationScan&&) noexcept = default;
+
+void ElevationScan::Impl::Resize(std::size_t size)
+{
+   constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+   radials_.resize(size);
+   azimuthAngles_.resize(size, kNaN);
+   elevationAngles_.resize(size, kNaN);
+   modifiedJulianDates_.resize(size, 0u);
+   collectionTimes_.resize(size, 0u);
+}
+
+std::size_t ElevationScan::size() const
+{
+   return p->radials_.size();
+}
+
+std::size_t ElevationScan::radial_count() const
+{
+   return p->radialCount_;
+}
+
+bool ElevationScan::empty() const
+{
+   return p->radialCount_ == 0;
+}
+
+bool ElevationScan::contains(std::uint16_t azimuthIndex) const
+{
+   return azimuthIndex < p->radials_.size() &&
+          p->radials_[azimuthIndex] != nullptr;
+}
+
+const std::shared_ptr<GenericRadarData>&
+ElevationScan::radial(std::uint16_t azimuthIndex) const
+{
+   if (azimuthIndex >= p->radials_.size())
+   {
+      return kNullRadial_;
+   }
+   return p->radials_[azimuthIndex];
+}
+
+const std::shared_ptr<GenericRadarData>& ElevationScan::front() const
+{
+   if (p->radialCount_ == 0)
+   {
+      return kNullRadial_;
+   }
+   return p->radials_[p->firstRadial_];
+}
+
+const std::shared_ptr<GenericRadarData>& ElevationScan::back() const
+{
+   // The last slot is always occupied
+   if (p->radialCount_ == 0)
+   {
+      return kNullRadial_;
+   }
+   return p->radials_.back();
+}
+
+std::span<const std::shared_ptr<GenericRadarData>>
+ElevationScan::radials() const
+{
+   return p->radials_;
+}
+
+std::span<const float> ElevationScan::azimuth_angles() const
+{
+   return p->azimuthAngles_;
+}
+
+std::span<const float> ElevationScan::elevation_angles() const
+{
+   return p->elevationAngles_;
+}
+
+std::span<const std::uint16_t> ElevationScan::modified_julian_dates() const
+{
+   return p->modifiedJulianDates_;
+}
+
+std::span<const std::uint32_t> ElevationScan::collection_times() const
+{
+   return p->collectionTimes_;
+}
+
+void ElevationScan::SetRadial(
+   std::uint16_t azimuthIndex, const std::shared_ptr<GenericRadarData>& radial)
+{
+   if (radial == nullptr)
+   {
+      return;
+   }
+
+   if (azimuthIndex >= p->radials_.size())
+   {
+      p->Resize(azimuthIndex + 1u);
+   }
+
+   if (p->radials_[azimuthIndex] == nullptr)
+   {
+      ++p->radialCount_;
+   }
+
+   p->radials_[azimuthIndex]             = radial;
+   p->azimuthAngles_[azimuthIndex]       = radial->azimuth_angle().value();
+   p->elevationAngles_[azimuthIndex]     = radial->elevation_angle().value();
+   p->modifiedJulianDates_[azimuthIndex] = radial->modified_julian_date();
+   p->collectionTimes_[azimuthIndex]     = radial->collection_time();
+
+   p->firstRadial_ = std::min<std::size_t>(p->firstRadial_, azimuthIndex);
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -53,23 +53,28 @@ set(HDR_GR include/scwx/gr/color.hpp
            include/scwx/gr/placefile.hpp)
 set(SRC_GR source/scwx/gr/color.cpp
            source/scwx/gr/placefile.cpp)
-set(HDR_NETWORK include/scwx/network/cpr.hpp
+set(HDR_NETWORK include/scwx/network/content_validator.hpp
+                include/scwx/network/cpr.hpp
                 include/scwx/network/dir_list.hpp)
-set(SRC_NETWORK source/scwx/network/cpr.cpp
+set(SRC_NETWORK source/scwx/network/content_validator.cpp
+                source/scwx/network/cpr.cpp
                 source/scwx/network/dir_list.cpp)
 set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/aws_level3_data_provider.hpp
                  include/scwx/provider/aws_nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider_factory.hpp
+                 include/scwx/provider/nexrad_object_cache.hpp
                  include/scwx/provider/warnings_provider.hpp)
 set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/aws_level3_data_provider.cpp
                  source/scwx/provider/aws_nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
+                 source/scwx/provider/nexrad_object_cache.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/arenabuf.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
@@ -77,17 +82,20 @@ set(HDR_UTIL include/scwx/util/digest.hpp
              include/scwx/util/iterator.hpp
              include/scwx/util/logger.hpp
              include/scwx/util/map.hpp
+             include/scwx/util/metrics.hpp
              include/scwx/util/rangebuf.hpp
              include/scwx/util/streams.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/arenabuf.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
              source/scwx/util/logger.cpp
+             source/scwx/util/metrics.cpp
              source/scwx/util/rangebuf.cpp
              source/scwx/util/streams.cpp
              source/scwx/util/strings.cpp
@@ -108,6 +116,7 @@ set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/clutter_filter_map.hpp
                    include/scwx/wsr88d/rda/digital_radar_data.hpp
                    include/scwx/wsr88d/rda/digital_radar_data_generic.hpp
+                   include/scwx/wsr88d/rda/elevation_scan.hpp
                    include/scwx/wsr88d/rda/generic_radar_data.hpp
                    include/scwx/wsr88d/rda/level2_message.hpp
                    include/scwx/wsr88d/rda/level2_message_factory.hpp
@@ -121,6 +130,7 @@ set(SRC_WSR88D_RDA source/scwx/wsr88d/rda/clutter_filter_bypass_map.cpp
                    source/scwx/wsr88d/rda/clutter_filter_map.cpp
                    source/scwx/wsr88d/rda/digital_radar_data.cpp
                    source/scwx/wsr88d/rda/digital_radar_data_generic.cpp
+                   source/scwx/wsr88d/rda/elevation_scan.cpp
                    source/scwx/wsr88d/rda/generic_radar_data.cpp
                    source/scwx/wsr88d/rda/level2_message.cpp
                    source/scwx/wsr88d/rda/level2_message_factory.cpp